@@ -0,0 +1,149 @@
+/*
+ * bench_archive.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Offers random evaluations of Gao2020 (3 objectives), Chen2015 (5) and
+ * Ahmad2017 (7) to an unbounded archive and to a linear-scan archive, which
+ * checks every archived point on each offer, and compares the decisions
+ * and the times. Evaluations are drawn around a moving centre that shrinks
+ * towards a random point, so the archive keeps changing as a search would.
+ * A bounded archive of 1000 points is timed last.
+ *
+ *   gcc -O2 -I.. bench_archive.c ../gmf_archive.c ../gmf_dv_rwa.c \
+ *       ../gmf_rng.c -o bench_archive -lm
+ *   ./bench_archive [n]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "gmf_global.h"
+#include "gmf_dv_rwa.h"
+#include "gmf_rng.h"
+#include "gmf_archive.h"
+
+void (*gmf_test_problem)(double *F, double *G, double *xr, int *xi, int *xb);
+struct gmf_mop_desc gmf_mop;
+
+static double wall_time()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static int covers(const double *a, const double *b, size_t d)
+{
+	size_t k;
+	for (k = 0; k < d; ++k)
+	{
+		if (a[k] > b[k])
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/**
+ * Linear-scan archive of the m rows of L, returns whether f was stored
+ */
+static int linear_insert(double *L, size_t *m, const double *f, size_t d)
+{
+	size_t i, kept = 0;
+	for (i = 0; i < *m; ++i)
+	{
+		if (covers(L + i * d, f, d))
+		{
+			return 0;
+		}
+	}
+	for (i = 0; i < *m; ++i)
+	{
+		if (!covers(f, L + i * d, d))
+		{
+			memmove(L + kept++ * d, L + i * d, sizeof(double) * d);
+		}
+	}
+	memcpy(L + kept++ * d, f, sizeof(double) * d);
+	*m = kept;
+	return 1;
+}
+
+static void bench_problem(char *name, size_t n)
+{
+	gmf_rwa_problem *problem = gmf_rwa_create(name);
+	const struct gmf_mop_desc *mop = gmf_rwa_desc(problem);
+	size_t nreal = mop->nreal, nobjs = mop->nobjs, i, j, m = 0, accepted = 0;
+	size_t mismatches = 0;
+	double *X = malloc(sizeof(double) * n * nreal);
+	double *F = malloc(sizeof(double) * n * nobjs);
+	double *L = malloc(sizeof(double) * n * nobjs);
+	double *centre = malloc(sizeof(double) * nreal), width, t_tree, t_linear;
+	double t_bounded;
+	gmf_archive *archive = gmf_archive_create(nobjs, nreal, 0);
+	gmf_rng rng;
+	int r;
+
+	gmf_rng_init(&rng, 7, 0);
+	gmf_rwa_rnd_solutions(&rng, mop, 1, centre, nreal);
+	gmf_rwa_rnd_solutions(&rng, mop, n, X, nreal);
+	for (i = 0; i < n; ++i)
+	{
+		width = 1.0 - (double) i / n;
+		for (j = 0; j < nreal; ++j)
+		{
+			X[i * nreal + j] = centre[j] + width * (X[i * nreal + j] - centre[j]);
+		}
+	}
+	gmf_rwa_eval_batch(problem, n, X, nreal, F, nobjs, gmf_row_major);
+
+	t_tree = wall_time();
+	for (i = 0; i < n; ++i)
+	{
+		accepted += gmf_archive_insert(archive, F + i * nobjs, X + i * nreal)
+				== 1;
+	}
+	t_tree = wall_time() - t_tree;
+
+	t_linear = wall_time();
+	gmf_archive_clear(archive);
+	for (i = 0; i < n; ++i)
+	{
+		r = linear_insert(L, &m, F + i * nobjs, nobjs);
+		mismatches += r != gmf_archive_insert(archive, F + i * nobjs, NULL);
+	}
+	t_linear = wall_time() - t_linear;
+	mismatches += m != gmf_archive_size(archive);
+
+	gmf_archive_destroy(archive);
+	archive = gmf_archive_create(nobjs, nreal, 1000);
+	t_bounded = wall_time();
+	gmf_archive_insert_batch(archive, n, F, nobjs, X, nreal);
+	t_bounded = wall_time() - t_bounded;
+
+	printf("%-10s %4zu %8zu %8zu %8zu %10.2f %10.2f %10.2f %6zu\n", name, nobjs,
+			n, accepted, m, t_tree * 1e3, t_linear * 1e3, t_bounded * 1e3,
+			mismatches);
+	gmf_archive_destroy(archive);
+	gmf_rwa_destroy(problem);
+	free(X);
+	free(F);
+	free(L);
+	free(centre);
+	return;
+}
+
+int main(int argc, char **argv)
+{
+	size_t n = argc > 1 ? strtoul(argv[1], NULL, 10) : 100000;
+
+	printf("%-10s %4s %8s %8s %8s %10s %10s %10s %6s\n", "problem", "objs",
+			"offers", "stored", "final", "tree ms", "linear ms", "1000 ms",
+			"diff");
+	bench_problem("Gao2020", n);
+	bench_problem("Chen2015", n);
+	bench_problem("Ahmad2017", n);
+	return 0;
+}
@@ -0,0 +1,200 @@
+/*
+ * bench_async.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * A steady-state loop (one offspring submitted at a time, with up to window
+ * of them awaiting results) through gmf_async, against evaluating each
+ * offspring synchronously with gmf_rwa_eval. Results are drained from the
+ * completion queue, or taken by a callback, and compared bitwise with
+ * gmf_rwa_evaluate of the whole set, with the dispatcher evaluating full
+ * batches (the default) and with the submitter running them inline
+ * (gmf_async_set_inline). Prints nanoseconds per point and the mean size
+ * of the micro-batches.
+ *
+ *   gcc -O2 -I.. bench_async.c ../gmf_async.c ../gmf_dv_rwa.c ../gmf_rng.c \
+ *       ../gmf_pof.c ../gmf_parse.c -o bench_async -lm -lpthread
+ *   ./bench_async [points] [batch] [deadline_ns]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "gmf_global.h"
+#include "gmf_dv_rwa.h"
+#include "gmf_rng.h"
+#include "gmf_async.h"
+
+void (*gmf_test_problem)(double *F, double *G, double *xr, int *xi, int *xb);
+struct gmf_mop_desc gmf_mop;
+
+#define RUNS 3
+
+/**
+ * Offspring awaiting results (0: taken by the callback), inline runs
+ */
+static const struct mode
+{
+	size_t window;
+	int run_inline;
+	const char *name;
+} modes[] = { { 1, 0, "window 1" }, { 0, 0, "callback" }, { 16, 0,
+		"window 16" }, { 256, 0, "window 256" }, { 1, 1, "inline 1" }, { 0, 1,
+		"inline cb" } };
+
+struct collect
+{
+	double *F;
+	size_t nobjs;
+};
+
+static double wall_time()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+/**
+ * Callback: the results go to row `ticket` of F
+ */
+static void collect(void *context, size_t n, const long long *tickets,
+		const double *F)
+{
+	struct collect *c = context;
+	size_t i;
+
+	for (i = 0; i < n; ++i)
+	{
+		memcpy(c->F + tickets[i] * c->nobjs, F + i * c->nobjs,
+				sizeof(double) * c->nobjs);
+	}
+	return;
+}
+
+/**
+ * Steady-state loop over the n points with up to mode->window in flight,
+ * returning seconds; F gets the objectives
+ */
+static double steady_state(const struct gmf_rwa_entry *entry, size_t n,
+		const double *X, double *F, const struct mode *mode, size_t batch,
+		long deadline, size_t *batches)
+{
+	struct collect c = { F, entry->nobjs };
+	int callback = mode->window == 0;
+	size_t window = callback ? 1 : mode->window;
+	gmf_async *async = gmf_async_create((char *) entry->name, batch, deadline,
+			callback ? collect : NULL, &c);
+	double *f = malloc(sizeof(double) * window * entry->nobjs), t;
+	long long *tickets = malloc(sizeof(long long) * window);
+	size_t i, k, got, inflight = 0;
+
+	gmf_async_set_inline(async, mode->run_inline);
+	t = wall_time();
+	for (i = 0; i < n; ++i)
+	{
+		gmf_async_submit(async, 1, X + i * entry->nreal, entry->nreal);
+		++inflight;
+		if (!callback && inflight == window)
+		{
+			/* the algorithm needs a result before the next offspring */
+			got = gmf_async_poll(async, window, tickets, f, -1);
+			for (k = 0; k < got; ++k)
+			{
+				memcpy(F + tickets[k] * entry->nobjs, f + k * entry->nobjs,
+						sizeof(double) * entry->nobjs);
+			}
+			inflight -= got;
+		}
+	}
+	gmf_async_flush(async);
+	while (!callback && inflight > 0)
+	{
+		got = gmf_async_poll(async, window, tickets, f, 0);
+		for (k = 0; k < got; ++k)
+		{
+			memcpy(F + tickets[k] * entry->nobjs, f + k * entry->nobjs,
+					sizeof(double) * entry->nobjs);
+		}
+		inflight -= got;
+	}
+	t = wall_time() - t;
+	*batches = gmf_async_batches(async);
+	gmf_async_destroy(async);
+	free(f);
+	free(tickets);
+	return t;
+}
+
+static void bench_problem(int function, size_t n, size_t batch, long deadline)
+{
+	const struct gmf_rwa_entry *entry = gmf_rwa_registry(function);
+	gmf_rwa_problem *problem = gmf_rwa_create((char *) entry->name);
+	double *X = malloc(sizeof(double) * n * entry->nreal);
+	double *F = malloc(sizeof(double) * n * entry->nobjs);
+	double *G = malloc(sizeof(double) * n * entry->nobjs);
+	double sync = 1e30, t, best;
+	size_t i, m, batches = 0;
+	int run, same = 1;
+	gmf_rng rng;
+
+	gmf_rng_init(&rng, 7, function);
+	gmf_rwa_rnd_solutions(&rng, gmf_rwa_desc(problem), n, X, entry->nreal);
+	gmf_rwa_evaluate(function, n, X, entry->nreal, G, entry->nobjs,
+			gmf_row_major);
+	for (run = 0; run < RUNS; ++run)
+	{
+		t = wall_time();
+		for (i = 0; i < n; ++i)
+		{
+			gmf_rwa_eval(problem, F + i * entry->nobjs, X + i * entry->nreal);
+		}
+		t = wall_time() - t;
+		sync = t < sync ? t : sync;
+	}
+	printf("%-18s %8.1f", entry->name, 1e9 * sync / n);
+
+	for (m = 0; m < sizeof(modes) / sizeof(modes[0]); ++m)
+	{
+		best = 1e30;
+		for (run = 0; run < RUNS; ++run)
+		{
+			memset(F, 0, sizeof(double) * n * entry->nobjs);
+			t = steady_state(entry, n, X, F, &modes[m], batch, deadline,
+					&batches);
+			best = t < best ? t : best;
+			same = same && memcmp(F, G, sizeof(double) * n * entry->nobjs)
+					== 0;
+		}
+		printf(" %8.1f %6.1f", 1e9 * best / n, (double) n / batches);
+	}
+	printf(" %5s\n", same ? "yes" : "NO");
+	gmf_rwa_destroy(problem);
+	free(X);
+	free(F);
+	free(G);
+	return;
+}
+
+int main(int argc, char **argv)
+{
+	size_t n = argc > 1 ? strtoul(argv[1], NULL, 10) : 200000;
+	size_t batch = argc > 2 ? strtoul(argv[2], NULL, 10) : 64;
+	long deadline = argc > 3 ? atol(argv[3]) : 20000;
+	size_t m;
+	int function;
+
+	printf("batch %zu, deadline %ld ns; ns per point and mean batch\n", batch,
+			deadline);
+	printf("%-18s %8s", "problem", "sync");
+	for (m = 0; m < sizeof(modes) / sizeof(modes[0]); ++m)
+	{
+		printf(" %15s", modes[m].name);
+	}
+	printf(" %5s\n", "same");
+	for (function = 0; function < 10; ++function)
+	{
+		bench_problem(function, n, batch, deadline);
+	}
+	return 0;
+}
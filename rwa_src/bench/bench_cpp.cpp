@@ -0,0 +1,227 @@
+/*
+ * bench_cpp.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Evaluation of one point at a time, as an optimizer loop does, through the
+ * C interface (gmf_rwa_eval on a problem handle: a function pointer and the
+ * evaluation counter per point) and through gmf_rwa.hpp: std::visit on an
+ * AnyProblem per point, and a loop compiled for each Problem type. Batches
+ * of gmf_rwa_evaluate with the generated kernels are timed as the bound.
+ * Prints the best nanoseconds per point and the largest difference of the
+ * C++ objectives from the batch. First checks every Problem type against
+ * its entry of the C registry (gmf_rwa_registry), as the constants of
+ * gmf_rwa.hpp are a copy of it, and exits with 1 if they differ.
+ *
+ *   gcc -O2 -c ../gmf_dv_rwa.c ../gmf_rng.c ../gmf_pof.c ../gmf_parse.c
+ *   g++ -std=c++20 -O2 -I.. bench_cpp.cpp gmf_dv_rwa.o gmf_rng.o gmf_pof.o \
+ *       gmf_parse.o -o bench_cpp -lm
+ *   ./bench_cpp [n] [evaluations]
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <ctime>
+#include <vector>
+
+#include "gmf_rwa.hpp"
+
+extern "C"
+{
+#include "gmf_dv_rwa.h"
+#include "gmf_rng.h"
+}
+
+void (*gmf_test_problem)(double *F, double *G, double *xr, int *xi, int *xb);
+struct gmf_mop_desc gmf_mop;
+
+#define RUNS 5
+
+static double wall_time()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+/**
+ * Best nanoseconds per point of reps passes of body over the n points
+ */
+template <class Body>
+static double time_points(std::size_t n, std::size_t reps, Body body)
+{
+	double best = INFINITY, t;
+	std::size_t run, r;
+
+	for (run = 0; run < RUNS; ++run)
+	{
+		t = wall_time();
+		for (r = 0; r < reps; ++r)
+		{
+			body();
+		}
+		t = wall_time() - t;
+		best = t < best ? t : best;
+	}
+	return 1e9 * best / (n * reps);
+}
+
+/**
+ * Compares the constants of problem P with the registry entry of its index.
+ * Returns the number of differences.
+ */
+template <class P>
+static int check_problem(P problem)
+{
+	const struct gmf_rwa_entry *entry = gmf_rwa_registry(problem.function);
+	std::size_t i;
+	int errors = 0;
+
+	if (entry == NULL || entry->function != problem.function
+			|| problem.name != entry->name || problem.nreal != entry->nreal
+			|| problem.nobjs != entry->nobjs)
+	{
+		std::printf("%.*s: index, name or dimensions differ from the "
+				"registry\n", (int) problem.name.size(), problem.name.data());
+		return 1;
+	}
+	for (i = 0; i < problem.nreal; ++i)
+	{
+		errors += problem.xmin[i] != entry->xmin[i]
+				|| problem.xmax[i] != entry->xmax[i];
+	}
+	for (i = 0; i < problem.nobjs; ++i)
+	{
+		errors += problem.sense[i] != entry->sense[i];
+	}
+	if (errors > 0)
+	{
+		std::printf("%s: %d bounds or senses differ from the registry\n",
+				entry->name, errors);
+	}
+	return errors;
+}
+
+/**
+ * Every alternative of AnyProblem, reached by index and by name, against
+ * the registry. Returns the number of differences.
+ */
+static int check_registry()
+{
+	std::optional<gmf::AnyProblem> by_index, by_name;
+	int function, errors = 0;
+
+	for (function = 0; function < 10; ++function)
+	{
+		by_index = gmf::make_problem(function);
+		by_name = gmf::make_problem(gmf_rwa_name(function));
+		if (!by_index || !by_name || by_index->index() != (std::size_t) function
+				|| by_name->index() != (std::size_t) function)
+		{
+			std::printf("%s: make_problem gives another type\n",
+					gmf_rwa_name(function));
+			++errors;
+			continue;
+		}
+		errors += std::visit([](auto p) { return check_problem(p); },
+				*by_index);
+	}
+	errors += gmf::make_problem(10).has_value()
+			+ gmf::make_problem("Unknown").has_value();
+	std::printf("Problem types against the C registry: %s\n\n",
+			errors == 0 ? "ok" : "DIFFERENT");
+	return errors;
+}
+
+/**
+ * The loop of an optimizer compiled for one problem
+ */
+template <class P>
+static void point_loop(P problem, std::size_t n, const double *X, double *F)
+{
+	std::size_t i;
+
+	for (i = 0; i < n; ++i)
+	{
+		problem.evaluate(std::span<const double>(X + i * problem.nreal,
+				problem.nreal), std::span<double>(F + i * problem.nobjs,
+				problem.nobjs));
+	}
+	return;
+}
+
+static void bench_problem(int function, std::size_t n, std::size_t reps)
+{
+	gmf::AnyProblem any = *gmf::make_problem(function);
+	gmf_rwa_problem *problem = gmf_rwa_create(
+			const_cast<char *>(gmf_rwa_name(function)));
+	const std::size_t d = gmf::nreal(any), m = gmf::nobjs(any);
+	std::vector<double> X(n * d), F(n * m), G(n * m);
+	double c, visit, typed, batch, diff = 0.0;
+	std::size_t i;
+	gmf_rng rng;
+
+	gmf_rng_init(&rng, 5, 0);
+	gmf_rwa_rnd_solutions(&rng, gmf_rwa_desc(problem), n, X.data(), d);
+	gmf_rwa_set_kernels(gmf_kernels_generated);
+	gmf_rwa_evaluate(function, n, X.data(), d, G.data(), m, gmf_row_major);
+	std::visit([&](auto p) { point_loop(p, n, X.data(), F.data()); }, any);
+	for (i = 0; i < n * m; ++i)
+	{
+		diff = std::fmax(diff, std::fabs(F[i] - G[i]) / std::fmax(1.0,
+				std::fabs(G[i])));
+	}
+
+	c = time_points(n, reps, [&]
+	{
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			gmf_rwa_eval(problem, &F[i * m], &X[i * d]);
+		}
+	});
+	visit = time_points(n, reps, [&]
+	{
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			gmf::evaluate(any, std::span<const double>(&X[i * d], d),
+					std::span<double>(&F[i * m], m));
+		}
+	});
+	typed = time_points(n, reps, [&]
+	{
+		std::visit([&](auto p) { point_loop(p, n, X.data(), F.data()); },
+				any);
+	});
+	batch = time_points(n, reps, [&]
+	{
+		gmf_rwa_evaluate(function, n, X.data(), d, F.data(), m,
+				gmf_row_major);
+	});
+	gmf_rwa_set_kernels(gmf_kernels_reference);
+
+	std::printf("%-18s %8.2f %8.2f %8.2f %8.2f %9.1e\n",
+			gmf_rwa_name(function), c, visit, typed, batch, diff);
+	gmf_rwa_destroy(problem);
+	return;
+}
+
+int main(int argc, char **argv)
+{
+	std::size_t n = argc > 1 ? std::strtoul(argv[1], NULL, 10) : 1024;
+	std::size_t evaluations = argc > 2 ? std::strtoul(argv[2], NULL, 10)
+			: 4000000;
+	std::size_t reps = evaluations / n > 0 ? evaluations / n : 1;
+	int function;
+
+	if (check_registry() > 0)
+	{
+		return 1;
+	}
+	std::printf("%-18s %8s %8s %8s %8s %9s\n", "ns per point", "C handle",
+			"visit", "typed", "C batch", "max diff");
+	for (function = 0; function < 10; ++function)
+	{
+		bench_problem(function, n, reps);
+	}
+	return 0;
+}
@@ -0,0 +1,145 @@
+/*
+ * bench_float.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Single-precision evaluation (gmf_rwa_evaluate_typed with gmf_float32)
+ * against the double reference: time per point of column-major and
+ * row-major batches in both precisions, largest error of the float path
+ * relative to the magnitude of each objective, and the largest error over
+ * the bound of gmf_rwa_float_error (must stay below 1).
+ *
+ * With -t, prints instead the rwa_float_error table of gmf_dv_rwa.c:
+ * twice the largest absolute error of every objective over n points.
+ *
+ *   gcc -O2 -I.. bench_float.c ../gmf_dv_rwa.c ../gmf_rng.c ../gmf_pof.c \
+ *       ../gmf_parse.c -o bench_float -lm
+ *   ./bench_float [-t] [n]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "gmf_global.h"
+#include "gmf_dv_rwa.h"
+
+void (*gmf_test_problem)(double *F, double *G, double *xr, int *xi, int *xb);
+struct gmf_mop_desc gmf_mop;
+
+static double wall_time()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+/**
+ * Nanoseconds per point of one batch of the given type and order
+ */
+static double time_batch(int function, size_t n, const void *X, size_t ldx,
+		void *F, size_t ldf, int order, int type)
+{
+	double t = wall_time();
+	gmf_rwa_evaluate_typed(function, n, X, ldx, F, ldf, order, type);
+	return 1e9 * (wall_time() - t) / n;
+}
+
+static void bench_problem(int function, size_t n, int table)
+{
+	gmf_rwa_problem *problem = gmf_rwa_create((char*) gmf_rwa_name(function));
+	const struct gmf_mop_desc *mop = gmf_rwa_desc(problem);
+	size_t d = mop->nreal, m = mop->nobjs, i, j, k;
+	double *X = malloc(sizeof(double) * n * d);
+	double *XT = malloc(sizeof(double) * n * d);
+	double *F = calloc(n * m, sizeof(double));
+	double *FT = calloc(n * m, sizeof(double));
+	float *Y = malloc(sizeof(float) * n * d);
+	float *YT = malloc(sizeof(float) * n * d);
+	float *G = calloc(n * m, sizeof(float));
+	float *GT = calloc(n * m, sizeof(float));
+	double t[4], error, scale, worst = 0.0, over = 0.0;
+	gmf_rng rng;
+
+	/* the bounds are checked on other points than they were measured on */
+	gmf_rng_init(&rng, table ? 11 : 5, 0);
+	gmf_rwa_rnd_solutions(&rng, mop, n, X, d);
+	for (i = 0; i < n; ++i)
+	{
+		for (j = 0; j < d; ++j)
+		{
+			/* both precisions evaluate the same points */
+			Y[i * d + j] = (float) X[i * d + j];
+			X[i * d + j] = Y[i * d + j];
+			YT[j * n + i] = Y[i * d + j];
+			XT[j * n + i] = X[i * d + j];
+		}
+	}
+	t[0] = time_batch(function, n, XT, n, FT, n, gmf_col_major, gmf_float64);
+	t[1] = time_batch(function, n, YT, n, GT, n, gmf_col_major, gmf_float32);
+	t[2] = time_batch(function, n, X, d, F, m, gmf_row_major, gmf_float64);
+	t[3] = time_batch(function, n, Y, d, G, m, gmf_row_major, gmf_float32);
+
+	if (table)
+	{
+		printf("{ ");
+	}
+	for (k = 0; k < m; ++k)
+	{
+		error = 0.0;
+		scale = 0.0;
+		for (i = 0; i < n; ++i)
+		{
+			error = fmax(error, fabs(G[i * m + k] - F[i * m + k]));
+			error = fmax(error, fabs(GT[k * n + i] - F[i * m + k]));
+			scale = fmax(scale, fabs(F[i * m + k]));
+		}
+		worst = fmax(worst, error / scale);
+		over = fmax(over, error / gmf_rwa_float_error(function, k));
+		if (table)
+		{
+			printf("%.2g%s", 2.0 * error, k + 1 < m ? ", " : " }");
+		}
+	}
+	if (table)
+	{
+		printf(function < 9 ? ",\n" : " };\n");
+	}
+	else
+	{
+		printf("%-18s %8.2f %8.2f %6.2f %8.2f %8.2f %6.2f %9.1e %7.2f\n",
+				mop->name, t[0], t[1], t[0] / t[1], t[2], t[3], t[2] / t[3],
+				worst, over);
+	}
+	gmf_rwa_destroy(problem);
+	free(X);
+	free(XT);
+	free(F);
+	free(FT);
+	free(Y);
+	free(YT);
+	free(G);
+	free(GT);
+	return;
+}
+
+int main(int argc, char **argv)
+{
+	int table = argc > 1 && strcmp(argv[1], "-t") == 0;
+	size_t n = argc > 1 + table ? strtoul(argv[1 + table], NULL, 10) : 1000000;
+	int function;
+
+	if (!table)
+	{
+		printf("%-18s %24s %24s %9s %7s\n", "ns per point", "column-major",
+				"row-major", "max err", "err /");
+		printf("%-18s %8s %8s %6s %8s %8s %6s %9s %7s\n", "problem", "double",
+				"float", "ratio", "double", "float", "ratio", "/ scale",
+				"bound");
+	}
+	for (function = 0; function < 10; ++function)
+	{
+		bench_problem(function, n, table);
+	}
+	return 0;
+}
@@ -0,0 +1,184 @@
+/*
+ * bench_front.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Certified fronts of the small problems by gmf_poly_front, with eps_k =
+ * tol (worst_k - ideal_k) from the descriptors (tol 1e-2 by default),
+ * against uniform sampling. Prints the boxes bounded (against the
+ * 2^generations of a full bisection to the same depth), the centres
+ * evaluated, the size of the certified front and the time; then checks the
+ * certificate on random points (every f + eps must be covered by the front)
+ * and gives, for uniform samples of 1 and 10 times as many evaluations,
+ * their time and how far their front is from the certified one (the
+ * largest shortfall, in units of worst - ideal, of the best sampled point
+ * against a certified point).
+ *
+ *   gcc -O2 -I.. bench_front.c ../gmf_front.c ../gmf_extrema.c \
+ *       ../gmf_archive.c ../gmf_poly.c ../gmf_dv_rwa.c ../gmf_rng.c \
+ *       ../gmf_pof.c ../gmf_parse.c -o bench_front -lm
+ *   ./bench_front [tol] [problem...]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "gmf_global.h"
+#include "gmf_dv_rwa.h"
+#include "gmf_rng.h"
+#include "gmf_archive.h"
+#include "gmf_front.h"
+
+void (*gmf_test_problem)(double *F, double *G, double *xr, int *xi, int *xb);
+struct gmf_mop_desc gmf_mop;
+
+#define CHECKS 1000000
+#define CHUNK 4096
+
+static double wall_time()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+/**
+ * Largest shortfall of the front S (s points) against the front A (a
+ * points), scaled by range
+ */
+static double shortfall(const double *A, size_t a, const double *S, size_t s,
+		const double *range, size_t d)
+{
+	double worst = 0.0, best, gap;
+	size_t i, j, k;
+
+	for (i = 0; i < a; ++i)
+	{
+		best = INFINITY;
+		for (j = 0; j < s; ++j)
+		{
+			gap = -INFINITY;
+			for (k = 0; k < d; ++k)
+			{
+				gap = fmax(gap, (S[j * d + k] - A[i * d + k]) / range[k]);
+			}
+			best = fmin(best, gap);
+		}
+		worst = fmax(worst, best);
+	}
+	return worst;
+}
+
+/**
+ * Offers n uniform points to the archive, in chunks
+ */
+static void sample(int function, const struct gmf_mop_desc *mop,
+		gmf_rng *rng, gmf_archive *archive, size_t n, double *X, double *F)
+{
+	size_t i, m;
+
+	for (i = 0; i < n; i += m)
+	{
+		m = n - i < CHUNK ? n - i : CHUNK;
+		gmf_rwa_rnd_solutions(rng, mop, m, X, mop->nreal);
+		gmf_rwa_evaluate(function, m, X, mop->nreal, F, mop->nobjs,
+				gmf_row_major);
+		gmf_archive_insert_batch(archive, m, F, mop->nobjs, X, mop->nreal);
+	}
+	return;
+}
+
+static void bench_problem(char *name, double tol)
+{
+	gmf_rwa_problem *problem = gmf_rwa_create(name);
+	const struct gmf_mop_desc *mop = gmf_rwa_desc(problem);
+	int function = gmf_rwa_function(problem);
+	size_t d = mop->nreal, m = mop->nobjs, i, j, k, size, failed = 0, n;
+	size_t factor;
+	double *X = malloc(sizeof(double) * CHUNK * d);
+	double *F = malloc(sizeof(double) * CHUNK * m);
+	double eps[8], range[8], t, *A, *S;
+	struct gmf_front_stats stats;
+	gmf_archive *archive, *sampled;
+	gmf_rng rng;
+	int ok;
+
+	for (k = 0; k < m; ++k)
+	{
+		range[k] = mop->worst[k] - mop->ideal[k];
+		eps[k] = tol * range[k];
+	}
+	archive = gmf_archive_create(m, d, 0);
+	t = wall_time();
+	ok = gmf_poly_front(gmf_poly_get(function), archive, eps, 0, &stats);
+	t = wall_time() - t;
+	size = gmf_archive_size(archive);
+	printf("%-12s %d vars %d objs: %zu boxes of 2^%zu, %zu evaluations,"
+			" %zu points, %.3f s%s\n", name, (int) d, (int) m, stats.boxes,
+			stats.depth, stats.evaluations, size, t,
+			ok ? "" : " (not certified)");
+
+	/* the certificate on random points */
+	gmf_rng_init(&rng, 7, 0);
+	for (i = 0; i < CHECKS; i += n)
+	{
+		n = CHECKS - i < CHUNK ? CHECKS - i : CHUNK;
+		gmf_rwa_rnd_solutions(&rng, mop, n, X, d);
+		gmf_rwa_evaluate(function, n, X, d, F, m, gmf_row_major);
+		for (j = 0; j < n; ++j)
+		{
+			for (k = 0; k < m; ++k)
+			{
+				F[j * m + k] += eps[k];
+			}
+			failed += !gmf_archive_dominated(archive, F + j * m);
+		}
+	}
+	printf("  %d random points, %zu not covered\n", CHECKS, failed);
+
+	A = malloc(sizeof(double) * size * m);
+	gmf_archive_get(archive, A, m, NULL, 0);
+	for (factor = 1; factor <= 10; factor *= 10)
+	{
+		sampled = gmf_archive_create(m, d, 0);
+		gmf_rng_init(&rng, 11, 0);
+		t = wall_time();
+		sample(function, mop, &rng, sampled, factor * stats.evaluations, X, F);
+		t = wall_time() - t;
+		n = gmf_archive_size(sampled);
+		S = malloc(sizeof(double) * n * m);
+		gmf_archive_get(sampled, S, m, NULL, 0);
+		printf("  sampling %3zux: %zu points, %.3f s, shortfall %.2e\n",
+				factor, n, t, shortfall(A, size, S, n, range, m));
+		free(S);
+		gmf_archive_destroy(sampled);
+	}
+	free(A);
+	gmf_archive_destroy(archive);
+	gmf_rwa_destroy(problem);
+	free(X);
+	free(F);
+	return;
+}
+
+int main(int argc, char **argv)
+{
+	char *small[] = { "Goel2007", "Liao2008", "Ganesan2013", "Xu2020" };
+	double tol = argc > 1 ? atof(argv[1]) : 1e-2;
+	int i;
+
+	if (argc > 2)
+	{
+		for (i = 2; i < argc; ++i)
+		{
+			bench_problem(argv[i], tol);
+		}
+		return 0;
+	}
+	for (i = 0; i < 4; ++i)
+	{
+		bench_problem(small[i], tol);
+	}
+	return 0;
+}
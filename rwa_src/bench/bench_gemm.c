@@ -0,0 +1,158 @@
+/*
+ * bench_gemm.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Blocked evaluation (gmf_poly_plan_evaluate, monomial matrix times
+ * coefficients) against the hand-written and the generated kernels of
+ * gmf_rwa_evaluate: best time per point over a few runs of a batch of n
+ * points evaluated repeatedly (in cache by default), for row-major and
+ * column-major storage, the rate of the blocked engine in GFLOP/s (its
+ * flops per point, gmf_poly_plan_flops) and its largest difference from
+ * gmf_poly_evaluate relative to the magnitude of each objective.
+ *
+ *   gcc -O2 -I.. bench_gemm.c ../gmf_poly.c ../gmf_dv_rwa.c ../gmf_rng.c \
+ *       ../gmf_pof.c ../gmf_parse.c -o bench_gemm -lm
+ *   ./bench_gemm [n] [evaluations]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "gmf_global.h"
+#include "gmf_dv_rwa.h"
+#include "gmf_poly.h"
+
+void (*gmf_test_problem)(double *F, double *G, double *xr, int *xi, int *xb);
+struct gmf_mop_desc gmf_mop;
+
+#define RUNS 5
+
+static double wall_time()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+/**
+ * Best nanoseconds per point of `reps` evaluations of the batch, with the
+ * kernels of gmf_rwa_evaluate (plan NULL) or the blocked engine
+ */
+static double time_batch(int function, const gmf_poly_plan *plan, size_t n,
+		size_t reps, const double *X, size_t ldx, double *F, size_t ldf,
+		int order)
+{
+	double best = INFINITY, t;
+	size_t run, r;
+
+	for (run = 0; run < RUNS; ++run)
+	{
+		t = wall_time();
+		for (r = 0; r < reps; ++r)
+		{
+			if (plan == NULL)
+			{
+				gmf_rwa_evaluate(function, n, X, ldx, F, ldf, order);
+			}
+			else
+			{
+				gmf_poly_plan_evaluate(plan, n, X, ldx, F, ldf, order);
+			}
+		}
+		t = wall_time() - t;
+		best = t < best ? t : best;
+	}
+	return 1e9 * best / (n * reps);
+}
+
+static double scaled_diff(const double *A, const double *B, size_t n,
+		size_t m)
+{
+	size_t i, k;
+	double scale, diff, worst = 0.0;
+
+	for (k = 0; k < m; ++k)
+	{
+		scale = 0.0;
+		diff = 0.0;
+		for (i = 0; i < n; ++i)
+		{
+			scale = fmax(scale, fabs(A[i * m + k]));
+			diff = fmax(diff, fabs(A[i * m + k] - B[i * m + k]));
+		}
+		if (scale > 0.0)
+		{
+			worst = fmax(worst, diff / scale);
+		}
+	}
+	return worst;
+}
+
+static void bench_problem(int function, size_t n, size_t reps)
+{
+	const struct gmf_poly *poly = gmf_poly_get(function);
+	gmf_rwa_problem *problem = gmf_rwa_create((char*) poly->name);
+	const struct gmf_mop_desc *mop = gmf_rwa_desc(problem);
+	gmf_poly_plan *plan = gmf_poly_plan_create(poly, gmf_simd_avx512);
+	size_t d = mop->nreal, m = mop->nobjs, i, j;
+	double *X = malloc(sizeof(double) * n * d);
+	double *XT = malloc(sizeof(double) * n * d);
+	double *F = calloc(n * m, sizeof(double));
+	double *G = calloc(n * m, sizeof(double));
+	double row[3], col[3];
+	gmf_rng rng;
+
+	gmf_rng_init(&rng, 5, 0);
+	gmf_rwa_rnd_solutions(&rng, mop, n, X, d);
+	for (i = 0; i < n; ++i)
+	{
+		for (j = 0; j < d; ++j)
+		{
+			XT[j * n + i] = X[i * d + j];
+		}
+	}
+	gmf_rwa_set_kernels(gmf_kernels_reference);
+	row[0] = time_batch(function, NULL, n, reps, X, d, F, m, gmf_row_major);
+	col[0] = time_batch(function, NULL, n, reps, XT, n, F, n, gmf_col_major);
+	gmf_rwa_set_kernels(gmf_kernels_generated);
+	row[1] = time_batch(function, NULL, n, reps, X, d, F, m, gmf_row_major);
+	col[1] = time_batch(function, NULL, n, reps, XT, n, F, n, gmf_col_major);
+	gmf_rwa_set_kernels(gmf_kernels_reference);
+	row[2] = time_batch(function, plan, n, reps, X, d, F, m, gmf_row_major);
+	col[2] = time_batch(function, plan, n, reps, XT, n, F, n, gmf_col_major);
+
+	gmf_poly_evaluate(poly, n, X, d, G, m);
+	gmf_poly_plan_evaluate(plan, n, X, d, F, m, gmf_row_major);
+	printf("%-18s %7.2f %7.2f %7.2f %7.2f %7.2f %7.2f %5zu %7.1f %9.1e\n",
+			poly->name, row[0], row[1], row[2], col[0], col[1], col[2],
+			gmf_poly_plan_flops(plan), gmf_poly_plan_flops(plan) / col[2],
+			scaled_diff(G, F, n, m));
+	gmf_poly_plan_destroy(plan);
+	gmf_rwa_destroy(problem);
+	free(X);
+	free(XT);
+	free(F);
+	free(G);
+	return;
+}
+
+int main(int argc, char **argv)
+{
+	size_t n = argc > 1 ? strtoul(argv[1], NULL, 10) : 4096;
+	size_t evaluations = argc > 2 ? strtoul(argv[2], NULL, 10) : 4000000;
+	size_t reps = evaluations / n > 0 ? evaluations / n : 1;
+	int function;
+
+	printf("%-18s %23s %23s %5s %7s %9s\n", "ns per point", "row-major",
+			"column-major", "", "blocked", "");
+	printf("%-18s %7s %7s %7s %7s %7s %7s %5s %7s %9s\n", "problem", "hand",
+			"gen", "blocked", "hand", "gen", "blocked", "flops", "GFLOP/s",
+			"max diff");
+	for (function = 0; function < 10; ++function)
+	{
+		bench_problem(function, n, reps);
+	}
+	return 0;
+}
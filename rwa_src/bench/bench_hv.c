@@ -0,0 +1,75 @@
+/*
+ * bench_hv.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Time of the exact hypervolume of the first npoints points of every
+ * reference set, serial and on a pool, with the reference point taken from
+ * the set itself (nadir plus 10% of the range). Run from this directory or
+ * set GMF_POF_DIR.
+ *
+ *   gcc -O2 -I.. bench_hv.c ../gmf_hv.c ../gmf_pof.c ../gmf_parse.c \
+ *       ../gmf_parallel.c ../gmf_dv_rwa.c ../gmf_rng.c -o bench_hv -lm -lpthread
+ *   ./bench_hv [npoints] [threads]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "gmf_global.h"
+#include "gmf_dv_rwa.h"
+#include "gmf_parallel.h"
+#include "gmf_hv.h"
+
+void (*gmf_test_problem)(double *F, double *G, double *xr, int *xi, int *xb);
+struct gmf_mop_desc gmf_mop;
+
+static double wall_time()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+int main(int argc, char **argv)
+{
+	static char *names[] =
+	{ "Subasi2016", "Gao2020", "Vaidyanathan2004", "Chen2015", "Ahmad2017" };
+	size_t npoints = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000, n;
+	gmf_pool *pool = gmf_pool_create(argc > 2 ? atoi(argv[2]) : 0);
+	double ref[GMF_HV_MAXOBJS], hv, hv_pool, t, t_pool;
+	gmf_rwa_problem *problem;
+	gmf_pof_view view;
+	size_t i;
+
+	gmf_rwa_set_pof_dir("../../POF");
+	printf("%-18s %5s %6s %14s %10s %10s\n", "problem", "objs", "points",
+			"hypervolume", "serial s", "pool s");
+	for (i = 0; i < sizeof(names) / sizeof(names[0]); ++i)
+	{
+		problem = gmf_rwa_create(names[i]);
+		if (!gmf_pof_open_mop(gmf_rwa_desc(problem), &view))
+		{
+			fprintf(stderr, "%s: no reference set\n", names[i]);
+			gmf_rwa_destroy(problem);
+			continue;
+		}
+		gmf_hv_reference(&view, 0.1, ref);
+		n = view.npoints < npoints ? view.npoints : npoints;
+
+		t = wall_time();
+		hv = gmf_hv(n, view.nobjs, view.column[0], view.npoints,
+				gmf_col_major, ref);
+		t = wall_time() - t;
+		t_pool = wall_time();
+		hv_pool = gmf_hv_parallel(pool, n, view.nobjs, view.column[0],
+				view.npoints, gmf_col_major, ref);
+		t_pool = wall_time() - t_pool;
+
+		printf("%-18s %5zu %6zu %14.6e %10.3f %10.3f%s\n", names[i], view.nobjs,
+				n, hv, t, t_pool, hv == hv_pool ? "" : "  MISMATCH");
+		gmf_pof_close(&view);
+		gmf_rwa_destroy(problem);
+	}
+	gmf_pool_destroy(pool);
+	return 0;
+}
@@ -0,0 +1,161 @@
+/*
+ * bench_indicators.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * IGD, IGD+, GD and GD+ of Ahmad2017 (7000 reference points, 7 objectives)
+ * through the k-d trees against the brute-force double loop, for
+ * populations of reference points moved by up to 2% of the objective
+ * ranges. Run from this directory or set GMF_POF_DIR.
+ *
+ *   gcc -O2 -I.. bench_indicators.c ../gmf_indicators.c ../gmf_pof.c \
+ *       ../gmf_parse.c ../gmf_parallel.c ../gmf_dv_rwa.c ../gmf_rng.c \
+ *       -o bench_indicators -lm -lpthread
+ *   ./bench_indicators [threads]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "gmf_global.h"
+#include "gmf_dv_rwa.h"
+#include "gmf_indicators.h"
+
+void (*gmf_test_problem)(double *F, double *G, double *xr, int *xi, int *xb);
+struct gmf_mop_desc gmf_mop;
+
+static double wall_time()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+/**
+ * Mean over the points of A of the distance to the nearest point of B, both
+ * row-major (igd_plus: A holds the reference points, gd_plus: B does)
+ */
+static double brute_mean(size_t na, const double *A, size_t nb,
+		const double *B, size_t d, int distance, const double *scale)
+{
+	double sum = 0.0, best, value, t;
+	size_t i, j, k;
+	for (i = 0; i < na; ++i)
+	{
+		best = HUGE_VAL;
+		for (j = 0; j < nb; ++j)
+		{
+			for (k = 0, value = 0.0; k < d; ++k)
+			{
+				t = distance == gmf_distance_gd_plus ? A[i * d + k] - B[j * d + k] :
+						B[j * d + k] - A[i * d + k];
+				if (distance != gmf_distance_euclidean && t < 0.0)
+				{
+					t = 0.0;
+				}
+				t *= scale[k];
+				value += t * t;
+			}
+			best = value < best ? value : best;
+		}
+		sum += sqrt(best);
+	}
+	return sum / na;
+}
+
+int main(int argc, char **argv)
+{
+	static const char *labels[] =
+	{ "IGD", "IGD+", "GD", "GD+" };
+	static const size_t sizes[] =
+	{ 100, 500, 2000 };
+	gmf_pool *pool = gmf_pool_create(argc > 1 ? atoi(argv[1]) : 0);
+	gmf_rwa_problem *problem;
+	gmf_indicator indicator;
+	const gmf_kdtree *reference;
+	double *R, *P, tree, brute, t_tree, t_brute, t_open;
+	size_t d, nref, n, s, i, k, m;
+	gmf_rng rng;
+
+	gmf_rwa_set_pof_dir("../../POF");
+	problem = gmf_rwa_create("Ahmad2017");
+	t_open = wall_time();
+	if (!gmf_indicator_open_mop(&indicator, gmf_rwa_desc(problem), 1))
+	{
+		fprintf(stderr, "Ahmad2017: no reference set\n");
+		return 1;
+	}
+	t_open = wall_time() - t_open;
+	reference = &indicator.reference;
+	d = reference->nobjs;
+	nref = reference->npoints;
+	R = malloc(sizeof(double) * nref * d);
+	for (i = 0; i < nref; ++i)
+	{
+		for (k = 0; k < d; ++k)
+		{
+			R[reference->index[i] * d + k] = reference->points[i * d + k];
+		}
+	}
+	printf("Ahmad2017: %zu points, %zu objs, index opened in %.3f s\n", nref,
+			d, t_open);
+	printf("%6s %5s %12s %10s %10s %9s %10s\n", "points", "", "value",
+			"tree ms", "brute ms", "speedup", "rel. diff");
+
+	gmf_rng_init(&rng, 2026, 0);
+	for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+	{
+		n = sizes[s];
+		P = malloc(sizeof(double) * n * d);
+		for (i = 0; i < n; ++i)
+		{
+			m = gmf_rng_index(&rng, nref);
+			for (k = 0; k < d; ++k)
+			{
+				P[i * d + k] = R[m * d + k] + 0.02 * (gmf_rng_uniform(&rng) - 0.5)
+						/ indicator.scale[k];
+			}
+		}
+		for (m = 0; m < 4; ++m)
+		{
+			t_tree = wall_time();
+			switch (m)
+			{
+			case 0:
+				tree = gmf_indicator_igd(&indicator, pool, n, P, d, gmf_row_major);
+				break;
+			case 1:
+				tree = gmf_indicator_igd_plus(&indicator, pool, n, P, d,
+						gmf_row_major);
+				break;
+			case 2:
+				tree = gmf_indicator_gd(&indicator, pool, n, P, d, gmf_row_major);
+				break;
+			default:
+				tree = gmf_indicator_gd_plus(&indicator, pool, n, P, d,
+						gmf_row_major);
+				break;
+			}
+			t_tree = wall_time() - t_tree;
+			t_brute = wall_time();
+			brute = m < 2 ?
+					brute_mean(nref, R, n, P, d,
+							m == 0 ? gmf_distance_euclidean : gmf_distance_igd_plus,
+							indicator.scale) :
+					brute_mean(n, P, nref, R, d,
+							m == 2 ? gmf_distance_euclidean : gmf_distance_gd_plus,
+							indicator.scale);
+			t_brute = wall_time() - t_brute;
+			printf("%6zu %5s %12.6e %10.2f %10.2f %9.1f %10.1e\n", n, labels[m],
+					tree, t_tree * 1e3, t_brute * 1e3, t_brute / t_tree,
+					fabs(tree - brute) / brute);
+		}
+		free(P);
+	}
+
+	gmf_indicator_close(&indicator);
+	gmf_rwa_destroy(problem);
+	gmf_pool_destroy(pool);
+	free(R);
+	return 0;
+}
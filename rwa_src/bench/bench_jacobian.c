@@ -0,0 +1,149 @@
+/*
+ * bench_jacobian.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Analytic Jacobians of every problem against forward differences, which
+ * cost nreal + 1 evaluations per point: time per point and largest
+ * relative difference between both (central differences with a step large
+ * enough to keep roundoff out).
+ *
+ *   gcc -O2 -I.. bench_jacobian.c ../gmf_dv_rwa.c ../gmf_rng.c \
+ *       -o bench_jacobian -lm
+ *   ./bench_jacobian [n]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "gmf_global.h"
+#include "gmf_dv_rwa.h"
+
+void (*gmf_test_problem)(double *F, double *G, double *xr, int *xi, int *xb);
+struct gmf_mop_desc gmf_mop;
+
+static double wall_time()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+/**
+ * Forward-difference Jacobians of the rows of X (what a solver without
+ * derivatives does): one batch at X and one per perturbed variable, Xh
+ * being a copy of X
+ */
+static void forward_jacobian(gmf_rwa_problem *problem, size_t n,
+		const double *X, double *Xh, double *F, double *Fh, double *J)
+{
+	const struct gmf_mop_desc *mop = gmf_rwa_desc(problem);
+	size_t d = mop->nreal, m = mop->nobjs, i, j, k;
+	double h;
+
+	gmf_rwa_eval_batch(problem, n, X, d, F, m, gmf_row_major);
+	for (j = 0; j < d; ++j)
+	{
+		for (i = 0; i < n; ++i)
+		{
+			Xh[i * d + j] = X[i * d + j] + 1e-7 * (fabs(X[i * d + j]) + 1.0);
+		}
+		gmf_rwa_eval_batch(problem, n, Xh, d, Fh, m, gmf_row_major);
+		for (i = 0; i < n; ++i)
+		{
+			h = Xh[i * d + j] - X[i * d + j];
+			Xh[i * d + j] = X[i * d + j];
+			for (k = 0; k < m; ++k)
+			{
+				J[i * m * d + k * d + j] = (Fh[i * m + k] - F[i * m + k]) / h;
+			}
+		}
+	}
+	return;
+}
+
+static double central_check(gmf_rwa_problem *problem, size_t n,
+		const double *X, const double *J)
+{
+	const struct gmf_mop_desc *mop = gmf_rwa_desc(problem);
+	size_t d = mop->nreal, m = mop->nobjs, i, j, k;
+	double x[16], fp[8], fm[8], h, xj, fd, worst = 0.0, err;
+
+	for (i = 0; i < n; ++i)
+	{
+		memcpy(x, X + i * d, sizeof(double) * d);
+		for (j = 0; j < d; ++j)
+		{
+			xj = x[j];
+			h = 1e-3 * (fabs(xj) + 1.0);
+			x[j] = xj + h;
+			gmf_rwa_eval(problem, fp, x);
+			x[j] = xj - h;
+			gmf_rwa_eval(problem, fm, x);
+			x[j] = xj;
+			for (k = 0; k < m; ++k)
+			{
+				fd = (fp[k] - fm[k]) / (2.0 * h);
+				err = fabs(fd - J[i * m * d + k * d + j])
+						/ (fabs(fd) + fabs(J[i * m * d + k * d + j]) + 1e-12);
+				worst = err > worst ? err : worst;
+			}
+		}
+	}
+	return worst;
+}
+
+static void bench_problem(char *name, size_t n)
+{
+	gmf_rwa_problem *problem = gmf_rwa_create(name);
+	const struct gmf_mop_desc *mop = gmf_rwa_desc(problem);
+	size_t d = mop->nreal, m = mop->nobjs, evals;
+	double *X = malloc(sizeof(double) * n * d);
+	double *Xh = malloc(sizeof(double) * n * d);
+	double *F = malloc(sizeof(double) * n * m);
+	double *Fh = malloc(sizeof(double) * n * m);
+	double *J = malloc(sizeof(double) * n * m * d);
+	double t_analytic, t_forward, worst;
+	gmf_rng rng;
+
+	gmf_rng_init(&rng, 5, 0);
+	gmf_rwa_rnd_solutions(&rng, mop, n, X, d);
+	memcpy(Xh, X, sizeof(double) * n * d);
+
+	t_forward = wall_time();
+	forward_jacobian(problem, n, X, Xh, F, Fh, J);
+	t_forward = wall_time() - t_forward;
+	evals = gmf_rwa_evaluations(problem);
+
+	t_analytic = wall_time();
+	gmf_rwa_eval_jacobian_batch(problem, n, X, d, F, m, J, m * d);
+	t_analytic = wall_time() - t_analytic;
+
+	worst = central_check(problem, n < 10000 ? n : 10000, X, J);
+	printf("%-18s %4zu %4zu %12.1f %12.1f %10.2f %10.1f %10.2e\n", name, m, d,
+			1e9 * t_analytic / n, 1e9 * t_forward / n, t_forward / t_analytic,
+			(double) evals / n, worst);
+	gmf_rwa_destroy(problem);
+	free(X);
+	free(Xh);
+	free(F);
+	free(Fh);
+	free(J);
+	return;
+}
+
+int main(int argc, char **argv)
+{
+	size_t n = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000000;
+	int function;
+
+	printf("%-18s %4s %4s %12s %12s %10s %10s %10s\n", "problem", "objs",
+			"vars", "analytic ns", "forward ns", "speed-up", "fd evals",
+			"max diff");
+	for (function = 0; function < 10; ++function)
+	{
+		bench_problem((char*) gmf_rwa_name(function), n);
+	}
+	return 0;
+}
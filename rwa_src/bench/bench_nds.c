@@ -0,0 +1,187 @@
+/*
+ * bench_nds.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Non-dominated sorting of random populations of Subasi2016 (2 objectives),
+ * Gao2020 (3), Chen2015 (5) and Ahmad2017 (7) with N = 10^3 .. max_n,
+ * timed against the evaluation itself. Up to N = 10^4 the ranks are checked
+ * against Deb's O(MN^2) fast non-dominated sort, which is timed too.
+ *
+ *   gcc -O2 -I.. bench_nds.c ../gmf_nds.c ../gmf_dv_rwa.c ../gmf_rng.c \
+ *       -o bench_nds -lm
+ *   ./bench_nds [max_n]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "gmf_global.h"
+#include "gmf_dv_rwa.h"
+#include "gmf_nds.h"
+
+void (*gmf_test_problem)(double *F, double *G, double *xr, int *xi, int *xb);
+struct gmf_mop_desc gmf_mop;
+
+static double wall_time()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static int dominates(const double *a, const double *b, size_t d)
+{
+	int better = 0;
+	size_t k;
+	for (k = 0; k < d; ++k)
+	{
+		if (a[k] > b[k])
+		{
+			return 0;
+		}
+		better |= a[k] < b[k];
+	}
+	return better;
+}
+
+/**
+ * Deb et al. (2002) fast non-dominated sort
+ */
+static void deb_rank(size_t n, size_t d, const double *F, size_t *rank)
+{
+	size_t *count = calloc(n, sizeof(size_t)), **dominated = malloc(
+			sizeof(size_t*) * n), *ndominated = calloc(n, sizeof(size_t));
+	size_t *front = malloc(sizeof(size_t) * n), *next = malloc(
+			sizeof(size_t) * n), *swap, i, j, k, size = 0, nnext, level = 0;
+
+	for (i = 0; i < n; ++i)
+	{
+		dominated[i] = malloc(sizeof(size_t) * n);
+	}
+	for (i = 0; i < n; ++i)
+	{
+		for (j = 0; j < n; ++j)
+		{
+			if (dominates(F + i * d, F + j * d, d))
+			{
+				dominated[i][ndominated[i]++] = j;
+			}
+			else if (dominates(F + j * d, F + i * d, d))
+			{
+				count[i]++;
+			}
+		}
+		if (count[i] == 0)
+		{
+			rank[i] = 0;
+			front[size++] = i;
+		}
+	}
+	while (size > 0)
+	{
+		nnext = 0;
+		++level;
+		for (i = 0; i < size; ++i)
+		{
+			for (k = 0; k < ndominated[front[i]]; ++k)
+			{
+				j = dominated[front[i]][k];
+				if (--count[j] == 0)
+				{
+					rank[j] = level;
+					next[nnext++] = j;
+				}
+			}
+		}
+		swap = front;
+		front = next;
+		next = swap;
+		size = nnext;
+	}
+	for (i = 0; i < n; ++i)
+	{
+		free(dominated[i]);
+	}
+	free(dominated);
+	free(ndominated);
+	free(count);
+	free(front);
+	free(next);
+	return;
+}
+
+static void bench_problem(char *name, size_t max_n)
+{
+	gmf_rwa_problem *problem = gmf_rwa_create(name);
+	const struct gmf_mop_desc *mop = gmf_rwa_desc(problem);
+	size_t nreal = mop->nreal, nobjs = mop->nobjs, n, i, nfronts, size;
+	size_t *rank, *check, *front;
+	double *X, *F, t_eval, t_rank, t_front, t_deb;
+	char same[8];
+	gmf_rng rng;
+
+	printf("%s (%zu objs)\n", name, nobjs);
+	printf("%8s %8s %8s %10s %10s %10s %10s %6s\n", "N", "fronts", "first",
+			"eval ms", "rank ms", "front ms", "Deb ms", "same");
+	gmf_rng_init(&rng, 11, 0);
+	for (n = 1000; n <= max_n; n *= 10)
+	{
+		X = malloc(sizeof(double) * n * nreal);
+		F = malloc(sizeof(double) * n * nobjs);
+		rank = malloc(sizeof(size_t) * n);
+		front = malloc(sizeof(size_t) * n);
+		gmf_rwa_rnd_solutions(&rng, mop, n, X, nreal);
+
+		t_eval = wall_time();
+		gmf_rwa_eval_batch(problem, n, X, nreal, F, nobjs, gmf_row_major);
+		t_eval = wall_time() - t_eval;
+		t_rank = wall_time();
+		gmf_nds_rank(n, nobjs, F, nobjs, gmf_row_major, rank, &nfronts);
+		t_rank = wall_time() - t_rank;
+		t_front = wall_time();
+		gmf_nds_front(n, nobjs, F, nobjs, gmf_row_major, front, &size);
+		t_front = wall_time() - t_front;
+
+		t_deb = 0.0;
+		strcpy(same, "-");
+		if (n <= 10000)
+		{
+			check = malloc(sizeof(size_t) * n);
+			t_deb = wall_time();
+			deb_rank(n, nobjs, F, check);
+			t_deb = wall_time() - t_deb;
+			strcpy(same, memcmp(rank, check, sizeof(size_t) * n) == 0 ?
+					"yes" : "NO");
+			for (i = 0; i < size; ++i)
+			{
+				if (check[front[i]] != 0)
+				{
+					strcpy(same, "NO");
+				}
+			}
+			free(check);
+		}
+		printf("%8zu %8zu %8zu %10.2f %10.2f %10.2f %10.2f %6s\n", n, nfronts,
+				size, t_eval * 1e3, t_rank * 1e3, t_front * 1e3, t_deb * 1e3,
+				same);
+		free(X);
+		free(F);
+		free(rank);
+		free(front);
+	}
+	printf("\n");
+	gmf_rwa_destroy(problem);
+	return;
+}
+
+int main(int argc, char **argv)
+{
+	size_t max_n = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000000;
+
+	bench_problem("Subasi2016", max_n);
+	bench_problem("Gao2020", max_n);
+	bench_problem("Chen2015", max_n);
+	bench_problem("Ahmad2017", max_n);
+	return 0;
+}
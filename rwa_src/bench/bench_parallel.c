@@ -0,0 +1,94 @@
+/*
+ * bench_parallel.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Scaling of the parallel batch evaluator from 1 to N threads.
+ *
+ *   gcc -O2 -I.. bench_parallel.c ../gmf_dv_rwa.c ../gmf_parallel.c ../gmf_rng.c \
+ *       -o bench_parallel -lm -lpthread
+ *   ./bench_parallel [npoints] [max_threads]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "gmf_global.h"
+#include "gmf_dv_rwa.h"
+#include "gmf_parallel.h"
+
+void (*gmf_test_problem)(double *F, double *G, double *xr, int *xi, int *xb);
+struct gmf_mop_desc gmf_mop;
+
+static double wall_time()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static void bench_problem(char *name, size_t n, int max_threads)
+{
+	gmf_rwa_problem *problem = gmf_rwa_create(name);
+	const struct gmf_mop_desc *mop = gmf_rwa_desc(problem);
+	size_t nreal = mop->nreal, nobjs = mop->nobjs, i, j;
+	double *X = malloc(sizeof(double) * n * nreal);
+	double *F = malloc(sizeof(double) * n * nobjs);
+	double *F1 = malloc(sizeof(double) * n * nobjs);
+	double t, t1 = 0.0;
+	gmf_pool *pool;
+	int threads, rep;
+
+	/* deterministic grid-like points, independent of the RNG */
+	for (i = 0; i < n; ++i)
+	{
+		for (j = 0; j < nreal; ++j)
+		{
+			X[i * nreal + j] = mop->xmin_real[j]
+					+ (mop->xmax_real[j] - mop->xmin_real[j])
+							* (double) ((i * (2 * j + 3) + j) % 1021) / 1020.0;
+		}
+	}
+
+	printf("%s (%zu vars, %zu objs, %zu points)\n", name, nreal, nobjs, n);
+	printf("%8s %12s %10s %8s\n", "threads", "Mpoints/s", "speedup", "same");
+	for (threads = 1; threads <= max_threads; threads = threads < max_threads
+			&& threads * 2 > max_threads ? max_threads : threads * 2)
+	{
+		pool = gmf_pool_create(threads);
+		t = 1e30;
+		for (rep = 0; rep < 3; ++rep)
+		{
+			double t0 = wall_time();
+			gmf_rwa_parallel_evaluate(pool, problem, n, X, nreal, F, nobjs,
+					gmf_row_major);
+			t0 = wall_time() - t0;
+			t = t0 < t ? t0 : t;
+		}
+		if (threads == 1)
+		{
+			t1 = t;
+			memcpy(F1, F, sizeof(double) * n * nobjs);
+		}
+		printf("%8d %12.1f %10.2f %8s\n", threads, n / t * 1e-6, t1 / t,
+				memcmp(F, F1, sizeof(double) * n * nobjs) == 0 ? "yes" : "NO");
+		gmf_pool_destroy(pool);
+	}
+	printf("\n");
+
+	gmf_rwa_destroy(problem);
+	free(X);
+	free(F);
+	free(F1);
+	return;
+}
+
+int main(int argc, char **argv)
+{
+	size_t n = argc > 1 ? (size_t) atol(argv[1]) : 1 << 22;
+	int max_threads = argc > 2 ? atoi(argv[2]) : gmf_cpu_count();
+
+	bench_problem("Gao2020", n, max_threads);
+	bench_problem("Ahmad2017", n, max_threads);
+	return 0;
+}
@@ -0,0 +1,110 @@
+/*
+ * bench_parse.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Throughput of the streaming text parser against fscanf("%lf") on a run
+ * archive made of `copies` concatenated copies of a POF file.
+ *
+ *   gcc -O2 -I.. bench_parse.c ../gmf_parse.c -o bench_parse
+ *   ./bench_parse [file.pof] [copies]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "gmf_parse.h"
+
+static double wall_time()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+int main(int argc, char **argv)
+{
+	const char *src = argc > 1 ? argv[1] : "../../POF/Ahmad2017-7objs.pof";
+	int copies = argc > 2 ? atoi(argv[2]) : 100;
+	char archive[] = "/tmp/bench_parse_XXXXXX", chunk[1 << 16];
+	FILE *in, *out;
+	size_t got, n, ncols, capacity, i, mismatches = 0, bytes = 0;
+	double *A, *B, t_scanf, t_gmf, value;
+	gmf_parser parser;
+	int c, fd;
+
+	/* build the archive */
+	fd = mkstemp(archive);
+	out = fd >= 0 ? fdopen(fd, "w") : NULL;
+	if (out == NULL)
+	{
+		fprintf(stderr, "cannot create %s\n", archive);
+		return 1;
+	}
+	for (c = 0; c < copies; ++c)
+	{
+		in = fopen(src, "r");
+		if (in == NULL)
+		{
+			fprintf(stderr, "cannot open %s\n", src);
+			fclose(out);
+			remove(archive);
+			return 1;
+		}
+		while ((got = fread(chunk, 1, sizeof(chunk), in)) > 0)
+		{
+			fwrite(chunk, 1, got, out);
+			bytes += got;
+		}
+		fclose(in);
+	}
+	fclose(out);
+
+	/* gmf_parser */
+	t_gmf = wall_time();
+	if (!gmf_parser_open(&parser, archive, 0))
+	{
+		fprintf(stderr, "cannot parse %s\n", archive);
+		remove(archive);
+		return 1;
+	}
+	ncols = parser.ncols;
+	capacity = 1024;
+	A = malloc(sizeof(double) * ncols * capacity);
+	n = 0;
+	while ((got = gmf_parser_read(&parser, capacity - n, A + n * ncols, ncols))
+			== capacity - n)
+	{
+		n += got;
+		capacity *= 2;
+		A = realloc(A, sizeof(double) * ncols * capacity);
+	}
+	n += got;
+	gmf_parser_close(&parser);
+	t_gmf = wall_time() - t_gmf;
+
+	/* fscanf */
+	t_scanf = wall_time();
+	in = fopen(archive, "r");
+	B = malloc(sizeof(double) * ncols * n);
+	for (i = 0; i < ncols * n && fscanf(in, "%lf", &value) == 1; ++i)
+	{
+		B[i] = value;
+	}
+	fclose(in);
+	t_scanf = wall_time() - t_scanf;
+
+	for (i = 0; i < ncols * n; ++i)
+	{
+		mismatches += memcmp(&A[i], &B[i], sizeof(double)) != 0;
+	}
+	printf("%zu points x %zu columns, %.1f MB\n", n, ncols, bytes * 1e-6);
+	printf("fscanf     %8.1f MB/s\n", bytes * 1e-6 / t_scanf);
+	printf("gmf_parser %8.1f MB/s (%.1fx), %zu mismatches\n",
+			bytes * 1e-6 / t_gmf, t_scanf / t_gmf, mismatches);
+
+	free(A);
+	free(B);
+	remove(archive);
+	return mismatches != 0;
+}
@@ -0,0 +1,143 @@
+/*
+ * bench_poly.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Hand-written kernels against the ones generated from the monomial tables
+ * (gmf_rwa_set_kernels): time per point of row-major batches, column-major
+ * (SIMD) batches and Jacobian batches, and largest difference between both
+ * relative to the magnitude of each objective.
+ *
+ *   gcc -O2 -I.. bench_poly.c ../gmf_dv_rwa.c ../gmf_rng.c ../gmf_pof.c \
+ *       ../gmf_parse.c -o bench_poly -lm
+ *   ./bench_poly [n]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "gmf_global.h"
+#include "gmf_dv_rwa.h"
+
+void (*gmf_test_problem)(double *F, double *G, double *xr, int *xi, int *xb);
+struct gmf_mop_desc gmf_mop;
+
+static double wall_time()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+/**
+ * Largest |A - B| over the largest |A| of each of the m columns
+ */
+static double scaled_diff(const double *A, const double *B, size_t n,
+		size_t m)
+{
+	size_t i, k;
+	double scale, diff, worst = 0.0;
+
+	for (k = 0; k < m; ++k)
+	{
+		scale = 0.0;
+		diff = 0.0;
+		for (i = 0; i < n; ++i)
+		{
+			scale = fmax(scale, fabs(A[i * m + k]));
+			diff = fmax(diff, fabs(A[i * m + k] - B[i * m + k]));
+		}
+		if (scale > 0.0)
+		{
+			worst = fmax(worst, diff / scale);
+		}
+	}
+	return worst;
+}
+
+/**
+ * Times of the three batch paths with the current kernels
+ */
+static void run(int function, size_t n, size_t d, size_t m, const double *X,
+		const double *XT, double *F, double *FT, double *J, double *t)
+{
+	t[0] = wall_time();
+	gmf_rwa_evaluate(function, n, X, d, F, m, gmf_row_major);
+	t[0] = wall_time() - t[0];
+	t[1] = wall_time();
+	gmf_rwa_evaluate(function, n, XT, n, FT, n, gmf_col_major);
+	t[1] = wall_time() - t[1];
+	t[2] = wall_time();
+	gmf_rwa_evaluate_jacobian(function, n, X, d, F, m, J, m * d);
+	t[2] = wall_time() - t[2];
+	gmf_rwa_evaluate(function, n, X, d, F, m, gmf_row_major);
+	return;
+}
+
+static void bench_problem(int function, size_t n)
+{
+	gmf_rwa_problem *problem = gmf_rwa_create((char*) gmf_rwa_name(function));
+	const struct gmf_mop_desc *mop = gmf_rwa_desc(problem);
+	size_t d = mop->nreal, m = mop->nobjs, i, j;
+	double *X = malloc(sizeof(double) * n * d);
+	double *XT = malloc(sizeof(double) * n * d);
+	double *F = malloc(sizeof(double) * n * m);
+	double *G = malloc(sizeof(double) * n * m);
+	double *FT = malloc(sizeof(double) * n * m);
+	double *J = malloc(sizeof(double) * n * m * d);
+	double *K = malloc(sizeof(double) * n * m * d);
+	double ref[3], gen[3];
+	gmf_rng rng;
+
+	/* fault the pages in before timing */
+	memset(F, 0, sizeof(double) * n * m);
+	memset(G, 0, sizeof(double) * n * m);
+	memset(FT, 0, sizeof(double) * n * m);
+	memset(J, 0, sizeof(double) * n * m * d);
+	memset(K, 0, sizeof(double) * n * m * d);
+	gmf_rng_init(&rng, 5, 0);
+	gmf_rwa_rnd_solutions(&rng, mop, n, X, d);
+	for (i = 0; i < n; ++i)
+	{
+		for (j = 0; j < d; ++j)
+		{
+			XT[j * n + i] = X[i * d + j];
+		}
+	}
+	gmf_rwa_set_kernels(gmf_kernels_reference);
+	run(function, n, d, m, X, XT, F, FT, J, ref);
+	gmf_rwa_set_kernels(gmf_kernels_generated);
+	run(function, n, d, m, X, XT, G, FT, K, gen);
+	gmf_rwa_set_kernels(gmf_kernels_reference);
+
+	printf("%-18s %8.2f %8.2f %8.2f %8.2f %8.2f %8.2f %9.1e %9.1e\n",
+			mop->name, 1e9 * ref[0] / n, 1e9 * gen[0] / n, 1e9 * ref[1] / n,
+			1e9 * gen[1] / n, 1e9 * ref[2] / n, 1e9 * gen[2] / n,
+			scaled_diff(F, G, n, m), scaled_diff(J, K, n, m * d));
+	gmf_rwa_destroy(problem);
+	free(X);
+	free(XT);
+	free(F);
+	free(G);
+	free(FT);
+	free(J);
+	free(K);
+	return;
+}
+
+int main(int argc, char **argv)
+{
+	size_t n = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000000;
+	int function;
+
+	printf("%-18s %17s %17s %17s %19s\n", "ns per point", "row-major",
+			"column-major", "Jacobian", "max diff");
+	printf("%-18s %8s %8s %8s %8s %8s %8s %9s %9s\n", "problem", "hand",
+			"gen", "hand", "gen", "hand", "gen", "F", "J");
+	for (function = 0; function < 10; ++function)
+	{
+		bench_problem(function, n);
+	}
+	return 0;
+}
@@ -0,0 +1,218 @@
+/*
+ * bench_server.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Evaluation through the shared-memory server of gmf_server.h against
+ * gmf_rwa_evaluate in the calling process. The server runs in this process
+ * and nclients forked processes evaluate their share of the points of every
+ * problem with gmf_client_evaluate, in calls of batch points, and compare
+ * the objectives bitwise with local evaluation. Prints nanoseconds per point
+ * of local evaluation (one process) and of the clients together (the points
+ * of all clients over the slowest client's time).
+ *
+ *   gcc -O2 -I.. bench_server.c ../gmf_server.c ../gmf_dv_rwa.c ../gmf_rng.c \
+ *       ../gmf_pof.c ../gmf_parse.c -o bench_server -lm -lpthread
+ *   ./bench_server [nclients] [points]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include "gmf_global.h"
+#include "gmf_dv_rwa.h"
+#include "gmf_rng.h"
+#include "gmf_server.h"
+
+void (*gmf_test_problem)(double *F, double *G, double *xr, int *xi, int *xb);
+struct gmf_mop_desc gmf_mop;
+
+#define RUNS 3
+#define MAXCLIENTS 64
+
+static const size_t batches[] = { 1, 64, 4096 };
+
+/**
+ * Written by the clients, in memory shared with the parent
+ */
+struct result
+{
+	double seconds[10];
+	int same[10];
+};
+
+static double wall_time()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static void *serve(void *server)
+{
+	gmf_server_run(server);
+	return NULL;
+}
+
+/**
+ * Random points of the problem and their local objectives
+ */
+static void make_points(int function, size_t n, uint64_t seed, double **X,
+		double **F)
+{
+	const struct gmf_rwa_entry *entry = gmf_rwa_registry(function);
+	gmf_rwa_problem *problem = gmf_rwa_create((char *) entry->name);
+	gmf_rng rng;
+
+	*X = malloc(sizeof(double) * n * entry->nreal);
+	*F = malloc(sizeof(double) * n * entry->nobjs);
+	gmf_rng_init(&rng, seed, function);
+	gmf_rwa_rnd_solutions(&rng, gmf_rwa_desc(problem), n, *X, entry->nreal);
+	gmf_rwa_evaluate(function, n, *X, entry->nreal, *F, entry->nobjs,
+			gmf_row_major);
+	gmf_rwa_destroy(problem);
+	return;
+}
+
+static double time_local(int function, size_t n, size_t batch)
+{
+	const struct gmf_rwa_entry *entry = gmf_rwa_registry(function);
+	double *X, *F, best = 1e30, t;
+	size_t i, m;
+	int run;
+
+	make_points(function, n, 1, &X, &F);
+	for (run = 0; run < RUNS; ++run)
+	{
+		t = wall_time();
+		for (i = 0; i < n; i += m)
+		{
+			m = n - i < batch ? n - i : batch;
+			gmf_rwa_evaluate(function, m, X + i * entry->nreal, entry->nreal,
+					F + i * entry->nobjs, entry->nobjs, gmf_row_major);
+		}
+		t = wall_time() - t;
+		best = t < best ? t : best;
+	}
+	free(X);
+	free(F);
+	return 1e9 * best / n;
+}
+
+/**
+ * Body of a client process
+ */
+static int client(const char *name, size_t n, size_t batch, uint64_t seed,
+		struct result *result)
+{
+	const struct gmf_rwa_entry *entry;
+	gmf_client *client = gmf_client_connect(name);
+	double *X, *F, *G, best, t;
+	size_t i, m;
+	int function, run, ok = client != NULL;
+
+	for (function = 0; ok && function < 10; ++function)
+	{
+		entry = gmf_rwa_registry(function);
+		make_points(function, n, seed, &X, &F);
+		G = malloc(sizeof(double) * n * entry->nobjs);
+		best = 1e30;
+		for (run = 0; ok && run < RUNS; ++run)
+		{
+			memset(G, 0, sizeof(double) * n * entry->nobjs);
+			t = wall_time();
+			for (i = 0; ok && i < n; i += m)
+			{
+				m = n - i < batch ? n - i : batch;
+				ok = gmf_client_evaluate(client, function, m,
+						X + i * entry->nreal, entry->nreal, G + i * entry->nobjs,
+						entry->nobjs);
+			}
+			t = wall_time() - t;
+			best = t < best ? t : best;
+		}
+		result->seconds[function] = best;
+		result->same[function] = ok && memcmp(F, G, sizeof(double) * n
+				* entry->nobjs) == 0;
+		free(X);
+		free(F);
+		free(G);
+	}
+	gmf_client_disconnect(client);
+	return ok;
+}
+
+int main(int argc, char **argv)
+{
+	int nclients = argc > 1 ? atoi(argv[1]) : 4;
+	size_t n = argc > 2 ? strtoul(argv[2], NULL, 10) : 65536, share, b;
+	char name[64];
+	struct result *results;
+	gmf_server *server;
+	pthread_t runner;
+	double slowest;
+	int function, c, status, failed = 0, same;
+	pid_t pid;
+
+	nclients = nclients < 1 ? 1 : nclients > MAXCLIENTS ? MAXCLIENTS
+			: nclients;
+	share = n / nclients > 0 ? n / nclients : 1;
+	snprintf(name, sizeof(name), "/gmf_bench_%d", (int) getpid());
+	server = gmf_server_create(name, 0, 0, 0);
+	results = mmap(NULL, sizeof(struct result) * nclients,
+			PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (server == NULL || results == MAP_FAILED)
+	{
+		fprintf(stderr, "cannot create the server\n");
+		return 1;
+	}
+	pthread_create(&runner, NULL, serve, server);
+
+	printf("%d clients, %zu points each; ns per point\n", nclients, share);
+	for (b = 0; b < sizeof(batches) / sizeof(batches[0]); ++b)
+	{
+		memset(results, 0, sizeof(struct result) * nclients);
+		for (c = 0; c < nclients; ++c)
+		{
+			pid = fork();
+			if (pid == 0)
+			{
+				_exit(client(name, share, batches[b], 100 + c, &results[c])
+						? 0 : 1);
+			}
+		}
+		for (c = 0; c < nclients; ++c)
+		{
+			wait(&status);
+			failed += !WIFEXITED(status) || WEXITSTATUS(status) != 0;
+		}
+
+		printf("\nbatch %zu\n%-18s %10s %10s %6s\n", batches[b], "problem",
+				"local", "server", "same");
+		for (function = 0; function < 10; ++function)
+		{
+			slowest = 0.0;
+			same = 1;
+			for (c = 0; c < nclients; ++c)
+			{
+				slowest = results[c].seconds[function] > slowest
+						? results[c].seconds[function] : slowest;
+				same = same && results[c].same[function];
+			}
+			printf("%-18s %10.1f %10.1f %6s\n", gmf_rwa_name(function),
+					time_local(function, share, batches[b]),
+					1e9 * slowest / (share * nclients), same ? "yes" : "NO");
+			failed += !same;
+		}
+	}
+
+	gmf_server_stop(server);
+	pthread_join(runner, NULL);
+	gmf_server_destroy(server);
+	munmap(results, sizeof(struct result) * nclients);
+	return failed > 0;
+}
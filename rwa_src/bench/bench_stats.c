@@ -0,0 +1,190 @@
+/*
+ * bench_stats.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Check of the evaluation statistics of gmf_stats.h: nthreads threads
+ * evaluate known numbers of points (batches of gmf_rwa_evaluate and single
+ * gmf_rwa_eval calls) of problems chosen by thread, and the counts of
+ * gmf_stats_snapshot are compared with them while the threads are alive,
+ * after they exit (their blocks retired), after gmf_stats_reset and with
+ * timing on, where every evaluation must land in the histogram. Prints
+ * the nanoseconds per evaluation of the slowest thread with timing off and
+ * on, and the output of gmf_stats_export. Exits with 1 if a count is wrong.
+ *
+ *   gcc -O2 -DGMF_STATS -I.. bench_stats.c ../gmf_stats.c ../gmf_dv_rwa.c \
+ *       ../gmf_rng.c ../gmf_pof.c ../gmf_parse.c -o bench_stats -lm -lpthread
+ *   ./bench_stats [nthreads] [batches]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "gmf_global.h"
+#include "gmf_dv_rwa.h"
+#include "gmf_rng.h"
+#include "gmf_stats.h"
+
+void (*gmf_test_problem)(double *F, double *G, double *xr, int *xi, int *xb);
+struct gmf_mop_desc gmf_mop;
+
+#define BATCH 256
+#define SINGLES 1000
+#define MAXTHREADS 64
+
+struct worker
+{
+	int function;
+	size_t batches;
+	pthread_barrier_t *counted; /* work done, main takes a snapshot */
+	pthread_barrier_t *checked; /* main done, the thread may exit */
+	double seconds;
+};
+
+static double wall_time()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static void *work(void *arg)
+{
+	struct worker *w = arg;
+	const struct gmf_rwa_entry *entry = gmf_rwa_registry(w->function);
+	gmf_rwa_problem *problem = gmf_rwa_create((char *) entry->name);
+	double *X = malloc(sizeof(double) * BATCH * entry->nreal);
+	double *F = malloc(sizeof(double) * BATCH * entry->nobjs);
+	size_t b, i;
+	gmf_rng rng;
+
+	gmf_rng_init(&rng, 11, w->function);
+	gmf_rwa_rnd_solutions(&rng, gmf_rwa_desc(problem), BATCH, X, entry->nreal);
+	w->seconds = wall_time();
+	for (b = 0; b < w->batches; ++b)
+	{
+		gmf_rwa_evaluate(w->function, BATCH, X, entry->nreal, F, entry->nobjs,
+				gmf_row_major);
+	}
+	for (i = 0; i < SINGLES; ++i)
+	{
+		gmf_rwa_eval(problem, F, X + (i % BATCH) * entry->nreal);
+	}
+	w->seconds = wall_time() - w->seconds;
+	pthread_barrier_wait(w->counted);
+	pthread_barrier_wait(w->checked);
+	gmf_rwa_destroy(problem);
+	free(X);
+	free(F);
+	return NULL;
+}
+
+/**
+ * Compares the snapshot with the expected evaluations and calls of every
+ * problem (and, if timed, the histogram totals). Returns the errors.
+ */
+static int check(const char *stage, const size_t *evaluations,
+		const size_t *calls, int timed)
+{
+	struct gmf_stats_entry entry[GMF_STATS_PROBLEMS];
+	uint64_t histogram;
+	int f, b, errors = 0;
+
+	gmf_stats_snapshot(entry);
+	for (f = 0; f < GMF_STATS_PROBLEMS; ++f)
+	{
+		histogram = 0;
+		for (b = 0; b < GMF_STATS_BUCKETS; ++b)
+		{
+			histogram += entry[f].histogram[b];
+		}
+		if (entry[f].evaluations != evaluations[f] || entry[f].calls != calls[f]
+				|| histogram != (timed ? evaluations[f] : 0))
+		{
+			printf("%s: %s counted %llu evaluations in %llu calls "
+					"(histogram %llu), expected %zu in %zu\n", stage,
+					gmf_rwa_name(f), (unsigned long long) entry[f].evaluations,
+					(unsigned long long) entry[f].calls,
+					(unsigned long long) histogram, evaluations[f], calls[f]);
+			++errors;
+		}
+	}
+	printf("%-24s %s\n", stage, errors == 0 ? "ok" : "FAILED");
+	return errors;
+}
+
+/**
+ * Runs the workers, checking the counts while they are alive and after
+ * they exit. Returns the errors; *seconds gets the slowest thread's time.
+ */
+static int run(int nthreads, size_t batches, int timed, double *seconds)
+{
+	struct worker workers[MAXTHREADS];
+	pthread_t threads[MAXTHREADS];
+	pthread_barrier_t counted, checked;
+	size_t evaluations[GMF_STATS_PROBLEMS], calls[GMF_STATS_PROBLEMS];
+	int t, errors;
+
+	memset(evaluations, 0, sizeof(evaluations));
+	memset(calls, 0, sizeof(calls));
+	pthread_barrier_init(&counted, NULL, nthreads + 1);
+	pthread_barrier_init(&checked, NULL, nthreads + 1);
+	gmf_stats_reset();
+	gmf_stats_set_timing(timed);
+	for (t = 0; t < nthreads; ++t)
+	{
+		workers[t].function = t % GMF_STATS_PROBLEMS;
+		workers[t].batches = batches;
+		workers[t].counted = &counted;
+		workers[t].checked = &checked;
+		evaluations[workers[t].function] += batches * BATCH + SINGLES;
+		calls[workers[t].function] += batches + SINGLES;
+		pthread_create(&threads[t], NULL, work, &workers[t]);
+	}
+
+	pthread_barrier_wait(&counted);
+	errors = check(timed ? "timed, threads alive" : "threads alive",
+			evaluations, calls, timed);
+	pthread_barrier_wait(&checked);
+	*seconds = 0.0;
+	for (t = 0; t < nthreads; ++t)
+	{
+		pthread_join(threads[t], NULL);
+		*seconds = workers[t].seconds > *seconds ? workers[t].seconds
+				: *seconds;
+	}
+	errors += check(timed ? "timed, threads exited" : "threads exited",
+			evaluations, calls, timed);
+	pthread_barrier_destroy(&counted);
+	pthread_barrier_destroy(&checked);
+	return errors;
+}
+
+int main(int argc, char **argv)
+{
+	int nthreads = argc > 1 ? atoi(argv[1]) : 4;
+	size_t batches = argc > 2 ? strtoul(argv[2], NULL, 10) : 4000;
+	size_t zero[GMF_STATS_PROBLEMS] = { 0 };
+	double off, on, per;
+	int errors;
+
+	if (!gmf_stats_enabled())
+	{
+		printf("statistics compiled out, build with -DGMF_STATS\n");
+		return 1;
+	}
+	nthreads = nthreads < 1 ? 1 : nthreads > MAXTHREADS ? MAXTHREADS
+			: nthreads;
+	per = (double) (batches * BATCH + SINGLES);
+
+	errors = run(nthreads, batches, 0, &off);
+	gmf_stats_reset();
+	errors += check("reset", zero, zero, 0);
+	errors += run(nthreads, batches, 1, &on);
+
+	printf("\n%d threads, ns per evaluation of the slowest: timing off %.2f, "
+			"on %.2f\n\n", nthreads, 1e9 * off / per, 1e9 * on / per);
+	errors += !gmf_stats_export(stdout);
+	return errors > 0;
+}
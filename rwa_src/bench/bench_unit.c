@@ -0,0 +1,210 @@
+/*
+ * bench_unit.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Evaluation of points of the unit box into normalized objectives: the
+ * three passes an optimizer makes today (map to the box, gmf_rwa_evaluate
+ * with the generated kernels, map the objectives onto [ideal, nadir])
+ * against one pass of a blocked plan built on gmf_poly_normalize. Prints
+ * the monomials of both tables, the best time per point of row-major and
+ * column-major batches, and the largest difference of the fused results
+ * from the three passes: in units of the normalized objectives, and for
+ * a table normalized in the inputs only, relative to the magnitude of
+ * each objective. Ideal and nadir are the extremes of the sample.
+ *
+ *   gcc -O2 -I.. bench_unit.c ../gmf_poly.c ../gmf_dv_rwa.c ../gmf_rng.c \
+ *       ../gmf_pof.c ../gmf_parse.c -o bench_unit -lm
+ *   ./bench_unit [n] [evaluations]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "gmf_global.h"
+#include "gmf_dv_rwa.h"
+#include "gmf_poly.h"
+
+void (*gmf_test_problem)(double *F, double *G, double *xr, int *xi, int *xb);
+struct gmf_mop_desc gmf_mop;
+
+#define RUNS 5
+
+static double wall_time()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+/**
+ * Offset of element (i, k) of a matrix of points in the given order
+ */
+static size_t at(size_t i, size_t k, size_t ld, int order)
+{
+	return order == gmf_row_major ? i * ld + k : k * ld + i;
+}
+
+/**
+ * The three passes: U to X in the box, X to F, F to normalized objectives
+ */
+static void three_passes(int function, const struct gmf_poly *poly, size_t n,
+		const double *U, double *X, double *F, const double *ideal,
+		const double *nadir, int order)
+{
+	size_t d = poly->nvars, m = poly->nobjs, i, j;
+	size_t ldx = order == gmf_row_major ? d : n;
+	size_t ldf = order == gmf_row_major ? m : n;
+
+	for (i = 0; i < n; ++i)
+	{
+		for (j = 0; j < d; ++j)
+		{
+			X[at(i, j, ldx, order)] = poly->xmin[j] + (poly->xmax[j]
+					- poly->xmin[j]) * U[at(i, j, ldx, order)];
+		}
+	}
+	gmf_rwa_evaluate(function, n, X, ldx, F, ldf, order);
+	for (i = 0; i < n; ++i)
+	{
+		for (j = 0; j < m; ++j)
+		{
+			F[at(i, j, ldf, order)] = (F[at(i, j, ldf, order)] - ideal[j])
+					/ (nadir[j] - ideal[j]);
+		}
+	}
+	return;
+}
+
+/**
+ * Best nanoseconds per point of `reps` batches, three passes (plan NULL) or
+ * the fused plan
+ */
+static double time_batch(int function, const struct gmf_poly *poly,
+		const gmf_poly_plan *plan, size_t n, size_t reps, const double *U,
+		double *X, double *F, const double *ideal, const double *nadir,
+		int order)
+{
+	size_t ldx = order == gmf_row_major ? poly->nvars : n;
+	size_t ldf = order == gmf_row_major ? poly->nobjs : n;
+	double best = INFINITY, t;
+	size_t run, r;
+
+	for (run = 0; run < RUNS; ++run)
+	{
+		t = wall_time();
+		for (r = 0; r < reps; ++r)
+		{
+			if (plan == NULL)
+			{
+				three_passes(function, poly, n, U, X, F, ideal, nadir, order);
+			}
+			else
+			{
+				gmf_poly_plan_evaluate(plan, n, U, ldx, F, ldf, order);
+			}
+		}
+		t = wall_time() - t;
+		best = t < best ? t : best;
+	}
+	return 1e9 * best / (n * reps);
+}
+
+static void bench_problem(int function, size_t n, size_t reps)
+{
+	const struct gmf_poly *poly = gmf_poly_get(function);
+	size_t d = poly->nvars, m = poly->nobjs, i, k;
+	double *U = malloc(sizeof(double) * n * d);
+	double *X = calloc(n * d, sizeof(double));
+	double *F = calloc(n * m, sizeof(double));
+	double *G = calloc(n * m, sizeof(double));
+	double ideal[8], nadir[8], row[2], col[2], diff = 0.0, scaled = 0.0, s;
+	struct gmf_poly *unit, *inputs;
+	gmf_poly_plan *plan, *plain;
+	gmf_rng rng;
+
+	gmf_rng_init(&rng, 5, 0);
+	for (i = 0; i < n * d; ++i)
+	{
+		U[i] = gmf_rng_uniform(&rng);
+	}
+
+	/* ideal and nadir of the sample, F in the box as the reference */
+	for (k = 0; k < m; ++k)
+	{
+		ideal[k] = 0.0;
+		nadir[k] = 1.0;
+	}
+	three_passes(function, poly, n, U, X, G, ideal, nadir, gmf_row_major);
+	inputs = gmf_poly_normalize(poly, NULL, NULL);
+	plain = gmf_poly_plan_create(inputs, gmf_simd_avx512);
+	gmf_poly_plan_evaluate(plain, n, U, d, F, m, gmf_row_major);
+	for (k = 0; k < m; ++k)
+	{
+		ideal[k] = INFINITY;
+		nadir[k] = -INFINITY;
+		s = 0.0;
+		for (i = 0; i < n; ++i)
+		{
+			ideal[k] = fmin(ideal[k], G[i * m + k]);
+			nadir[k] = fmax(nadir[k], G[i * m + k]);
+			s = fmax(s, fabs(G[i * m + k]));
+		}
+		for (i = 0; i < n; ++i)
+		{
+			scaled = fmax(scaled, fabs(F[i * m + k] - G[i * m + k]) / s);
+		}
+	}
+	gmf_poly_plan_destroy(plain);
+	gmf_poly_destroy(inputs);
+
+	unit = gmf_poly_normalize(poly, ideal, nadir);
+	plan = gmf_poly_plan_create(unit, gmf_simd_avx512);
+	three_passes(function, poly, n, U, X, G, ideal, nadir, gmf_row_major);
+	gmf_poly_plan_evaluate(plan, n, U, d, F, m, gmf_row_major);
+	for (i = 0; i < n * m; ++i)
+	{
+		diff = fmax(diff, fabs(F[i] - G[i]));
+	}
+
+	gmf_rwa_set_kernels(gmf_kernels_generated);
+	row[0] = time_batch(function, poly, NULL, n, reps, U, X, F, ideal, nadir,
+			gmf_row_major);
+	row[1] = time_batch(function, poly, plan, n, reps, U, X, F, ideal, nadir,
+			gmf_row_major);
+	col[0] = time_batch(function, poly, NULL, n, reps, U, X, F, ideal, nadir,
+			gmf_col_major);
+	col[1] = time_batch(function, poly, plan, n, reps, U, X, F, ideal, nadir,
+			gmf_col_major);
+	gmf_rwa_set_kernels(gmf_kernels_reference);
+
+	printf("%-18s %5zu %5zu %7.2f %7.2f %7.2f %7.2f %9.1e %9.1e\n",
+			poly->name, poly->nterms, unit->nterms, row[0], row[1], col[0],
+			col[1], diff, scaled);
+	gmf_poly_plan_destroy(plan);
+	gmf_poly_destroy(unit);
+	free(U);
+	free(X);
+	free(F);
+	free(G);
+	return;
+}
+
+int main(int argc, char **argv)
+{
+	size_t n = argc > 1 ? strtoul(argv[1], NULL, 10) : 4096;
+	size_t evaluations = argc > 2 ? strtoul(argv[2], NULL, 10) : 4000000;
+	size_t reps = evaluations / n > 0 ? evaluations / n : 1;
+	int function;
+
+	printf("%-18s %11s %15s %15s %19s\n", "ns per point", "monomials",
+			"row-major", "column-major", "max diff");
+	printf("%-18s %5s %5s %7s %7s %7s %7s %9s %9s\n", "problem", "box", "unit",
+			"3 pass", "fused", "3 pass", "fused", "normal.", "in box");
+	for (function = 0; function < 10; ++function)
+	{
+		bench_problem(function, n, reps);
+	}
+	return 0;
+}
@@ -0,0 +1,797 @@
+/*
+ * gmf_archive.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "gmf_global.h"
+#include "gmf_archive.h"
+
+#define GMF_ARCHIVE_NONE ((size_t) -1)
+
+struct gmf_archive_node
+{
+	size_t left; /* GMF_ARCHIVE_NONE for a leaf */
+	size_t right;
+	size_t k;
+	double value;
+	size_t count; /* points in the subtree */
+	size_t item[GMF_ARCHIVE_BUCKET]; /* slots of the points of a leaf */
+};
+
+struct gmf_archive
+{
+	size_t nobjs;
+	size_t nreal;
+	size_t capacity;
+	size_t stride; /* nobjs + nreal values per slot */
+
+	/* point pool */
+	double *data;
+	size_t nslots;
+	size_t slot_capacity;
+	size_t *free_slot;
+	size_t nfree_slots;
+
+	/* node pool, node 0 is the root; free nodes are chained by left */
+	struct gmf_archive_node *node;
+	double *box; /* lower then upper corner, 2 * nobjs values per node */
+	size_t nnodes;
+	size_t node_capacity;
+	size_t free_node;
+
+	/* storage of a truncation, taken once it is near */
+	size_t *trunc_slots;
+	double *trunc_crowding;
+	struct gmf_archive_key *trunc_keys;
+};
+
+struct gmf_archive_key
+{
+	double key;
+	size_t i;
+};
+
+static double *gmf_archive_point(const gmf_archive *archive, size_t slot)
+{
+	return archive->data + slot * archive->stride;
+}
+
+/** **************************************************************************
+ ** Pools
+ ** **************************************************************************/
+static size_t gmf_archive_slot_new(gmf_archive *archive)
+{
+	size_t capacity;
+	double *data;
+	size_t *free_slot;
+
+	if (archive->nfree_slots > 0)
+	{
+		return archive->free_slot[--archive->nfree_slots];
+	}
+	if (archive->nslots == archive->slot_capacity)
+	{
+		capacity = archive->slot_capacity > 0 ? 2 * archive->slot_capacity : 256;
+		data = realloc(archive->data, sizeof(double) * archive->stride * capacity);
+		if (data == NULL)
+		{
+			return GMF_ARCHIVE_NONE;
+		}
+		archive->data = data;
+		free_slot = realloc(archive->free_slot, sizeof(size_t) * capacity);
+		if (free_slot == NULL)
+		{
+			return GMF_ARCHIVE_NONE;
+		}
+		archive->free_slot = free_slot;
+		archive->slot_capacity = capacity;
+	}
+	return archive->nslots++;
+}
+
+static void gmf_archive_slot_free(gmf_archive *archive, size_t slot)
+{
+	archive->free_slot[archive->nfree_slots++] = slot;
+	return;
+}
+
+static void gmf_archive_box_reset(gmf_archive *archive, size_t id)
+{
+	double *lower = archive->box + id * 2 * archive->nobjs;
+	double *upper = lower + archive->nobjs;
+	size_t k;
+	for (k = 0; k < archive->nobjs; ++k)
+	{
+		lower[k] = HUGE_VAL;
+		upper[k] = -HUGE_VAL;
+	}
+	return;
+}
+
+static void gmf_archive_box_add(gmf_archive *archive, size_t id,
+		const double *f)
+{
+	double *lower = archive->box + id * 2 * archive->nobjs;
+	double *upper = lower + archive->nobjs;
+	size_t k;
+	for (k = 0; k < archive->nobjs; ++k)
+	{
+		lower[k] = f[k] < lower[k] ? f[k] : lower[k];
+		upper[k] = f[k] > upper[k] ? f[k] : upper[k];
+	}
+	return;
+}
+
+/**
+ * Grows the node pool (doubling) to hold at least needed nodes. Returns 0
+ * if memory runs out.
+ */
+static int gmf_archive_node_grow(gmf_archive *archive, size_t needed)
+{
+	struct gmf_archive_node *node;
+	size_t capacity = archive->node_capacity > 0 ? archive->node_capacity : 64;
+	double *box;
+
+	if (needed <= archive->node_capacity)
+	{
+		return 1;
+	}
+	while (capacity < needed)
+	{
+		capacity *= 2;
+	}
+	node = realloc(archive->node, sizeof(struct gmf_archive_node) * capacity);
+	if (node == NULL)
+	{
+		return 0;
+	}
+	archive->node = node;
+	box = realloc(archive->box, sizeof(double) * 2 * archive->nobjs * capacity);
+	if (box == NULL)
+	{
+		return 0;
+	}
+	archive->box = box;
+	archive->node_capacity = capacity;
+	return 1;
+}
+
+/**
+ * Makes sure count nodes can be taken without allocating. Returns 0 if
+ * memory runs out.
+ */
+static int gmf_archive_node_reserve(gmf_archive *archive, size_t count)
+{
+	size_t have = archive->node_capacity - archive->nnodes, id;
+
+	for (id = archive->free_node; have < count && id != GMF_ARCHIVE_NONE;
+			id = archive->node[id].left)
+	{
+		++have;
+	}
+	return have >= count
+			|| gmf_archive_node_grow(archive, archive->nnodes + count);
+}
+
+/**
+ * New empty leaf. Returns GMF_ARCHIVE_NONE if memory runs out.
+ */
+static size_t gmf_archive_node_new(gmf_archive *archive)
+{
+	size_t id;
+
+	if (archive->free_node != GMF_ARCHIVE_NONE)
+	{
+		id = archive->free_node;
+		archive->free_node = archive->node[id].left;
+	}
+	else
+	{
+		if (archive->nnodes == archive->node_capacity
+				&& !gmf_archive_node_grow(archive, archive->nnodes + 1))
+		{
+			return GMF_ARCHIVE_NONE;
+		}
+		id = archive->nnodes++;
+	}
+	archive->node[id].left = GMF_ARCHIVE_NONE;
+	archive->node[id].right = GMF_ARCHIVE_NONE;
+	archive->node[id].count = 0;
+	gmf_archive_box_reset(archive, id);
+	return id;
+}
+
+/**
+ * Returns the nodes below id to the pool (the points stay)
+ */
+static void gmf_archive_node_free_below(gmf_archive *archive, size_t id)
+{
+	size_t child[2], c;
+	if (archive->node[id].left == GMF_ARCHIVE_NONE)
+	{
+		return;
+	}
+	child[0] = archive->node[id].left;
+	child[1] = archive->node[id].right;
+	for (c = 0; c < 2; ++c)
+	{
+		gmf_archive_node_free_below(archive, child[c]);
+		archive->node[child[c]].left = archive->free_node;
+		archive->free_node = child[c];
+	}
+	archive->node[id].left = GMF_ARCHIVE_NONE;
+	archive->node[id].right = GMF_ARCHIVE_NONE;
+	return;
+}
+
+static void gmf_archive_gather(const gmf_archive *archive, size_t id,
+		size_t *slots, size_t *m)
+{
+	const struct gmf_archive_node *node = &archive->node[id];
+	size_t i;
+	if (node->left == GMF_ARCHIVE_NONE)
+	{
+		for (i = 0; i < node->count; ++i)
+		{
+			slots[(*m)++] = node->item[i];
+		}
+		return;
+	}
+	gmf_archive_gather(archive, node->left, slots, m);
+	gmf_archive_gather(archive, node->right, slots, m);
+	return;
+}
+
+/**
+ * Empties the tree, keeping the pools' storage
+ */
+static void gmf_archive_reset_tree(gmf_archive *archive)
+{
+	archive->nnodes = 0;
+	archive->free_node = GMF_ARCHIVE_NONE;
+	gmf_archive_node_new(archive); /* the root, storage already there */
+	return;
+}
+
+/** **************************************************************************
+ ** Dominance tree
+ ** **************************************************************************/
+static int gmf_archive_covers(const double *a, const double *b, size_t d)
+{
+	size_t k;
+	for (k = 0; k < d; ++k)
+	{
+		if (a[k] > b[k])
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/**
+ * Some point of the subtree is no worse than f in every objective
+ */
+static int gmf_archive_covered(const gmf_archive *archive, size_t id,
+		const double *f)
+{
+	const struct gmf_archive_node *node = &archive->node[id];
+	const double *lower = archive->box + id * 2 * archive->nobjs;
+	const double *upper = lower + archive->nobjs;
+	size_t i, d = archive->nobjs;
+
+	if (node->count == 0 || !gmf_archive_covers(lower, f, d))
+	{
+		return 0;
+	}
+	if (gmf_archive_covers(upper, f, d))
+	{
+		return 1;
+	}
+	if (node->left == GMF_ARCHIVE_NONE)
+	{
+		for (i = 0; i < node->count; ++i)
+		{
+			if (gmf_archive_covers(gmf_archive_point(archive, node->item[i]), f,
+					d))
+			{
+				return 1;
+			}
+		}
+		return 0;
+	}
+	return gmf_archive_covered(archive, node->left, f)
+			|| (f[node->k] >= node->value
+					&& gmf_archive_covered(archive, node->right, f));
+}
+
+/**
+ * Turns a small subtree back into a leaf
+ */
+static void gmf_archive_collapse(gmf_archive *archive, size_t id)
+{
+	size_t slots[GMF_ARCHIVE_BUCKET], m = 0, i;
+	gmf_archive_gather(archive, id, slots, &m);
+	gmf_archive_node_free_below(archive, id);
+	gmf_archive_box_reset(archive, id);
+	for (i = 0; i < m; ++i)
+	{
+		archive->node[id].item[i] = slots[i];
+		gmf_archive_box_add(archive, id, gmf_archive_point(archive, slots[i]));
+	}
+	archive->node[id].count = m;
+	return;
+}
+
+/**
+ * Removes the points of the subtree that f covers, then tightens the
+ * corners of the visited nodes
+ */
+static void gmf_archive_prune(gmf_archive *archive, size_t id,
+		const double *f)
+{
+	struct gmf_archive_node *node = &archive->node[id];
+	const double *lower = archive->box + id * 2 * archive->nobjs;
+	const double *upper = lower + archive->nobjs;
+	size_t d = archive->nobjs, i, m, child;
+	double *point;
+
+	if (node->count == 0 || !gmf_archive_covers(f, upper, d))
+	{
+		return;
+	}
+	if (gmf_archive_covers(f, lower, d))
+	{
+		/* f covers the whole subtree */
+		m = 0;
+		if (node->left == GMF_ARCHIVE_NONE)
+		{
+			for (i = 0; i < node->count; ++i)
+			{
+				gmf_archive_slot_free(archive, node->item[i]);
+			}
+		}
+		else
+		{
+			/* the free slot stack has room for every slot */
+			gmf_archive_gather(archive, id,
+					archive->free_slot + archive->nfree_slots, &m);
+			archive->nfree_slots += m;
+			gmf_archive_node_free_below(archive, id);
+		}
+		node->count = 0;
+		gmf_archive_box_reset(archive, id);
+		return;
+	}
+
+	if (node->left == GMF_ARCHIVE_NONE)
+	{
+		gmf_archive_box_reset(archive, id);
+		for (i = 0, m = 0; i < node->count; ++i)
+		{
+			point = gmf_archive_point(archive, node->item[i]);
+			if (gmf_archive_covers(f, point, d))
+			{
+				gmf_archive_slot_free(archive, node->item[i]);
+			}
+			else
+			{
+				node->item[m++] = node->item[i];
+				gmf_archive_box_add(archive, id, point);
+			}
+		}
+		node->count = m;
+		return;
+	}
+
+	/* points on the left have f_k < value, so f_k must be below it too */
+	if (f[node->k] < node->value)
+	{
+		gmf_archive_prune(archive, node->left, f);
+	}
+	gmf_archive_prune(archive, node->right, f);
+	node->count = archive->node[node->left].count
+			+ archive->node[node->right].count;
+	if (node->count <= GMF_ARCHIVE_BUCKET / 2)
+	{
+		gmf_archive_collapse(archive, id);
+		return;
+	}
+	gmf_archive_box_reset(archive, id);
+	for (i = 0; i < 2; ++i)
+	{
+		child = i == 0 ? node->left : node->right;
+		if (archive->node[child].count > 0)
+		{
+			gmf_archive_box_add(archive, id, archive->box + child * 2 * d);
+			gmf_archive_box_add(archive, id, archive->box + child * 2 * d + d);
+		}
+	}
+	return;
+}
+
+/**
+ * Splits a full leaf at the middle of the range of an objective, the first
+ * whose values differ starting from the one of this depth
+ */
+static int gmf_archive_split(gmf_archive *archive, size_t id, size_t depth)
+{
+	size_t d = archive->nobjs, slots[GMF_ARCHIVE_BUCKET], n, t, k = 0, i;
+	size_t left, right, child;
+	double lo = 0.0, hi = 0.0, value;
+	struct gmf_archive_node *node;
+
+	n = archive->node[id].count;
+	memcpy(slots, archive->node[id].item, sizeof(size_t) * n);
+	for (t = 0; t < d; ++t)
+	{
+		k = (depth + t) % d;
+		lo = hi = gmf_archive_point(archive, slots[0])[k];
+		for (i = 1; i < n; ++i)
+		{
+			value = gmf_archive_point(archive, slots[i])[k];
+			lo = value < lo ? value : lo;
+			hi = value > hi ? value : hi;
+		}
+		if (lo < hi)
+		{
+			break;
+		}
+	}
+	if (t == d)
+	{
+		return 0; /* equal points, never stored twice */
+	}
+	value = lo + 0.5 * (hi - lo);
+	value = value > lo ? value : hi;
+
+	left = gmf_archive_node_new(archive);
+	if (left == GMF_ARCHIVE_NONE)
+	{
+		return 0;
+	}
+	right = gmf_archive_node_new(archive);
+	if (right == GMF_ARCHIVE_NONE)
+	{
+		archive->node[left].left = archive->free_node;
+		archive->free_node = left;
+		return 0;
+	}
+	for (i = 0; i < n; ++i)
+	{
+		child = gmf_archive_point(archive, slots[i])[k] < value ? left : right;
+		node = &archive->node[child];
+		node->item[node->count++] = slots[i];
+		gmf_archive_box_add(archive, child, gmf_archive_point(archive, slots[i]));
+	}
+	node = &archive->node[id];
+	node->left = left;
+	node->right = right;
+	node->k = k;
+	node->value = value;
+	return 1;
+}
+
+/**
+ * Adds the point of slot to the tree. The leaf it goes to is split first,
+ * if full, so a failed split (memory) leaves the tree unchanged; it cannot
+ * fail once two nodes are reserved (the children of a split are not empty,
+ * so the new point never meets a second full leaf).
+ */
+static int gmf_archive_tree_insert(gmf_archive *archive, size_t slot)
+{
+	const double *f = gmf_archive_point(archive, slot);
+	struct gmf_archive_node *node;
+	size_t id = 0, depth = 0;
+
+	while (archive->node[id].left != GMF_ARCHIVE_NONE)
+	{
+		node = &archive->node[id];
+		id = f[node->k] < node->value ? node->left : node->right;
+		++depth;
+	}
+	if (archive->node[id].count == GMF_ARCHIVE_BUCKET
+			&& !gmf_archive_split(archive, id, depth))
+	{
+		return 0;
+	}
+	for (id = 0;;)
+	{
+		node = &archive->node[id];
+		gmf_archive_box_add(archive, id, f);
+		node->count++;
+		if (node->left == GMF_ARCHIVE_NONE)
+		{
+			node->item[node->count - 1] = slot;
+			return 1;
+		}
+		id = f[node->k] < node->value ? node->left : node->right;
+	}
+}
+
+/** **************************************************************************
+ ** Bounded capacity
+ ** **************************************************************************/
+static int gmf_archive_compare(const void *a, const void *b)
+{
+	const struct gmf_archive_key *p = a, *q = b;
+	if (p->key != q->key)
+	{
+		return p->key < q->key ? -1 : 1;
+	}
+	return p->i < q->i ? -1 : (p->i > q->i);
+}
+
+/**
+ * Takes the storage of a truncation of n points: its work arrays, and the
+ * nodes of the rebuilt tree, at most 2 capacity - 1 as its leaves are never
+ * empty. Returns 0 if memory runs out.
+ */
+static int gmf_archive_truncate_reserve(gmf_archive *archive, size_t n)
+{
+	if (archive->trunc_keys == NULL)
+	{
+		archive->trunc_slots = malloc(sizeof(size_t) * n);
+		archive->trunc_crowding = malloc(sizeof(double) * n);
+		archive->trunc_keys = malloc(sizeof(struct gmf_archive_key) * n);
+		if (archive->trunc_slots == NULL || archive->trunc_crowding == NULL
+				|| archive->trunc_keys == NULL)
+		{
+			free(archive->trunc_slots);
+			free(archive->trunc_crowding);
+			free(archive->trunc_keys);
+			archive->trunc_slots = NULL;
+			archive->trunc_crowding = NULL;
+			archive->trunc_keys = NULL;
+			return 0;
+		}
+	}
+	return gmf_archive_node_grow(archive, 2 * archive->capacity);
+}
+
+/**
+ * Cuts the archive back to capacity, dropping the points of smallest
+ * crowding distance, and rebuilds the tree, in the storage taken by
+ * gmf_archive_truncate_reserve. Returns whether the point of slot is kept.
+ */
+static int gmf_archive_truncate(gmf_archive *archive, size_t slot)
+{
+	size_t n = archive->node[0].count, d = archive->nobjs, i, k, m = 0;
+	size_t *slots = archive->trunc_slots;
+	double *crowding = archive->trunc_crowding, range;
+	struct gmf_archive_key *keys = archive->trunc_keys;
+	int kept = 1;
+
+	gmf_archive_gather(archive, 0, slots, &m);
+	memset(crowding, 0, sizeof(double) * n);
+	for (k = 0; k < d; ++k)
+	{
+		for (i = 0; i < n; ++i)
+		{
+			keys[i].key = gmf_archive_point(archive, slots[i])[k];
+			keys[i].i = i;
+		}
+		qsort(keys, n, sizeof(struct gmf_archive_key), gmf_archive_compare);
+		range = keys[n - 1].key - keys[0].key;
+		crowding[keys[0].i] = HUGE_VAL;
+		crowding[keys[n - 1].i] = HUGE_VAL;
+		for (i = 1; range > 0.0 && i + 1 < n; ++i)
+		{
+			crowding[keys[i].i] += (keys[i + 1].key - keys[i - 1].key) / range;
+		}
+	}
+	for (i = 0; i < n; ++i)
+	{
+		keys[i].key = crowding[i];
+		keys[i].i = i;
+	}
+	qsort(keys, n, sizeof(struct gmf_archive_key), gmf_archive_compare);
+	for (i = 0; i < n - archive->capacity; ++i)
+	{
+		kept = kept && slots[keys[i].i] != slot;
+		gmf_archive_slot_free(archive, slots[keys[i].i]);
+		slots[keys[i].i] = GMF_ARCHIVE_NONE;
+	}
+	gmf_archive_reset_tree(archive);
+	for (i = 0; i < n; ++i)
+	{
+		if (slots[i] != GMF_ARCHIVE_NONE)
+		{
+			gmf_archive_tree_insert(archive, slots[i]);
+		}
+	}
+	return kept;
+}
+
+/** **************************************************************************
+ ** Archive
+ ** **************************************************************************/
+
+/**
+ * Creates an archive of nobjs objectives keeping nreal decision variables
+ * per point. capacity 0 leaves it unbounded. Returns NULL if memory runs
+ * out.
+ */
+gmf_archive *gmf_archive_create(size_t nobjs, size_t nreal, size_t capacity)
+{
+	gmf_archive *archive;
+
+	if (nobjs == 0)
+	{
+		return NULL;
+	}
+	archive = calloc(1, sizeof(gmf_archive));
+	if (archive == NULL)
+	{
+		return NULL;
+	}
+	archive->nobjs = nobjs;
+	archive->nreal = nreal;
+	archive->capacity = capacity;
+	archive->stride = nobjs + nreal;
+	archive->free_node = GMF_ARCHIVE_NONE;
+	if (gmf_archive_node_new(archive) == GMF_ARCHIVE_NONE)
+	{
+		gmf_archive_destroy(archive);
+		return NULL;
+	}
+	return archive;
+}
+
+void gmf_archive_destroy(gmf_archive *archive)
+{
+	if (archive == NULL)
+	{
+		return;
+	}
+	free(archive->data);
+	free(archive->free_slot);
+	free(archive->node);
+	free(archive->box);
+	free(archive->trunc_slots);
+	free(archive->trunc_crowding);
+	free(archive->trunc_keys);
+	free(archive);
+	return;
+}
+
+void gmf_archive_clear(gmf_archive *archive)
+{
+	archive->nslots = 0;
+	archive->nfree_slots = 0;
+	gmf_archive_reset_tree(archive);
+	return;
+}
+
+size_t gmf_archive_size(const gmf_archive *archive)
+{
+	return archive->node[0].count;
+}
+
+/**
+ * Offers a point (x may be NULL). Returns 1 if it was stored, 0 if an
+ * archived point covers it (or f has a NaN) or if the truncation to
+ * capacity that it triggered dropped it, and -1 if memory ran out, which
+ * leaves the archive unchanged: the memory is taken before any point is
+ * removed.
+ */
+int gmf_archive_insert(gmf_archive *archive, const double *f, const double *x)
+{
+	size_t slot, k, limit;
+	double *point;
+
+	for (k = 0; k < archive->nobjs; ++k)
+	{
+		if (f[k] != f[k])
+		{
+			return 0;
+		}
+	}
+	if (gmf_archive_covered(archive, 0, f))
+	{
+		return 0;
+	}
+
+	limit = archive->capacity + (archive->capacity / 16 > 0 ?
+			archive->capacity / 16 : 1);
+	slot = gmf_archive_slot_new(archive);
+	if (slot == GMF_ARCHIVE_NONE)
+	{
+		return -1;
+	}
+	if (!gmf_archive_node_reserve(archive, 2)
+			|| (archive->capacity > 0 && archive->node[0].count + 1 >= limit
+					&& !gmf_archive_truncate_reserve(archive, limit)))
+	{
+		gmf_archive_slot_free(archive, slot);
+		return -1;
+	}
+	point = gmf_archive_point(archive, slot);
+	memcpy(point, f, sizeof(double) * archive->nobjs);
+	for (k = 0; k < archive->nreal; ++k)
+	{
+		point[archive->nobjs + k] = x != NULL ? x[k] : 0.0;
+	}
+	gmf_archive_prune(archive, 0, f);
+	gmf_archive_tree_insert(archive, slot); /* the split nodes are reserved */
+
+	if (archive->capacity > 0 && archive->node[0].count >= limit)
+	{
+		return gmf_archive_truncate(archive, slot);
+	}
+	return 1;
+}
+
+/**
+ * Some archived point is no worse than f in every objective (f would be
+ * rejected), without offering it
+ */
+int gmf_archive_dominated(const gmf_archive *archive, const double *f)
+{
+	return gmf_archive_covered(archive, 0, f);
+}
+
+/**
+ * Offers the n points of the rows of F (and X, which may be NULL). Returns
+ * how many were stored.
+ */
+size_t gmf_archive_insert_batch(gmf_archive *archive, size_t n,
+		const double *F, size_t ldf, const double *X, size_t ldx)
+{
+	size_t i, accepted = 0;
+	for (i = 0; i < n; ++i)
+	{
+		accepted += gmf_archive_insert(archive, F + i * ldf,
+				X != NULL ? X + i * ldx : NULL) == 1;
+	}
+	return accepted;
+}
+
+/**
+ * Copies the archived points into the rows of F and X (X may be NULL).
+ * Returns their number.
+ */
+size_t gmf_archive_get(const gmf_archive *archive, double *F, size_t ldf,
+		double *X, size_t ldx)
+{
+	size_t n = archive->node[0].count, m = 0, i;
+	size_t *slots = malloc(sizeof(size_t) * (n > 0 ? n : 1));
+	const double *point;
+
+	if (slots == NULL)
+	{
+		return 0;
+	}
+	gmf_archive_gather(archive, 0, slots, &m);
+	for (i = 0; i < m; ++i)
+	{
+		point = gmf_archive_point(archive, slots[i]);
+		memcpy(F + i * ldf, point, sizeof(double) * archive->nobjs);
+		if (X != NULL)
+		{
+			memcpy(X + i * ldx, point + archive->nobjs,
+					sizeof(double) * archive->nreal);
+		}
+	}
+	free(slots);
+	return m;
+}
+
+/**
+ * Evaluates n points (rows of X) into the rows of F and offers them all.
+ * Returns 0 if the evaluation fails.
+ */
+int gmf_archive_evaluate(gmf_archive *archive, gmf_rwa_problem *problem,
+		size_t n, const double *X, size_t ldx, double *F, size_t ldf)
+{
+	if (!gmf_rwa_eval_batch(problem, n, X, ldx, F, ldf, gmf_row_major))
+	{
+		return 0;
+	}
+	gmf_archive_insert_batch(archive, n, F, ldf, X, ldx);
+	return 1;
+}
@@ -0,0 +1,56 @@
+/*
+ * gmf_archive.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+#ifndef GMF_ARCHIVE_H_
+#define GMF_ARCHIVE_H_
+
+#include <stddef.h>
+#include "gmf_dv_rwa.h"
+
+/*
+ * External archive of the non-dominated points seen so far (minimized
+ * objectives, with their decision vectors). An offered point is rejected
+ * if an archived point is no worse in every objective; otherwise the points
+ * it dominates are removed and it is stored.
+ *
+ * The points are indexed by a dominance tree: inner nodes split on one
+ * objective, leaves hold up to GMF_ARCHIVE_BUCKET points, and every node
+ * keeps the lower and upper corners of its points. The corners decide
+ * whole subtrees at once (lower corner not below the point: nothing there
+ * can dominate it; upper corner below it: everything there does), so an
+ * offer usually visits a few paths of the tree instead of the whole
+ * archive. Points and nodes live in flat pools indexed by position and
+ * recycled through free lists.
+ *
+ * With a capacity, the archive grows up to capacity plus a slack of 1/16
+ * and is then cut back to capacity by dropping the points of smallest
+ * crowding distance (NSGA-II), which keeps the extremes of every objective;
+ * the tree is rebuilt afterwards, so the cost is amortized over the slack.
+ *
+ * To archive every evaluation, offer each F right after gmf_test_problem:
+ *
+ *   gmf_test_problem(F, G, xr, xi, xb);
+ *   gmf_archive_insert(archive, F, xr);
+ *
+ * or evaluate through gmf_archive_evaluate. An archive is not thread-safe.
+ */
+#define GMF_ARCHIVE_BUCKET 16
+
+typedef struct gmf_archive gmf_archive;
+
+gmf_archive *gmf_archive_create(size_t nobjs, size_t nreal, size_t capacity);
+void gmf_archive_destroy(gmf_archive *archive);
+void gmf_archive_clear(gmf_archive *archive);
+size_t gmf_archive_size(const gmf_archive *archive);
+int gmf_archive_insert(gmf_archive *archive, const double *f, const double *x);
+int gmf_archive_dominated(const gmf_archive *archive, const double *f);
+size_t gmf_archive_insert_batch(gmf_archive *archive, size_t n,
+		const double *F, size_t ldf, const double *X, size_t ldx);
+size_t gmf_archive_get(const gmf_archive *archive, double *F, size_t ldf,
+		double *X, size_t ldx);
+int gmf_archive_evaluate(gmf_archive *archive, gmf_rwa_problem *problem,
+		size_t n, const double *X, size_t ldx, double *F, size_t ldf);
+
+#endif /* GMF_ARCHIVE_H_ */
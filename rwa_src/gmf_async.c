@@ -0,0 +1,486 @@
+/*
+ * gmf_async.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "gmf_global.h"
+#include "gmf_dv_rwa.h"
+#include "gmf_async.h"
+
+/**
+ * Points of a micro-batch and their tickets (consecutive) and objectives
+ */
+struct gmf_async_batch
+{
+	double *X;
+	double *F;
+	long long *tickets;
+	size_t n;
+	struct timespec oldest; /* submission of the first point */
+};
+
+struct gmf_async
+{
+	gmf_rwa_problem *problem;
+	size_t nreal;
+	size_t nobjs;
+	size_t batch;
+	long deadline;
+	gmf_async_done done;
+	void *context;
+	pthread_t dispatcher;
+
+	pthread_mutex_t lock;
+	pthread_cond_t submitted; /* dispatcher: points pending, flush, quit */
+	pthread_cond_t room; /* submitters: pending batch taken */
+	pthread_cond_t completed; /* pollers and flush: results delivered */
+	struct gmf_async_batch pending;
+	struct gmf_async_batch running;
+	long long next; /* ticket of the next submission */
+	long long delivered; /* tickets below are delivered */
+	long long urgent; /* tickets below are flushed */
+	size_t batches;
+	int busy; /* a batch is being evaluated */
+	int idle; /* the dispatcher sleeps with no timeout */
+	int run_inline; /* submitters run the batches they fill */
+	int quit;
+
+	/* completion queue, a ring of tickets and rows of objectives */
+	long long *tickets;
+	double *F;
+	size_t head;
+	size_t count;
+	size_t capacity;
+};
+
+static int gmf_async_batch_init(struct gmf_async_batch *batch, size_t points,
+		size_t nreal, size_t nobjs)
+{
+	batch->X = malloc(sizeof(double) * points * nreal);
+	batch->F = malloc(sizeof(double) * points * nobjs);
+	batch->tickets = malloc(sizeof(long long) * points);
+	batch->n = 0;
+	return batch->X != NULL && batch->F != NULL && batch->tickets != NULL;
+}
+
+static void gmf_async_batch_free(struct gmf_async_batch *batch)
+{
+	free(batch->X);
+	free(batch->F);
+	free(batch->tickets);
+	return;
+}
+
+/**
+ * Appends the running batch to the completion queue, growing the ring (made
+ * with room for a batch, so a poller that finds it empty never allocates)
+ */
+static int gmf_async_enqueue(gmf_async *async)
+{
+	const struct gmf_async_batch *batch = &async->running;
+	size_t capacity, i, k;
+	long long *tickets;
+	double *F;
+
+	if (async->capacity == 0 || async->count + batch->n > async->capacity)
+	{
+		capacity = async->capacity > 0 ? async->capacity : async->batch;
+		while (capacity < async->count + batch->n)
+		{
+			capacity *= 2;
+		}
+		tickets = malloc(sizeof(long long) * capacity);
+		F = malloc(sizeof(double) * capacity * async->nobjs);
+		if (tickets == NULL || F == NULL)
+		{
+			free(tickets);
+			free(F);
+			return gmf_false;
+		}
+		for (i = 0; i < async->count; ++i)
+		{
+			k = (async->head + i) % async->capacity;
+			tickets[i] = async->tickets[k];
+			memcpy(F + i * async->nobjs, async->F + k * async->nobjs,
+					sizeof(double) * async->nobjs);
+		}
+		free(async->tickets);
+		free(async->F);
+		async->tickets = tickets;
+		async->F = F;
+		async->head = 0;
+		async->capacity = capacity;
+	}
+	for (i = 0; i < batch->n; ++i)
+	{
+		k = (async->head + async->count + i) % async->capacity;
+		async->tickets[k] = batch->tickets[i];
+		memcpy(async->F + k * async->nobjs, batch->F + i * async->nobjs,
+				sizeof(double) * async->nobjs);
+	}
+	async->count += batch->n;
+	return gmf_true;
+}
+
+/**
+ * t = from + ns nanoseconds
+ */
+static void gmf_async_later(struct timespec *t, const struct timespec *from,
+		long ns)
+{
+	t->tv_sec = from->tv_sec + ns / 1000000000L;
+	t->tv_nsec = from->tv_nsec + ns % 1000000000L;
+	if (t->tv_nsec >= 1000000000L)
+	{
+		t->tv_sec += 1;
+		t->tv_nsec -= 1000000000L;
+	}
+	return;
+}
+
+/**
+ * Whether the pending points must go now: a full batch, a flush, the
+ * deadline of the oldest reached or the dispatcher quitting
+ */
+static int gmf_async_due(const gmf_async *async, struct timespec *due)
+{
+	const struct gmf_async_batch *pending = &async->pending;
+	struct timespec now;
+
+	if (pending->n >= async->batch || async->quit || async->deadline <= 0
+			|| pending->tickets[0] < async->urgent)
+	{
+		return gmf_true;
+	}
+	gmf_async_later(due, &pending->oldest, async->deadline);
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec > due->tv_sec
+			|| (now.tv_sec == due->tv_sec && now.tv_nsec >= due->tv_nsec);
+}
+
+/**
+ * Evaluates the pending points and delivers their results, in the
+ * dispatcher or in a poller; called and returns with the lock held
+ */
+static void gmf_async_run(gmf_async *async)
+{
+	struct gmf_async_batch swap = async->running;
+
+	async->running = async->pending;
+	async->pending = swap;
+	async->pending.n = 0;
+	async->busy = gmf_true;
+	async->batches++;
+	pthread_cond_broadcast(&async->room);
+	pthread_mutex_unlock(&async->lock);
+
+	gmf_rwa_eval_batch(async->problem, async->running.n, async->running.X,
+			async->nreal, async->running.F, async->nobjs, gmf_row_major);
+	if (async->done != NULL)
+	{
+		async->done(async->context, async->running.n, async->running.tickets,
+				async->running.F);
+	}
+
+	pthread_mutex_lock(&async->lock);
+	while (async->done == NULL && !gmf_async_enqueue(async))
+	{
+		/* out of memory: wait for the pollers to make room */
+		pthread_cond_wait(&async->room, &async->lock);
+	}
+	async->delivered += async->running.n;
+	async->running.n = 0;
+	async->busy = gmf_false;
+	pthread_cond_broadcast(&async->completed);
+	if (async->pending.n > 0)
+	{
+		pthread_cond_signal(&async->submitted);
+	}
+	return;
+}
+
+/**
+ * Dispatcher. While submissions keep coming it wakes every deadline to
+ * look at the pending points by itself, so submitters need not signal the
+ * first point of a batch; after a period without any it sleeps until
+ * signalled.
+ */
+static void *gmf_async_main(void *ptr)
+{
+	gmf_async *async = ptr;
+	long long seen = -1;
+	struct timespec due;
+
+	pthread_mutex_lock(&async->lock);
+	for (;;)
+	{
+		while (async->pending.n == 0 ? !async->quit
+				: async->busy || !gmf_async_due(async, &due))
+		{
+			if (async->pending.n > 0 && !async->busy)
+			{
+				pthread_cond_timedwait(&async->submitted, &async->lock, &due);
+			}
+			else if (!async->busy && async->deadline > 0
+					&& async->next != seen)
+			{
+				/* submissions since the last look: look again later */
+				seen = async->next;
+				clock_gettime(CLOCK_MONOTONIC, &due);
+				gmf_async_later(&due, &due, async->deadline);
+				pthread_cond_timedwait(&async->submitted, &async->lock, &due);
+			}
+			else
+			{
+				async->idle = gmf_true;
+				pthread_cond_wait(&async->submitted, &async->lock);
+				async->idle = gmf_false;
+			}
+		}
+		if (async->pending.n == 0)
+		{
+			break; /* quit with nothing pending */
+		}
+		gmf_async_run(async);
+	}
+	pthread_mutex_unlock(&async->lock);
+	return NULL;
+}
+
+/**
+ * Starts a dispatcher for the problem str_mop. Batches hold up to batch
+ * points (0 for 64) and wait at most deadline nanoseconds for more; done
+ * receives the results, or the completion queue if NULL.
+ */
+gmf_async *gmf_async_create(char *str_mop, size_t batch, long deadline,
+		gmf_async_done done, void *context)
+{
+	gmf_async *async = calloc(1, sizeof(gmf_async));
+	const struct gmf_rwa_entry *entry = gmf_rwa_lookup(str_mop);
+	pthread_condattr_t attr;
+
+	if (async == NULL || entry == NULL)
+	{
+		free(async);
+		return NULL;
+	}
+	async->nreal = entry->nreal;
+	async->nobjs = entry->nobjs;
+	async->batch = batch > 0 ? batch : 64;
+	async->deadline = deadline;
+	async->done = done;
+	async->context = context;
+	async->problem = gmf_rwa_create(str_mop);
+	if (async->problem == NULL
+			|| !gmf_async_batch_init(&async->pending, async->batch,
+					async->nreal, async->nobjs)
+			|| !gmf_async_batch_init(&async->running, async->batch,
+					async->nreal, async->nobjs)
+			|| (done == NULL && !gmf_async_enqueue(async)))
+	{
+		gmf_async_batch_free(&async->pending);
+		gmf_async_batch_free(&async->running);
+		gmf_rwa_destroy(async->problem);
+		free(async->tickets);
+		free(async->F);
+		free(async);
+		return NULL;
+	}
+
+	pthread_mutex_init(&async->lock, NULL);
+	pthread_condattr_init(&attr);
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+	pthread_cond_init(&async->submitted, &attr);
+	pthread_condattr_destroy(&attr);
+	pthread_cond_init(&async->room, NULL);
+	pthread_cond_init(&async->completed, NULL);
+	if (pthread_create(&async->dispatcher, NULL, gmf_async_main, async) != 0)
+	{
+		async->quit = gmf_true;
+		gmf_async_destroy(async);
+		return NULL;
+	}
+	return async;
+}
+
+/**
+ * Evaluates what is pending, stops the dispatcher and frees the results
+ * not polled
+ */
+void gmf_async_destroy(gmf_async *async)
+{
+	if (async == NULL)
+	{
+		return;
+	}
+	pthread_mutex_lock(&async->lock);
+	if (async->quit)
+	{
+		/* the dispatcher never started */
+		pthread_mutex_unlock(&async->lock);
+	}
+	else
+	{
+		async->quit = gmf_true;
+		pthread_cond_signal(&async->submitted);
+		pthread_mutex_unlock(&async->lock);
+		pthread_join(async->dispatcher, NULL);
+	}
+	pthread_mutex_destroy(&async->lock);
+	pthread_cond_destroy(&async->submitted);
+	pthread_cond_destroy(&async->room);
+	pthread_cond_destroy(&async->completed);
+	gmf_async_batch_free(&async->pending);
+	gmf_async_batch_free(&async->running);
+	gmf_rwa_destroy(async->problem);
+	free(async->tickets);
+	free(async->F);
+	free(async);
+	return;
+}
+
+/**
+ * Queues n points (rows of X, ldx apart) for evaluation. Returns the
+ * ticket of the first, the others follow it.
+ */
+long long gmf_async_submit(gmf_async *async, size_t n, const double *X,
+		size_t ldx)
+{
+	struct gmf_async_batch *pending = &async->pending;
+	long long first;
+	size_t i;
+
+	pthread_mutex_lock(&async->lock);
+	first = async->next;
+	for (i = 0; i < n; ++i)
+	{
+		while (pending->n == async->batch)
+		{
+			pthread_cond_signal(&async->submitted);
+			pthread_cond_wait(&async->room, &async->lock);
+		}
+		if (pending->n == 0)
+		{
+			clock_gettime(CLOCK_MONOTONIC, &pending->oldest);
+		}
+		memcpy(pending->X + pending->n * async->nreal, X + i * ldx,
+				sizeof(double) * async->nreal);
+		pending->tickets[pending->n++] = async->next++;
+		if (pending->n == async->batch && !async->busy && async->run_inline)
+		{
+			/* a full batch and nobody evaluating: run it here, no handover */
+			gmf_async_run(async);
+		}
+		else if (pending->n == async->batch && !async->busy)
+		{
+			/* a full batch the dispatcher may be waiting a deadline for */
+			pthread_cond_signal(&async->submitted);
+		}
+		else if (pending->n == 1 && (async->idle || async->deadline <= 0))
+		{
+			/* a first point nobody would look at */
+			pthread_cond_signal(&async->submitted);
+		}
+	}
+	pthread_mutex_unlock(&async->lock);
+	return first;
+}
+
+/**
+ * Moves up to max results, oldest first, into tickets and the rows of F
+ * (nobjs values each). Waits up to timeout nanoseconds for the first (no
+ * wait if 0, forever if negative). Returns the number moved.
+ */
+size_t gmf_async_poll(gmf_async *async, size_t max, long long *tickets,
+		double *F, long timeout)
+{
+	struct timespec due;
+	size_t n, i, k;
+
+	pthread_mutex_lock(&async->lock);
+	if (async->count == 0 && timeout != 0 && async->done == NULL)
+	{
+		clock_gettime(CLOCK_REALTIME, &due);
+		gmf_async_later(&due, &due, timeout > 0 ? timeout : 0);
+		while (async->count == 0 && async->delivered < async->next)
+		{
+			if (!async->busy && async->pending.n > 0)
+			{
+				/* nobody evaluating: run the batch here, no handover */
+				gmf_async_run(async);
+			}
+			else if (timeout < 0)
+			{
+				pthread_cond_wait(&async->completed, &async->lock);
+			}
+			else if (pthread_cond_timedwait(&async->completed, &async->lock,
+					&due) != 0)
+			{
+				break;
+			}
+		}
+	}
+	n = async->count < max ? async->count : max;
+	for (i = 0; i < n; ++i)
+	{
+		k = (async->head + i) % async->capacity;
+		tickets[i] = async->tickets[k];
+		memcpy(F + i * async->nobjs, async->F + k * async->nobjs,
+				sizeof(double) * async->nobjs);
+	}
+	if (n > 0)
+	{
+		async->head = (async->head + n) % async->capacity;
+		async->count -= n;
+		pthread_cond_broadcast(&async->room); /* a dispatcher out of memory */
+	}
+	pthread_mutex_unlock(&async->lock);
+	return n;
+}
+
+/**
+ * Dispatches the pending points now and waits until every point submitted
+ * so far is delivered
+ */
+void gmf_async_flush(gmf_async *async)
+{
+	pthread_mutex_lock(&async->lock);
+	async->urgent = async->next;
+	pthread_cond_signal(&async->submitted);
+	while (async->delivered < async->urgent)
+	{
+		pthread_cond_wait(&async->completed, &async->lock);
+	}
+	pthread_mutex_unlock(&async->lock);
+	return;
+}
+
+/**
+ * Lets a submitter that fills a batch while none is being evaluated run it
+ * itself (on != 0) instead of waking the dispatcher (the default)
+ */
+void gmf_async_set_inline(gmf_async *async, int on)
+{
+	pthread_mutex_lock(&async->lock);
+	async->run_inline = on != 0;
+	pthread_mutex_unlock(&async->lock);
+	return;
+}
+
+/**
+ * Micro-batches dispatched so far
+ */
+size_t gmf_async_batches(gmf_async *async)
+{
+	size_t batches;
+
+	pthread_mutex_lock(&async->lock);
+	batches = async->batches;
+	pthread_mutex_unlock(&async->lock);
+	return batches;
+}
@@ -9,8 +9,21 @@
 #include <assert.h>
 #include <string.h>
 #include <math.h>
+#include <stdatomic.h>
 
 #include "gmf_global.h"
+#include "gmf_dv_rwa.h"
+#include "gmf_stats.h"
+#include "gmf_extrema_tables.h"
+
+/* Problem kernels are always inlined, also into the SIMD variants below */
+#ifdef __GNUC__
+#define GMF_KERNEL static inline __attribute__((always_inline))
+#else
+#define GMF_KERNEL static inline
+#endif
+
+#include "gmf_poly_kernels.h"
 
 /**
  * According to the description in ref (Subasi et al., 2016)
@@ -18,32 +31,18 @@
  * 2 objectives
  * 5 variables
  */
-void Subasi2016_setup()
-{
-	gmf_mop.nobjs = 2;
-	gmf_mop.nreal = 5;
-	gmf_mop.xmin_real = malloc(sizeof(double) * gmf_mop.nreal);
-	gmf_mop.xmax_real = malloc(sizeof(double) * gmf_mop.nreal);
-	gmf_mop.xmin_real[0] = 20.0;
-	gmf_mop.xmin_real[1] = 6.0;
-	gmf_mop.xmin_real[2] = 20.0;
-	gmf_mop.xmin_real[3] = 0.0;
-	gmf_mop.xmin_real[4] = 8000.0;
-
-	gmf_mop.xmax_real[0] = 60.0;
-	gmf_mop.xmax_real[1] = 15.0;
-	gmf_mop.xmax_real[2] = 40.0;
-	gmf_mop.xmax_real[3] = 30.0;
-	gmf_mop.xmax_real[4] = 25000.0;
-	return;
-}
-void Subasi2016(double *F, double *G, double *xr, int *xi, int *xb)
+static const double Subasi2016_xmin[5] =
+{ 20.0, 6.0, 20.0, 0.0, 8000.0 };
+static const double Subasi2016_xmax[5] =
+{ 60.0, 15.0, 40.0, 30.0, 25000.0 };
+GMF_KERNEL void Subasi2016_eval(double *F, size_t incf, const double *xr,
+		size_t incx)
 {
 	double H = xr[0];
-	double t = xr[1];
-	double Sy = xr[2];
-	double theta = xr[3];
-	double Re = xr[4];
+	double t = xr[incx];
+	double Sy = xr[2 * incx];
+	double theta = xr[3 * incx];
+	double Re = xr[4 * incx];
 
 	double f;
 	double Nu;
@@ -59,7 +58,47 @@ void Subasi2016(double *F, double *G, double *xr, int *xi, int *xb)
 			- 2.761 * 10e-6 * t * Re - 4.400 * 10e-4 * Sy * theta
 			+ 9.714 * 10e-7 * Sy * Re + 6.777 * 10e-4 * H * H;
 	F[0] = -Nu;
-	F[1] = f;
+	F[incf] = f;
+}
+
+void Subasi2016(double *F, double *G, double *xr, int *xi, int *xb)
+{
+	Subasi2016_eval(F, 1, xr, 1);
+	return;
+}
+
+GMF_KERNEL void Subasi2016_jac(double *F, double *J, const double *xr)
+{
+	double H = xr[0];
+	double t = xr[1];
+	double Sy = xr[2];
+	double theta = xr[3];
+	double Re = xr[4];
+
+	Subasi2016_eval(F, 1, xr, 1);
+	/* Nu, negated */
+	J[0] = -0.300 - 0.0464 * t + 0.0244 * Sy - 0.0159 * theta
+			- 4.151 * 10e-5 * Re;
+	J[1] = 0.096 - 0.0464 * H - 0.1111 * Sy;
+	J[2] = 1.124 + 0.0244 * H - 0.1111 * t + 4.121 * 10e-5 * Re;
+	J[3] = 0.968 - 0.0159 * H - 4.192 * 10e-5 * Re;
+	J[4] = -4.148 * 10e-3 - 4.151 * 10e-5 * H + 4.121 * 10e-5 * Sy
+			- 4.192 * 10e-5 * theta;
+	/* f */
+	J[5] = -0.0181 - 8.851 * 10e-4 * Sy + 8.702 * 10e-4 * theta
+			+ 2 * 6.777 * 10e-4 * H;
+	J[6] = 0.0420 + 1.536 * 10e-3 * theta - 2.761 * 10e-6 * Re;
+	J[7] = 5.481 * 10e-3 - 8.851 * 10e-4 * H - 4.400 * 10e-4 * theta
+			+ 9.714 * 10e-7 * Re;
+	J[8] = -0.0191 + 8.702 * 10e-4 * H + 1.536 * 10e-3 * t - 4.400 * 10e-4 * Sy;
+	J[9] = -3.416 * 10e-6 - 2.761 * 10e-6 * t + 9.714 * 10e-7 * Sy;
+	return;
+}
+
+void Subasi2016_jacobian(double *F, double *J, double *xr)
+{
+	Subasi2016_jac(F, J, xr);
+	return;
 }
 
 /**
@@ -68,27 +107,18 @@ void Subasi2016(double *F, double *G, double *xr, int *xi, int *xb)
  * 3 objectives
  * 4 variables
  */
-void Goel2007_setup()
-{
-	int i;
-	gmf_mop.nobjs = 3;
-	gmf_mop.nreal = 4;
-	gmf_mop.xmin_real = malloc(sizeof(double) * gmf_mop.nreal);
-	gmf_mop.xmax_real = malloc(sizeof(double) * gmf_mop.nreal);
-	for (i = 0; i < gmf_mop.nreal; ++i)
-	{
-		gmf_mop.xmin_real[i] = 0.0;
-		gmf_mop.xmax_real[i] = 1.0;
-	}
-	return;
-}
+static const double Goel2007_xmin[4] =
+{ 0.0, 0.0, 0.0, 0.0 };
+static const double Goel2007_xmax[4] =
+{ 1.0, 1.0, 1.0, 1.0 };
 
-void Goel2007(double *F, double *G, double *xr, int *xi, int *xb)
+GMF_KERNEL void Goel2007_eval(double *F, size_t incf, const double *xr,
+		size_t incx)
 {
 	double a = xr[0];
-	double DHA = xr[1];
-	double DOA = xr[2];
-	double OPTT = xr[3];
+	double DHA = xr[incx];
+	double DOA = xr[2 * incx];
+	double OPTT = xr[3 * incx];
 	double Xcc;
 	double TFmax;
 	double TTmax;
@@ -114,8 +144,57 @@ void Goel2007(double *F, double *G, double *xr, int *xi, int *xb)
 			- 0.184 * OPTT * OPTT * a - 0.281 * DHA * a * DOA;
 
 	F[0] = Xcc;
-	F[1] = TFmax;
-	F[2] = TTmax;
+	F[incf] = TFmax;
+	F[2 * incf] = TTmax;
+	return;
+}
+
+void Goel2007(double *F, double *G, double *xr, int *xi, int *xb)
+{
+	Goel2007_eval(F, 1, xr, 1);
+	return;
+}
+
+GMF_KERNEL void Goel2007_jac(double *F, double *J, const double *xr)
+{
+	double a = xr[0];
+	double DHA = xr[1];
+	double DOA = xr[2];
+	double OPTT = xr[3];
+
+	Goel2007_eval(F, 1, xr, 1);
+	/* Xcc */
+	J[0] = -0.322 + 2 * 0.175 * a + 0.0185 * DHA - 0.251 * DOA + 0.0134 * OPTT;
+	J[1] = 0.396 + 0.0185 * a - 2 * 0.0701 * DHA + 0.179 * DOA + 0.0296 * OPTT;
+	J[2] = 0.424 - 0.251 * a + 0.179 * DHA + 2 * 0.0150 * DOA + 0.0752 * OPTT;
+	J[3] = 0.0226 + 0.0134 * a + 0.0296 * DHA + 0.0752 * DOA
+			+ 2 * 0.0192 * OPTT;
+	/* TFmax */
+	J[4] = 0.477 - 2 * 0.167 * a - 0.0129 * DHA - 0.0634 * DOA - 0.0521 * OPTT;
+	J[5] = -0.687 - 0.0129 * a + 2 * 0.0796 * DHA - 0.0257 * DOA
+			+ 0.00156 * OPTT;
+	J[6] = -0.080 - 0.0634 * a - 0.0257 * DHA + 2 * 0.0877 * DOA
+			+ 0.00198 * OPTT;
+	J[7] = -0.0650 - 0.0521 * a + 0.00156 * DHA + 0.00198 * DOA
+			+ 2 * 0.0184 * OPTT;
+	/* TTmax */
+	J[8] = -0.205 - 2 * 0.135 * a + 0.0141 * DHA + 0.208 * DOA + 0.353 * OPTT
+			+ 2 * 0.202 * DHA * a - 2 * 0.281 * DOA * a - 0.342 * DHA * DHA
+			- 0.184 * OPTT * OPTT - 0.281 * DHA * DOA;
+	J[9] = 0.0307 + 0.0141 * a + 2 * 0.0998 * DHA - 0.0301 * DOA
+			+ 0.202 * a * a - 2 * 0.342 * DHA * a - 2 * 0.245 * DHA * DOA
+			+ 0.281 * DOA * DOA - 0.281 * a * DOA;
+	J[10] = 0.108 + 0.208 * a - 0.0301 * DHA - 2 * 0.226 * DOA - 0.0497 * OPTT
+			- 0.281 * a * a - 0.245 * DHA * DHA + 2 * 0.281 * DOA * DHA
+			- 0.281 * DHA * a;
+	J[11] = 1.019 + 0.353 * a - 0.0497 * DOA - 2 * 0.423 * OPTT
+			- 2 * 0.184 * OPTT * a;
+	return;
+}
+
+void Goel2007_jacobian(double *F, double *J, double *xr)
+{
+	Goel2007_jac(F, J, xr);
 	return;
 }
 
@@ -125,30 +204,21 @@ void Goel2007(double *F, double *G, double *xr, int *xi, int *xb)
  * 3 objectives
  * 5 variables
  */
-void Liao2008_setup()
-{
-	int i;
-	gmf_mop.nobjs = 3;
-	gmf_mop.nreal = 5;
-	gmf_mop.xmin_real = malloc(sizeof(double) * gmf_mop.nreal);
-	gmf_mop.xmax_real = malloc(sizeof(double) * gmf_mop.nreal);
-	for (i = 0; i < gmf_mop.nreal; ++i)
-	{
-		gmf_mop.xmin_real[i] = 1.0;
-		gmf_mop.xmax_real[i] = 3.0;
-	}
-	return;
-}
-void Liao2008(double *F, double *G, double *xr, int *xi, int *xb)
+static const double Liao2008_xmin[5] =
+{ 1.0, 1.0, 1.0, 1.0, 1.0 };
+static const double Liao2008_xmax[5] =
+{ 3.0, 3.0, 3.0, 3.0, 3.0 };
+GMF_KERNEL void Liao2008_eval(double *F, size_t incf, const double *xr,
+		size_t incx)
 {
 	double Mass;
 	double Ain;
 	double Intrusion;
 	double t1 = xr[0];
-	double t2 = xr[1];
-	double t3 = xr[2];
-	double t4 = xr[3];
-	double t5 = xr[4];
+	double t2 = xr[incx];
+	double t3 = xr[2 * incx];
+	double t4 = xr[3 * incx];
+	double t5 = xr[4 * incx];
 	Mass = 1640.2823 + 2.3573285 * t1 + 2.3220035 * t2 + 4.5688768 * t3
 			+ 7.7213633 * t4 + 4.4559504 * t5;
 	Ain = 6.5856 + 1.15 * t1 - 1.0427 * t2 + 0.9738 * t3 + 0.8364 * t4
@@ -159,8 +229,50 @@ void Liao2008(double *F, double *G, double *xr, int *xi, int *xb)
 			- 0.0204 * t3 * t4 - 0.008 * t3 * t5 - 0.0241 * t2 * t2
 			+ 0.0109 * t4 * t4;
 	F[0] = Mass; /* Minimization */
-	F[1] = Ain; /* Minimization */
-	F[2] = Intrusion; /* Minimization */
+	F[incf] = Ain; /* Minimization */
+	F[2 * incf] = Intrusion; /* Minimization */
+	return;
+}
+
+void Liao2008(double *F, double *G, double *xr, int *xi, int *xb)
+{
+	Liao2008_eval(F, 1, xr, 1);
+	return;
+}
+
+GMF_KERNEL void Liao2008_jac(double *F, double *J, const double *xr)
+{
+	double t1 = xr[0];
+	double t2 = xr[1];
+	double t3 = xr[2];
+	double t4 = xr[3];
+	double t5 = xr[4];
+
+	Liao2008_eval(F, 1, xr, 1);
+	/* Mass */
+	J[0] = 2.3573285;
+	J[1] = 2.3220035;
+	J[2] = 4.5688768;
+	J[3] = 7.7213633;
+	J[4] = 4.4559504;
+	/* Ain */
+	J[5] = 1.15 - 0.3695 * t4 + 0.0861 * t5 - 2 * 0.1106 * t1;
+	J[6] = -1.0427 + 0.3628 * t4;
+	J[7] = 0.9738 - 2 * 0.3437 * t3;
+	J[8] = 0.8364 - 0.3695 * t1 + 0.3628 * t2 + 2 * 0.1764 * t4;
+	J[9] = 0.0861 * t1;
+	/* Intrusion */
+	J[10] = 0.0181 - 0.0073 * t2;
+	J[11] = 0.1024 - 0.0073 * t1 + 0.024 * t3 - 0.0118 * t4 - 2 * 0.0241 * t2;
+	J[12] = 0.0421 + 0.024 * t2 - 0.0204 * t4 - 0.008 * t5;
+	J[13] = -0.0118 * t2 - 0.0204 * t3 + 2 * 0.0109 * t4;
+	J[14] = -0.008 * t3;
+	return;
+}
+
+void Liao2008_jacobian(double *F, double *J, double *xr)
+{
+	Liao2008_jac(F, J, xr);
 	return;
 }
 
@@ -171,28 +283,17 @@ void Liao2008(double *F, double *G, double *xr, int *xi, int *xb)
  * 3 objectives
  * 3 variables
  */
-void Ganesan2013_setup()
-{
-	gmf_mop.nreal = 3;
-	gmf_mop.nobjs = 3;
-	gmf_mop.xmin_real = (double*) malloc(sizeof(double) * gmf_mop.nreal);
-	gmf_mop.xmax_real = (double*) malloc(sizeof(double) * gmf_mop.nreal);
-
-	gmf_mop.xmin_real[0] = 0.25;
-	gmf_mop.xmin_real[1] = 10000.0;
-	gmf_mop.xmin_real[2] = 600.0;
+static const double Ganesan2013_xmin[3] =
+{ 0.25, 10000.0, 600.0 };
+static const double Ganesan2013_xmax[3] =
+{ 0.55, 20000.0, 1100.0 };
 
-	gmf_mop.xmax_real[0] = 0.55;
-	gmf_mop.xmax_real[1] = 20000.0;
-	gmf_mop.xmax_real[2] = 1100.0;
-	return;
-}
-
-void Ganesan2013(double *F, double *G, double *xr, int *xi, int *xb)
+GMF_KERNEL void Ganesan2013_eval(double *F, size_t incf, const double *xr,
+		size_t incx)
 {
 	double O2CH4 = xr[0];
-	double GV = xr[1];
-	double T = xr[2];
+	double GV = xr[incx];
+	double T = xr[2 * incx];
 
 	double HC4_conversion, CO_selectivity, H2_CO_ratio;
 
@@ -212,8 +313,43 @@ void Ganesan2013(double *F, double *G, double *xr, int *xi, int *xb)
 							+ 0.167 * T * T * GV) + 0.18;
 
 	F[0] = -HC4_conversion; /* maximization */
-	F[1] = -CO_selectivity; /* maximization */
-	F[2] = H2_CO_ratio; /* minimization */
+	F[incf] = -CO_selectivity; /* maximization */
+	F[2 * incf] = H2_CO_ratio; /* minimization */
+	return;
+}
+
+void Ganesan2013(double *F, double *G, double *xr, int *xi, int *xb)
+{
+	Ganesan2013_eval(F, 1, xr, 1);
+	return;
+}
+
+GMF_KERNEL void Ganesan2013_jac(double *F, double *J, const double *xr)
+{
+	double O2CH4 = xr[0];
+	double GV = xr[1];
+	double T = xr[2];
+
+	Ganesan2013_eval(F, 1, xr, 1);
+	/* HC4_conversion, negated */
+	J[0] = 8.87e-6 * (14.6 + 3.14 * GV - 2 * 6.91 * O2CH4);
+	J[1] = 8.87e-6 * (-3.06 + 3.14 * O2CH4);
+	J[2] = 8.87e-6 * (18.82 - 2 * 13.31 * T);
+	/* CO_selectivity, negated */
+	J[3] = 2.152e-9 * (5.98 + 2.5 * GV - 2 * 3.9 * O2CH4 - 3.69 * GV * GV);
+	J[4] = 2.152e-9 * (-2.4 + 2.5 * O2CH4 + 1.64 * T - 2 * 3.69 * GV * O2CH4);
+	J[5] = 2.152e-9 * (13.06 + 1.64 * GV - 2 * 10.15 * T);
+	/* H2_CO_ratio */
+	J[6] = 4.425e-10 * (-0.112 * GV + 2 * 0.109 * O2CH4);
+	J[7] = 4.425e-10 * (-0.112 * O2CH4 - 0.142 * T + 0.167 * T * T);
+	J[8] = 4.425e-10 * (-0.45 - 0.142 * GV + 2 * 0.405 * T
+			+ 2 * 0.167 * T * GV);
+	return;
+}
+
+void Ganesan2013_jacobian(double *F, double *J, double *xr)
+{
+	Ganesan2013_jac(F, J, xr);
 	return;
 }
 
@@ -224,33 +360,18 @@ void Ganesan2013(double *F, double *G, double *xr, int *xi, int *xb)
  * 3 objectives
  * 5 variables
  */
-void Padhi2016_setup()
-{
-	gmf_mop.nobjs = 3;
-	gmf_mop.nreal = 5;
-	gmf_mop.xmin_real = malloc(sizeof(double) * gmf_mop.nreal);
-	gmf_mop.xmax_real = malloc(sizeof(double) * gmf_mop.nreal);
-
-	gmf_mop.xmin_real[0] = 1.0;
-	gmf_mop.xmin_real[1] = 10.0;
-	gmf_mop.xmin_real[2] = 850.0;
-	gmf_mop.xmin_real[3] = 20.0;
-	gmf_mop.xmin_real[4] = 4.0;
-
-	gmf_mop.xmax_real[0] = 1.4;
-	gmf_mop.xmax_real[1] = 26.0;
-	gmf_mop.xmax_real[2] = 1650.0;
-	gmf_mop.xmax_real[3] = 40.0;
-	gmf_mop.xmax_real[4] = 8.0;
-	return;
-}
-void Padhi2016(double *F, double *G, double *xr, int *xi, int *xb)
+static const double Padhi2016_xmin[5] =
+{ 1.0, 10.0, 850.0, 20.0, 4.0 };
+static const double Padhi2016_xmax[5] =
+{ 1.4, 26.0, 1650.0, 40.0, 8.0 };
+GMF_KERNEL void Padhi2016_eval(double *F, size_t incf, const double *xr,
+		size_t incx)
 {
 	double x1 = xr[0];
-	double x2 = xr[1];
-	double x3 = xr[2];
-	double x4 = xr[3];
-	double x5 = xr[4];
+	double x2 = xr[incx];
+	double x3 = xr[2 * incx];
+	double x4 = xr[3 * incx];
+	double x5 = xr[4 * incx];
 	double CR;
 	double Ra;
 	double DD;
@@ -274,8 +395,56 @@ void Padhi2016(double *F, double *G, double *xr, int *xi, int *xb)
 			- 3.312 * 1e-003 * x4 * x5;
 
 	F[0] = -CR; /* Maximization */
-	F[1] = Ra; /* Minimization */
-	F[2] = DD; /* Minimization */
+	F[incf] = Ra; /* Minimization */
+	F[2 * incf] = DD; /* Minimization */
+	return;
+}
+
+void Padhi2016(double *F, double *G, double *xr, int *xi, int *xb)
+{
+	Padhi2016_eval(F, 1, xr, 1);
+	return;
+}
+
+GMF_KERNEL void Padhi2016_jac(double *F, double *J, const double *xr)
+{
+	double x1 = xr[0];
+	double x2 = xr[1];
+	double x3 = xr[2];
+	double x4 = xr[3];
+	double x5 = xr[4];
+
+	Padhi2016_eval(F, 1, xr, 1);
+	/* CR, negated */
+	J[0] = -0.42 - 2 * 0.11 * x1 - 0.044 * x2 - 0.034 * x4 - 0.17 * x5;
+	J[1] = 0.27 - 0.044 * x1 + 0.028 * x4;
+	J[2] = -0.087 - 0.093 * x4;
+	J[3] = 0.19 - 2 * 0.036 * x4 - 0.034 * x1 + 0.028 * x2 - 0.093 * x3
+			+ 0.033 * x5;
+	J[4] = -0.18 + 2 * 0.025 * x5 - 0.17 * x1 + 0.033 * x4;
+	/* Ra */
+	J[5] = 0.26 + 2 * 0.036 * x1 + 0.11 * x3 - 0.077 * x4;
+	J[6] = -0.088 - 0.075 * x3 + 0.054 * x4;
+	J[7] = 0.037 + 0.11 * x1 - 0.075 * x2 + 0.090 * x5;
+	J[8] = -0.16 - 0.077 * x1 + 0.054 * x2 + 0.041 * x5;
+	J[9] = 0.069 + 0.090 * x3 + 0.041 * x4;
+	/* DD */
+	J[10] = 0.013 + 2 * 1.462 * 1e-003 * x1 - 0.011 * x2 - 6.188 * 1e-003 * x3
+			+ 8.937 * 1e-003 * x4 - 4.563 * 1e-003 * x5;
+	J[11] = -8.625 * 1e-003 - 2 * 6.635 * 1e-004 * x2 - 0.011 * x1 - 0.012 * x3
+			- 1.063 * 1e-003 * x4 + 2.438 * 1e-003 * x5;
+	J[12] = -5.458 * 1e-003 - 6.188 * 1e-003 * x1 - 0.012 * x2
+			- 1.937 * 1e-003 * x4 - 1.188 * 1e-003 * x5;
+	J[13] = -0.012 - 2 * 1.788 * 1e-003 * x4 + 8.937 * 1e-003 * x1
+			- 1.063 * 1e-003 * x2 - 1.937 * 1e-003 * x3 - 3.312 * 1e-003 * x5;
+	J[14] = -4.563 * 1e-003 * x1 + 2.438 * 1e-003 * x2 - 1.188 * 1e-003 * x3
+			- 3.312 * 1e-003 * x4;
+	return;
+}
+
+void Padhi2016_jacobian(double *F, double *J, double *xr)
+{
+	Padhi2016_jac(F, J, xr);
 	return;
 }
 
@@ -286,45 +455,24 @@ void Padhi2016(double *F, double *G, double *xr, int *xi, int *xb)
  * 3 objectives
  * 9 variables
  */
-void Gao2020_setup()
-{
-	gmf_mop.nobjs = 3;
-	gmf_mop.nreal = 9;
-	gmf_mop.xmin_real = malloc(sizeof(double) * gmf_mop.nreal);
-	gmf_mop.xmax_real = malloc(sizeof(double) * gmf_mop.nreal);
-
-	gmf_mop.xmin_real[0] = 40.0;
-	gmf_mop.xmin_real[1] = 0.35;
-	gmf_mop.xmin_real[2] = 333.0;
-	gmf_mop.xmin_real[3] = 20.0;
-	gmf_mop.xmin_real[4] = 3000.0;
-	gmf_mop.xmin_real[5] = 0.1;
-	gmf_mop.xmin_real[6] = 308.0;
-	gmf_mop.xmin_real[7] = 150.0;
-	gmf_mop.xmin_real[8] = 0.1;
-
-	gmf_mop.xmax_real[0] = 100.0;
-	gmf_mop.xmax_real[1] = 0.5;
-	gmf_mop.xmax_real[2] = 363.0;
-	gmf_mop.xmax_real[3] = 40.0;
-	gmf_mop.xmax_real[4] = 4000.0;
-	gmf_mop.xmax_real[5] = 3.0;
-	gmf_mop.xmax_real[6] = 328.0;
-	gmf_mop.xmax_real[7] = 200.0;
-	gmf_mop.xmax_real[8] = 2.0;
-	return;
-}
-void Gao2020(double *f, double *g, double *xr, int *xi, int *xb)
+static const double Gao2020_xmin[9] =
+{ 40.0, 0.35, 333.0, 20.0, 3000.0, 0.1, 308.0,
+		150.0, 0.1 };
+static const double Gao2020_xmax[9] =
+{ 100.0, 0.5, 363.0, 40.0, 4000.0, 3.0, 328.0,
+		200.0, 2.0 };
+GMF_KERNEL void Gao2020_eval(double *f, size_t incf, const double *xr,
+		size_t incx)
 {
 	double A = xr[0];
-	double B = xr[1];
-	double C = xr[2];
-	double D = xr[3];
-	double E = xr[4];
-	double F = xr[5];
-	double G = xr[6];
-	double H = xr[7];
-	double J = xr[8];
+	double B = xr[incx];
+	double C = xr[2 * incx];
+	double D = xr[3 * incx];
+	double E = xr[4 * incx];
+	double F = xr[5 * incx];
+	double G = xr[6 * incx];
+	double H = xr[7 * incx];
+	double J = xr[8 * incx];
 
 	double t_eff;
 	double Q_eff;
@@ -378,8 +526,106 @@ void Gao2020(double *f, double *g, double *xr, int *xi, int *xb)
 			- 7.56 * 10e-4 * J * J;
 
 	f[0] = t_eff; /* Minimize */
-	f[1] = -Q_eff; /* Maximize */
-	f[2] = -Phi_ex; /* Maximize */
+	f[incf] = -Q_eff; /* Maximize */
+	f[2 * incf] = -Phi_ex; /* Maximize */
+	return;
+}
+
+void Gao2020(double *F, double *G, double *xr, int *xi, int *xb)
+{
+	Gao2020_eval(F, 1, xr, 1);
+	return;
+}
+
+GMF_KERNEL void Gao2020_jac(double *f, double *jac, const double *xr)
+{
+	double A = xr[0];
+	double B = xr[1];
+	double C = xr[2];
+	double D = xr[3];
+	double E = xr[4];
+	double F = xr[5];
+	double G = xr[6];
+	double H = xr[7];
+	double J = xr[8];
+
+	Gao2020_eval(f, 1, xr, 1);
+	/* t_eff */
+	jac[0] = 23.25 - 0.47 * B - 0.30 * C - 6.22 * D - 0.62 * E - 42.48 * F
+			+ 3.11 * G + 4.45 * H - 0.22 * J + 2 * 3.64 * A;
+	jac[1] = -8.61 - 0.47 * A + 7.46 * C + 3.28 * D + 1.28 * E + 1.02 * F
+			- 4.02 * G - 2.29 * H - 0.16 * J - 2 * 0.99 * B;
+	jac[2] = -59.85 - 0.30 * A + 7.46 * B + 19.25 * D - 14.83 * E + 5.07 * F
+			- 37.61 * G - 9.11 * H - 0.32 * J + 2 * 30.5 * C;
+	jac[3] = -66.12 - 6.22 * A + 3.28 * B + 19.25 * C + 8.53 * E + 18.46 * F
+			- 14.28 * G - 7.05 * H - 0.24 * J + 2 * 21.63 * D;
+	jac[4] = -15.29 - 0.62 * A + 1.28 * B - 14.83 * C + 8.53 * D + 2.05 * F
+			+ 15.73 * G - 0.77 * H - 0.29 * J + 2 * 1.72 * E;
+	jac[5] = -83.32 - 42.48 * A + 1.02 * B + 5.07 * C + 18.46 * D + 2.05 * E
+			- 4.77 * G + 2.07 * H + 0.64 * J + 2 * 72.42 * F;
+	jac[6] = 37.72 + 3.11 * A - 4.02 * B - 37.61 * C - 14.28 * D + 15.73 * E
+			- 4.77 * F + 3.41 * H + 1.76 * J + 2 * 11.2 * G;
+	jac[7] = 12.67 + 4.45 * A - 2.29 * B - 9.11 * C - 7.05 * D - 0.77 * E
+			+ 2.07 * F + 3.41 * G + 0.48 * J + 2 * 1.86 * H;
+	jac[8] = 0.46 - 0.22 * A - 0.16 * B - 0.32 * C - 0.24 * D - 0.29 * E
+			+ 0.64 * F + 1.76 * G + 0.48 * H - 2 * 0.79 * J;
+	/* Q_eff, negated */
+	jac[9] = 1.22 - 2.94 * B + 2.96 * C - 0.66 * D - 0.09 * E + 0.43 * F
+			- 0.12 * G + 0.43 * H + 0.7 * J - 2 * 0.55 * A;
+	jac[10] = 19.56 - 2.94 * A - 8.05 * C - 0.53 * D - 4.43 * E + 0.6 * F
+			+ 0.46 * G + 4.97 * H - 0.046 * J + 2 * 4.97 * B;
+	jac[11] = -102.05 + 2.96 * A - 8.05 * B - 0.42 * D - 6.03 * E - 0.21 * F
+			- 2.63 * G - 0.17 * H + 0.43 * J + 2 * 0.47 * C;
+	jac[12] = 1.83 - 0.66 * A - 0.53 * B - 0.42 * C - 6.34 * E - 6.36 * F
+			- 0.19 * G + 0.22 * H - 0.39 * J + 2 * 0.91 * D;
+	jac[13] = -27.28 - 0.09 * A - 4.43 * B - 6.03 * C - 6.34 * D + 7.09 * F
+			- 3.06 * G + 0.15 * H - 0.68 * J + 2 * 2.08 * E;
+	jac[14] = -2.52 + 0.43 * A + 0.6 * B - 0.21 * C - 6.36 * D + 7.09 * E
+			+ 0.2 * G - 0.14 * H - 0.88 * J + 2 * 1.43 * F;
+	jac[15] = -5.43 - 0.12 * A + 0.46 * B - 2.63 * C - 0.19 * D - 3.06 * E
+			+ 0.2 * F - 0.45 * H + 0.014 * J - 2 * 0.43 * G;
+	jac[16] = -37.48 + 0.43 * A + 4.97 * B - 0.17 * C + 0.22 * D + 0.15 * E
+			- 0.14 * F - 0.45 * G - 0.99 * J - 2 * 1.06 * H;
+	jac[17] = -0.45 + 0.7 * A - 0.046 * B + 0.43 * C - 0.39 * D - 0.68 * E
+			- 0.88 * F + 0.014 * G - 0.99 * H - 2 * 0.98 * J;
+	/* Phi_ex, negated */
+	jac[18] = 9.26 * 10e-3 + 2.63 * 10e-3 * B - 1.34 * 10e-4 * C
+			+ 1.48 * 10e-3 * D + 7.04 * 10e-4 * E - 0.013 * F
+			- 6.55 * 10e-4 * G + 9.71 * 10e-3 * H - 1.08 * 10e-3 * J
+			+ 2 * 9.32 * 10e-4 * A;
+	jac[19] = -0.014 + 2.63 * 10e-3 * A - 2.54 * 10e-3 * C + 4.83 * 10e-4 * D
+			- 9.63 * 10e-4 * E - 1.21 * 10e-3 * F + 7.02 * 10e-3 * G
+			+ 1.21 * 10e-3 * H - 1.94 * 10e-5 * J + 2 * 7.61 * 10e-4 * B;
+	jac[20] = 0.029 - 1.34 * 10e-4 * A - 2.54 * 10e-3 * B + 1.15 * 10e-3 * D
+			- 3.60 * 10e-3 * E - 5.60 * 10e-3 * F + 0.026 * G
+			+ 4.01 * 10e-3 * H - 1.35 * 10e-3 * J - 2 * 0.016 * C;
+	jac[21] = 7.69 * 10e-4 + 1.48 * 10e-3 * A + 4.83 * 10e-4 * B
+			+ 1.15 * 10e-3 * C + 6.93 * 10e-3 * E + 3.16 * 10e-3 * F
+			+ 2.38 * 10e-4 * G - 7.32 * 10e-4 * H - 4.69 * 10e-4 * J
+			- 2 * 1.24 * 10e-3 * D;
+	jac[22] = -4.05 * 10e-3 + 7.04 * 10e-4 * A - 9.63 * 10e-4 * B
+			- 3.60 * 10e-3 * C + 6.93 * 10e-3 * D - 8.18 * 10e-3 * F
+			+ 5.74 * 10e-3 * G - 1.44 * 10e-4 * H + 9.95 * 10e-5 * J
+			- 2 * 9.61 * 10e-4 * E;
+	jac[23] = -0.029 - 0.013 * A - 1.21 * 10e-3 * B - 5.60 * 10e-3 * C
+			+ 3.16 * 10e-3 * D - 8.18 * 10e-3 * E + 2.09 * 10e-3 * G
+			+ 65 * 10e-4 * H + 1.99 * 10e-3 * J + 2 * 0.024 * F;
+	jac[24] = -0.075 - 6.55 * 10e-4 * A + 7.02 * 10e-3 * B + 0.026 * C
+			+ 2.38 * 10e-4 * D + 5.74 * 10e-3 * E + 2.09 * 10e-3 * F
+			- 4.95 * 10e-3 * H - 8.70 * 10e-4 * J + 2 * 8.63 * 10e-3 * G;
+	jac[25] = 0.012 + 9.71 * 10e-3 * A + 1.21 * 10e-3 * B + 4.01 * 10e-3 * C
+			- 7.32 * 10e-4 * D - 1.44 * 10e-4 * E + 65 * 10e-4 * F
+			- 4.95 * 10e-3 * G - 4.55 * 10e-4 * J + 2 * 1.90 * 10e-4 * H;
+	jac[26] = 1.04 * 10e-3 - 1.08 * 10e-3 * A - 1.94 * 10e-5 * B
+			- 1.35 * 10e-3 * C - 4.69 * 10e-4 * D + 9.95 * 10e-5 * E
+			+ 1.99 * 10e-3 * F - 8.70 * 10e-4 * G - 4.55 * 10e-4 * H
+			+ 2 * 7.56 * 10e-4 * J;
+	return;
+}
+
+void Gao2020_jacobian(double *F, double *J, double *xr)
+{
+	Gao2020_jac(F, J, xr);
 	return;
 }
 
@@ -390,31 +636,18 @@ void Gao2020(double *f, double *g, double *xr, int *xi, int *xb)
  * 3 objectives
  * 4 variables
  */
-void Xu2020_setup()
-{
-	gmf_mop.nobjs = 3;
-	gmf_mop.nreal = 4;
-	gmf_mop.xmin_real = malloc(sizeof(double) * gmf_mop.nreal);
-	gmf_mop.xmax_real = malloc(sizeof(double) * gmf_mop.nreal);
-
-	gmf_mop.xmin_real[0] = 12.56;
-	gmf_mop.xmin_real[1] = 0.02;
-	gmf_mop.xmin_real[2] = 1.0;
-	gmf_mop.xmin_real[3] = 0.5;
-
-	gmf_mop.xmax_real[0] = 25.12;
-	gmf_mop.xmax_real[1] = 0.06;
-	gmf_mop.xmax_real[2] = 5.0;
-	gmf_mop.xmax_real[3] = 2.0;
-	return;
-}
+static const double Xu2020_xmin[4] =
+{ 12.56, 0.02, 1.0, 0.5 };
+static const double Xu2020_xmax[4] =
+{ 25.12, 0.06, 5.0, 2.0 };
 
-void Xu2020(double *F, double *G, double *xr, int *xi, int *xb)
+GMF_KERNEL void Xu2020_eval(double *F, size_t incf, const double *xr,
+		size_t incx)
 {
 	double vc = xr[0];
-	double fz = xr[1];
-	double ap = xr[2];
-	double ae = xr[3];
+	double fz = xr[incx];
+	double ap = xr[2 * incx];
+	double ae = xr[3 * incx];
 
 	double Ft, Ra, MRR;
 	double d = 2.5;
@@ -432,8 +665,51 @@ void Xu2020(double *F, double *G, double *xr, int *xi, int *xb)
 	MRR = (1000.0 * vc * fz * z * ap * ae) / (M_PI * d);
 
 	F[0] = Ft; /* Minimization */
-	F[1] = Ra; /* Minimization */
-	F[2] = -MRR; /* Maximization */
+	F[incf] = Ra; /* Minimization */
+	F[2 * incf] = -MRR; /* Maximization */
+}
+
+void Xu2020(double *F, double *G, double *xr, int *xi, int *xb)
+{
+	Xu2020_eval(F, 1, xr, 1);
+	return;
+}
+
+GMF_KERNEL void Xu2020_jac(double *F, double *J, const double *xr)
+{
+	double vc = xr[0];
+	double fz = xr[1];
+	double ap = xr[2];
+	double ae = xr[3];
+	double d = 2.5;
+	double z = 1.0;
+	double c = 1000.0 * z / (M_PI * d);
+
+	Xu2020_eval(F, 1, xr, 1);
+	/* Ft */
+	J[0] = -1.18 - 18.9 * fz - 0.209 * ap - 0.673 * ae + 2 * 0.066 * vc;
+	J[1] = -2429 - 18.9 * vc + 265 * ap + 1209 * ae + 2 * 32117 * fz;
+	J[2] = 104.2 - 0.209 * vc + 265 * fz + 22.76 * ae - 2 * 16.98 * ap;
+	J[3] = 129.0 - 0.673 * vc + 1209 * fz + 22.76 * ap - 2 * 47.6 * ae;
+	/* Ra */
+	J[4] = -0.0072 - 0.198 * fz - 0.000955 * ap - 0.00656 * ae
+			+ 2 * 0.000355 * vc;
+	J[5] = 1.89 - 0.198 * vc + 0.209 * ap + 0.783 * ae + 2 * 35 * fz;
+	J[6] = -0.0203 - 0.000955 * vc + 0.209 * fz + 0.02275 * ae
+			+ 2 * 0.00037 * ap;
+	J[7] = 0.3075 - 0.00656 * vc + 0.783 * fz + 0.02275 * ap - 2 * 0.0791 * ae;
+	/* MRR, negated */
+	J[8] = -c * fz * ap * ae;
+	J[9] = -c * vc * ap * ae;
+	J[10] = -c * vc * fz * ae;
+	J[11] = -c * vc * fz * ap;
+	return;
+}
+
+void Xu2020_jacobian(double *F, double *J, double *xr)
+{
+	Xu2020_jac(F, J, xr);
+	return;
 }
 
 /**
@@ -443,27 +719,18 @@ void Xu2020(double *F, double *G, double *xr, int *xi, int *xb)
  * 4 objectives
  * 4 variables
  */
-void Vaidyanathan2004_setup()
-{
-	int i;
-	gmf_mop.nobjs = 4;
-	gmf_mop.nreal = 4;
-	gmf_mop.xmin_real = malloc(sizeof(double) * gmf_mop.nreal);
-	gmf_mop.xmax_real = malloc(sizeof(double) * gmf_mop.nreal);
-	for (i = 0; i < gmf_mop.nreal; ++i)
-	{
-		gmf_mop.xmin_real[i] = 0.0;
-		gmf_mop.xmax_real[i] = 1.0;
-	}
-	return;
-}
+static const double Vaidyanathan2004_xmin[4] =
+{ 0.0, 0.0, 0.0, 0.0 };
+static const double Vaidyanathan2004_xmax[4] =
+{ 1.0, 1.0, 1.0, 1.0 };
 
-void Vaidyanathan2004(double *F, double *G, double *xr, int *xi, int *xb)
+GMF_KERNEL void Vaidyanathan2004_eval(double *F, size_t incf, const double *xr,
+		size_t incx)
 {
 	double a = xr[0];
-	double DHA = xr[1];
-	double DOA = xr[2];
-	double OPTT = xr[3];
+	double DHA = xr[incx];
+	double DOA = xr[2 * incx];
+	double OPTT = xr[3 * incx];
 
 	double Xcc;
 	double TFmax;
@@ -500,9 +767,65 @@ void Vaidyanathan2004(double *F, double *G, double *xr, int *xi, int *xb)
 			- 0.184 * OPTT * OPTT * a - 0.281 * DHA * a * DOA;
 
 	F[0] = TFmax; /* Minimization */
-	F[1] = TW4; /* Minimization */
-	F[2] = TTmax; /* Minimization */
-	F[3] = Xcc; /* Minimization */
+	F[incf] = TW4; /* Minimization */
+	F[2 * incf] = TTmax; /* Minimization */
+	F[3 * incf] = Xcc; /* Minimization */
+	return;
+}
+
+void Vaidyanathan2004(double *F, double *G, double *xr, int *xi, int *xb)
+{
+	Vaidyanathan2004_eval(F, 1, xr, 1);
+	return;
+}
+
+GMF_KERNEL void Vaidyanathan2004_jac(double *F, double *J, const double *xr)
+{
+	double a = xr[0];
+	double DHA = xr[1];
+	double DOA = xr[2];
+	double OPTT = xr[3];
+
+	Vaidyanathan2004_eval(F, 1, xr, 1);
+	/* TFmax */
+	J[0] = 0.477 - 2 * 0.167 * a - 0.0129 * DHA - 0.0634 * DOA - 0.0521 * OPTT;
+	J[1] = -0.687 - 0.0129 * a + 2 * 0.0796 * DHA - 0.0257 * DOA
+			+ 0.00156 * OPTT;
+	J[2] = -0.080 - 0.0634 * a - 0.0257 * DHA + 2 * 0.0877 * DOA
+			+ 0.00198 * OPTT;
+	J[3] = -0.0650 - 0.0521 * a + 0.00156 * DHA + 0.00198 * DOA
+			+ 2 * 0.0184 * OPTT;
+	/* TW4 */
+	J[4] = 0.358 - 2 * 0.172 * a + 0.0106 * DHA - 0.146 * DOA - 0.0694 * OPTT;
+	J[5] = -0.807 + 0.0106 * a + 2 * 0.0697 * DHA - 0.0416 * DOA
+			- 0.00503 * OPTT;
+	J[6] = 0.0925 - 0.146 * a - 0.0416 * DHA + 2 * 0.102 * DOA + 0.0151 * OPTT;
+	J[7] = -0.0468 - 0.0694 * a - 0.00503 * DHA + 0.0151 * DOA
+			+ 2 * 0.0173 * OPTT;
+	/* TTmax */
+	J[8] = -0.205 - 2 * 0.135 * a + 0.0141 * DHA + 0.208 * DOA + 0.353 * OPTT
+			+ 2 * 0.202 * DHA * a - 2 * 0.281 * DOA * a - 0.342 * DHA * DHA
+			- 0.184 * OPTT * OPTT - 0.281 * DHA * DOA;
+	J[9] = 0.0307 + 0.0141 * a + 2 * 0.0998 * DHA - 0.0301 * DOA
+			+ 0.202 * a * a - 2 * 0.342 * DHA * a - 2 * 0.245 * DHA * DOA
+			+ 0.281 * DOA * DOA - 0.281 * a * DOA;
+	J[10] = 0.108 + 0.208 * a - 0.0301 * DHA - 2 * 0.226 * DOA - 0.0497 * OPTT
+			- 0.281 * a * a - 0.245 * DHA * DHA + 2 * 0.281 * DOA * DHA
+			- 0.281 * DHA * a;
+	J[11] = 1.019 + 0.353 * a - 0.0497 * DOA - 2 * 0.423 * OPTT
+			- 2 * 0.184 * OPTT * a;
+	/* Xcc */
+	J[12] = -0.322 + 2 * 0.175 * a + 0.0185 * DHA - 0.251 * DOA + 0.0134 * OPTT;
+	J[13] = 0.396 + 0.0185 * a - 2 * 0.0701 * DHA + 0.179 * DOA + 0.0296 * OPTT;
+	J[14] = 0.424 - 0.251 * a + 0.179 * DHA + 2 * 0.0150 * DOA + 0.0752 * OPTT;
+	J[15] = 0.0226 + 0.0134 * a + 0.0296 * DHA + 0.0752 * DOA
+			+ 2 * 0.0192 * OPTT;
+	return;
+}
+
+void Vaidyanathan2004_jacobian(double *F, double *J, double *xr)
+{
+	Vaidyanathan2004_jac(F, J, xr);
 	return;
 }
 
@@ -512,35 +835,19 @@ void Vaidyanathan2004(double *F, double *G, double *xr, int *xi, int *xb)
  * 5 objectives
  * 6 variables
  */
-void Chen2015_setup()
-{
-	gmf_mop.nobjs = 5;
-	gmf_mop.nreal = 6;
-	gmf_mop.xmin_real = malloc(sizeof(double) * gmf_mop.nreal);
-	gmf_mop.xmax_real = malloc(sizeof(double) * gmf_mop.nreal);
-	gmf_mop.xmin_real[0] = 17.5;
-	gmf_mop.xmin_real[1] = 17.5;
-	gmf_mop.xmin_real[2] = 2.0;
-	gmf_mop.xmin_real[3] = 2.0;
-	gmf_mop.xmin_real[4] = 5.0;
-	gmf_mop.xmin_real[5] = 5.0;
-
-	gmf_mop.xmax_real[0] = 22.5;
-	gmf_mop.xmax_real[1] = 22.5;
-	gmf_mop.xmax_real[2] = 3.0;
-	gmf_mop.xmax_real[3] = 3.0;
-	gmf_mop.xmax_real[4] = 7.0;
-	gmf_mop.xmax_real[5] = 6.0;
-	return;
-}
-void Chen2015(double *F, double *G, double *xr, int *xi, int *xb)
+static const double Chen2015_xmin[6] =
+{ 17.5, 17.5, 2.0, 2.0, 5.0, 5.0 };
+static const double Chen2015_xmax[6] =
+{ 22.5, 22.5, 3.0, 3.0, 7.0, 6.0 };
+GMF_KERNEL void Chen2015_eval(double *F, size_t incf, const double *xr,
+		size_t incx)
 {
 	double l1 = xr[0];
-	double w1 = xr[1];
-	double l2 = xr[2];
-	double w2 = xr[3];
-	double a1 = xr[4];
-	double b1 = xr[5];
+	double w1 = xr[incx];
+	double l2 = xr[2 * incx];
+	double w2 = xr[3 * incx];
+	double a1 = xr[4 * incx];
+	double b1 = xr[5 * incx];
 	double a2 = l1 * w1 * l2 * w2;
 	double b2 = l1 * w1 * l2 * a1;
 	double d2 = w1 * w2 * a1 * b1;
@@ -580,43 +887,126 @@ void Chen2015(double *F, double *G, double *xr, int *xi, int *xb)
 			+ 0.07 * (a2 - 6.0) * ((b2 - 5.5) / 0.5);
 
 	F[0] = F1; /* minimization */
-	F[1] = -F2; /* maximization */
-	F[2] = -F3; /* maximization */
-	F[3] = -F4; /* maximization */
-	F[4] = F5; /* minimization */
+	F[incf] = -F2; /* maximization */
+	F[2 * incf] = -F3; /* maximization */
+	F[3 * incf] = -F4; /* maximization */
+	F[4 * incf] = F5; /* minimization */
 	return;
 }
 
-/**
- * According to the description in ref (Ahmad et al., 2017)
- * "Multi-objective optimization in the development of oil and water repellent cellulose
- * fabric based on response surface methodology and the desirability function".
- * NOTE: The sign of the last term is chosen according to the worst scenario
- * for minimization and maximization in the corresponding objective function.
- *
- * 7 objectives
- * 3 variables
- */
-void Ahmad2017_setup()
+void Chen2015(double *F, double *G, double *xr, int *xi, int *xb)
 {
-	gmf_mop.nobjs = 7;
-	gmf_mop.nreal = 3;
-	gmf_mop.xmin_real = malloc(sizeof(double) * gmf_mop.nreal);
-	gmf_mop.xmax_real = malloc(sizeof(double) * gmf_mop.nreal);
-	gmf_mop.xmin_real[0] = 10.0;
-	gmf_mop.xmin_real[1] = 10.0;
-	gmf_mop.xmin_real[2] = 150.0;
+	Chen2015_eval(F, 1, xr, 1);
+	return;
+}
 
-	gmf_mop.xmax_real[0] = 50.0;
-	gmf_mop.xmax_real[1] = 50.0;
-	gmf_mop.xmax_real[2] = 170.0;
+GMF_KERNEL void Chen2015_jac(double *F, double *J, const double *xr)
+{
+	double l1 = xr[0];
+	double w1 = xr[1];
+	double l2 = xr[2];
+	double w2 = xr[3];
+	double a1 = xr[4];
+	double b1 = xr[5];
+	double a2 = l1 * w1 * l2 * w2;
+	double b2 = l1 * w1 * l2 * a1;
+	double L1 = (l1 - 20.0) / 2.5;
+	double W1 = (w1 - 20.0) / 0.5;
+	double L2 = (l2 - 2.5) / 0.5;
+	double W2 = (w2 - 2.5) / 0.5;
+	double A1 = a1 - 6.0;
+	double B1 = (b1 - 5.5) / 0.5;
+	double scale[6] =
+	{ 1.0 / 2.5, 1.0 / 0.5, 1.0 / 0.5, 1.0 / 0.5, 1.0, 1.0 / 0.5 };
+	double sign[5] =
+	{ 1.0, -1.0, -1.0, -1.0, 1.0 };
+	double da2[6] =
+	{ w1 * l2 * w2, l1 * l2 * w2, l1 * w1 * w2, l1 * w1 * l2, 0.0, 0.0 };
+	double db2[6] =
+	{ w1 * l2 * a1, l1 * l2 * a1, l1 * w1 * a1, 0.0, l1 * w1 * l2, 0.0 };
+	double dd2[6] =
+	{ 0.0, w2 * a1 * b1, 0.0, w1 * a1 * b1, w1 * w2 * b1, w1 * w2 * a1 };
+	double p[5][9] =
+	{
+	{ 0.0 } };
+	size_t k, j;
+
+	Chen2015_eval(F, 1, xr, 1);
+	/*
+	 * The objectives are quadratic in the scaled variables q = (L1, W1, L2,
+	 * W2, A1, B1, a2 - 11, (b2 - 6.5) / 0.5, (d2 - 12) / 0.5): p[k] holds
+	 * dF_k / dq (before the sign of F_k) and the chain rule goes through
+	 * the gradients of the products a2, b2 and d2.
+	 */
+	p[0][0] = 43.08;
+	p[0][1] = -27.18 - 36.19 * W2 - 39.44 * A1;
+	p[0][3] = -36.19 * W1;
+	p[0][4] = 47.75 - 39.44 * W1 + 57.45 * B1;
+	p[0][5] = 32.25 + 57.45 * A1;
+	p[0][6] = 31.67;
+
+	p[1][0] = 45.97;
+	p[1][1] = -52.93 + 47.23 * A1 - 40.61 * (a2 - 11.0);
+	p[1][4] = -78.93 + 47.23 * W1 - 50.62 * (a2 - 11.0);
+	p[1][6] = 79.22 - 40.61 * W1 - 50.62 * A1;
+
+	p[2][1] = -42.75;
+	p[2][4] = 56.67 - 35.09 * B1;
+	p[2][5] = 19.88 - 35.09 * A1 - 22.91 * (a2 - 11.0);
+	p[2][6] = -12.89 - 22.91 * B1;
+
+	p[3][0] = -0.06 + 0.03 * W1 - 0.02 * L2 + 0.02 * ((b2 - 6.5) / 0.5);
+	p[3][1] = 0.03 * L1;
+	p[3][2] = 0.03 - 0.02 * L1;
+	p[3][6] = 0.02;
+	p[3][7] = -0.02 + 0.02 * L1;
+	p[3][8] = -0.03;
+
+	/* (b2 - 5.5) / 0.5 moves with (b2 - 6.5) / 0.5 */
+	p[4][0] = -0.12;
+	p[4][1] = -0.26;
+	p[4][4] = 0.08 * ((b2 - 6.5) / 0.5);
+	p[4][6] = -0.05 + 0.07 * ((b2 - 5.5) / 0.5);
+	p[4][7] = -0.12 + 0.08 * A1 + 0.07 * (a2 - 6.0);
+
+	for (k = 0; k < 5; ++k)
+	{
+		for (j = 0; j < 6; ++j)
+		{
+			J[k * 6 + j] = sign[k]
+					* (p[k][j] * scale[j] + p[k][6] * da2[j]
+							+ (p[k][7] * db2[j] + p[k][8] * dd2[j]) / 0.5);
+		}
+	}
 	return;
 }
-void Ahmad2017(double *F, double *G, double *xr, int *xi, int *xb)
+
+void Chen2015_jacobian(double *F, double *J, double *xr)
+{
+	Chen2015_jac(F, J, xr);
+	return;
+}
+
+/**
+ * According to the description in ref (Ahmad et al., 2017)
+ * "Multi-objective optimization in the development of oil and water repellent cellulose
+ * fabric based on response surface methodology and the desirability function".
+ * NOTE: The sign of the last term is chosen according to the worst scenario
+ * for minimization and maximization in the corresponding objective function.
+ *
+ * 7 objectives
+ * 3 variables
+ */
+static const double Ahmad2017_xmin[3] =
+{ 10.0, 10.0, 150.0 };
+static const double Ahmad2017_xmax[3] =
+{ 50.0, 50.0, 170.0 };
+GMF_KERNEL void Ahmad2017_eval(double *F, size_t incf, const double *xr,
+		size_t incx)
 {
 	double X1 = xr[0];
-	double X2 = xr[1];
-	double X3 = xr[2];
+	double X2 = xr[incx];
+	double X3 = xr[2 * incx];
 
 	double WCA;
 	double OCA;
@@ -655,22 +1045,68 @@ void Ahmad2017(double *F, double *G, double *xr, int *xi, int *xb)
 			+ 0.20 * X2 * X2 - 2814.83;
 
 	F[0] = -WCA; /* maximization */
-	F[1] = -OCA; /* maximization */
-	F[2] = -AP; /* maximization */
-	F[3] = -CRA; /* maximization */
-	F[4] = Stiffness; /* minimization */
-	F[5] = -Tear; /* maximization */
-	F[6] = -Tensile; /* maximization */
+	F[incf] = -OCA; /* maximization */
+	F[2 * incf] = -AP; /* maximization */
+	F[3 * incf] = -CRA; /* maximization */
+	F[4 * incf] = Stiffness; /* minimization */
+	F[5 * incf] = -Tear; /* maximization */
+	F[6 * incf] = -Tensile; /* maximization */
+	return;
+}
+
+void Ahmad2017(double *F, double *G, double *xr, int *xi, int *xb)
+{
+	Ahmad2017_eval(F, 1, xr, 1);
+	return;
+}
+
+GMF_KERNEL void Ahmad2017_jac(double *F, double *J, const double *xr)
+{
+	double X1 = xr[0];
+	double X2 = xr[1];
+	double X3 = xr[2];
+
+	Ahmad2017_eval(F, 1, xr, 1);
+	/* WCA, negated */
+	J[0] = -1.99 + 2 * 0.02 * X1;
+	J[1] = -0.33;
+	J[2] = -17.12 + 2 * 0.05 * X3;
+	/* OCA, negated */
+	J[3] = -4.27 + 0.04 * X2 + 2 * 0.04 * X1;
+	J[4] = -1.50 + 0.04 * X1;
+	J[5] = -52.30 + 2 * 0.16 * X3;
+	/* AP, negated */
+	J[6] = 32.32 - 0.24 * X3 + 2 * 0.06 * X1;
+	J[7] = 24.56 - 0.19 * X3 + 2 * 0.10 * X2;
+	J[8] = 10.48 - 0.24 * X1 - 0.19 * X2;
+	/* CRA, negated */
+	J[9] = 1.556 - 2 * 0.03 * X1;
+	J[10] = -0.77;
+	J[11] = -31.14 + 2 * 0.10 * X3;
+	/* Stiffness */
+	J[12] = 0.02 - 0.001 * X2;
+	J[13] = -0.03 - 0.001 * X1 + 2 * 0.0009 * X2;
+	J[14] = -0.03;
+	/* Tear, negated */
+	J[15] = -14.246 + 2 * 0.22 * X1;
+	J[16] = -5.00 + 2 * 0.33 * X2;
+	J[17] = 4.30;
+	/* Tensile, negated */
+	J[18] = -3.55;
+	J[19] = -73.65 + 0.56 * X3 - 2 * 0.20 * X2;
+	J[20] = -10.80 + 0.56 * X2;
+	return;
+}
+
+void Ahmad2017_jacobian(double *F, double *J, double *xr)
+{
+	Ahmad2017_jac(F, J, xr);
 	return;
 }
 
 /** **************************************************************************
  * Setting benchmark
  ** **************************************************************************/
-char rwa_name[10][25] =
-{ "Subasi2016", "Goel2007", "Liao2008", "Ganesan2013", "Padhi2016", "Gao2020",
-		"Xu2020", "Vaidyanathan2004", "Chen2015", "Ahmad2017" };
-
 enum
 {
 	subasi2016,
@@ -698,39 +1134,633 @@ void (*rwa_mop[10])(double *F, double *G, double *xr, int *xi, int *xb) =
 	Ahmad2017
 };
 
-void (*rwa_setup[10])(double *F, double *G, double *xr, int *xi, int *xb) =
-{	Subasi2016_setup,
-	Goel2007_setup,
-	Liao2008_setup,
-	Ganesan2013_setup,
-	Padhi2016_setup,
-	Gao2020_setup,
-	Xu2020_setup,
-	Vaidyanathan2004_setup,
-	Chen2015_setup,
-	Ahmad2017_setup
+/*
+ * Sense of every objective in its original formulation. The problem
+ * functions negate the maximized ones, so all F components are minimized.
+ */
+#define MIN gmf_minimize
+#define MAX gmf_maximize
+static const int rwa_sense[10][7] =
+{
+{ MAX, MIN },
+{ MIN, MIN, MIN },
+{ MIN, MIN, MIN },
+{ MAX, MAX, MIN },
+{ MAX, MIN, MIN },
+{ MIN, MAX, MAX },
+{ MIN, MIN, MAX },
+{ MIN, MIN, MIN, MIN },
+{ MIN, MAX, MAX, MAX, MIN },
+{ MAX, MAX, MAX, MAX, MIN, MAX, MAX } };
+#undef MIN
+#undef MAX
+
+/*
+ * Static registry of the problems: everything gmf_rwa_describe needs, in
+ * read-only storage, so that describing a problem allocates nothing.
+ */
+#define GMF_RWA_ENTRY(mop, function, nobjs) \
+{ #mop, function, sizeof(mop##_xmin) / sizeof(double), nobjs, mop##_xmin, \
+		mop##_xmax, rwa_sense[function], #mop "-" #nobjs "objs.pof", \
+		rwa_ideal[function], rwa_nadir[function], rwa_worst[function] }
+
+static const struct gmf_rwa_entry rwa_registry[10] =
+{
+GMF_RWA_ENTRY(Subasi2016, subasi2016, 2),
+GMF_RWA_ENTRY(Goel2007, goel2007, 3),
+GMF_RWA_ENTRY(Liao2008, liao2008, 3),
+GMF_RWA_ENTRY(Ganesan2013, ganesan2013, 3),
+GMF_RWA_ENTRY(Padhi2016, padhi2016, 3),
+GMF_RWA_ENTRY(Gao2020, gao2020, 3),
+GMF_RWA_ENTRY(Xu2020, xu2020, 3),
+GMF_RWA_ENTRY(Vaidyanathan2004, vaidyanathan2004, 4),
+GMF_RWA_ENTRY(Chen2015, chen2015, 5),
+GMF_RWA_ENTRY(Ahmad2017, ahmad2017, 7) };
+
+/*
+ * Perfect hash of the names: (first character - length) mod 16 differs for
+ * all ten, and rwa_slot maps it back to the problem (-1 for none), so a
+ * lookup is one hash and one strcmp.
+ */
+#define GMF_RWA_HASH(name, length) (((unsigned) (name)[0] - (length)) & 15)
+
+static const signed char rwa_slot[16] =
+{ gao2020, -1, xu2020, -1, liao2008, -1, vaidyanathan2004, padhi2016,
+		ahmad2017, subasi2016, -1, chen2015, ganesan2013, -1, -1, goel2007 };
+
+/*
+ * Entry points installed as gmf_test_problem: they count the evaluations
+ * in gmf_mop.evaluations (and in gmf_stats when compiled in).
+ */
+#define GMF_RWA_COUNTED(mop, function) \
+static void mop##_counted(double *F, double *G, double *xr, int *xi, int *xb) \
+{ \
+	GMF_STATS_BEGIN(start); \
+	mop(F, G, xr, xi, xb); \
+	gmf_mop.evaluations++; \
+	GMF_STATS_END(function, 1, start); \
+	return; \
+}
+
+GMF_RWA_COUNTED(Subasi2016, subasi2016)
+GMF_RWA_COUNTED(Goel2007, goel2007)
+GMF_RWA_COUNTED(Liao2008, liao2008)
+GMF_RWA_COUNTED(Ganesan2013, ganesan2013)
+GMF_RWA_COUNTED(Padhi2016, padhi2016)
+GMF_RWA_COUNTED(Gao2020, gao2020)
+GMF_RWA_COUNTED(Xu2020, xu2020)
+GMF_RWA_COUNTED(Vaidyanathan2004, vaidyanathan2004)
+GMF_RWA_COUNTED(Chen2015, chen2015)
+GMF_RWA_COUNTED(Ahmad2017, ahmad2017)
+
+void (*rwa_counted[10])(double *F, double *G, double *xr, int *xi, int *xb) =
+{	Subasi2016_counted,
+	Goel2007_counted,
+	Liao2008_counted,
+	Ganesan2013_counted,
+	Padhi2016_counted,
+	Gao2020_counted,
+	Xu2020_counted,
+	Vaidyanathan2004_counted,
+	Chen2015_counted,
+	Ahmad2017_counted
+};
+
+
+/** **************************************************************************
+ * Batch evaluation
+ ** **************************************************************************/
+/**
+ * Evaluates n points. Element (i, j) of X is X[i * rsx + j * csx] and
+ * objective k of point i goes to F[i * rsf + k * csf]. The unit-stride case
+ * gets its own loop so the compiler can fold the strides into the kernel.
+ */
+#define GMF_RWA_BATCH(mop) \
+static void mop##_batch(size_t n, const double *X, size_t rsx, size_t csx, \
+		double *F, size_t rsf, size_t csf) \
+{ \
+	size_t i; \
+	if (csx == 1 && csf == 1) \
+	{ \
+		for (i = 0; i < n; ++i) \
+		{ \
+			mop##_eval(F + i * rsf, 1, X + i * rsx, 1); \
+		} \
+		return; \
+	} \
+	for (i = 0; i < n; ++i) \
+	{ \
+		mop##_eval(F + i * rsf, csf, X + i * rsx, csx); \
+	} \
+	return; \
+}
+
+GMF_RWA_BATCH(Subasi2016)
+GMF_RWA_BATCH(Goel2007)
+GMF_RWA_BATCH(Liao2008)
+GMF_RWA_BATCH(Ganesan2013)
+GMF_RWA_BATCH(Padhi2016)
+GMF_RWA_BATCH(Gao2020)
+GMF_RWA_BATCH(Xu2020)
+GMF_RWA_BATCH(Vaidyanathan2004)
+GMF_RWA_BATCH(Chen2015)
+GMF_RWA_BATCH(Ahmad2017)
+
+GMF_RWA_BATCH(Subasi2016_poly)
+GMF_RWA_BATCH(Goel2007_poly)
+GMF_RWA_BATCH(Liao2008_poly)
+GMF_RWA_BATCH(Ganesan2013_poly)
+GMF_RWA_BATCH(Padhi2016_poly)
+GMF_RWA_BATCH(Gao2020_poly)
+GMF_RWA_BATCH(Xu2020_poly)
+GMF_RWA_BATCH(Vaidyanathan2004_poly)
+GMF_RWA_BATCH(Chen2015_poly)
+GMF_RWA_BATCH(Ahmad2017_poly)
+
+void (*rwa_batch[10])(size_t n, const double *X, size_t rsx, size_t csx,
+		double *F, size_t rsf, size_t csf) =
+{	Subasi2016_batch,
+	Goel2007_batch,
+	Liao2008_batch,
+	Ganesan2013_batch,
+	Padhi2016_batch,
+	Gao2020_batch,
+	Xu2020_batch,
+	Vaidyanathan2004_batch,
+	Chen2015_batch,
+	Ahmad2017_batch
+};
+
+void (*rwa_poly_batch[10])(size_t n, const double *X, size_t rsx,
+		size_t csx, double *F, size_t rsf, size_t csf) =
+{	Subasi2016_poly_batch,
+	Goel2007_poly_batch,
+	Liao2008_poly_batch,
+	Ganesan2013_poly_batch,
+	Padhi2016_poly_batch,
+	Gao2020_poly_batch,
+	Xu2020_poly_batch,
+	Vaidyanathan2004_poly_batch,
+	Chen2015_poly_batch,
+	Ahmad2017_poly_batch
+};
+
+/*
+ * Single precision: the float kernels generated from the same tables, in
+ * the same layouts
+ */
+#define GMF_RWA_BATCHF(mop) \
+static void mop##_batchf(size_t n, const float *X, size_t rsx, size_t csx, \
+		float *F, size_t rsf, size_t csf) \
+{ \
+	size_t i; \
+	if (csx == 1 && csf == 1) \
+	{ \
+		for (i = 0; i < n; ++i) \
+		{ \
+			mop##_poly_evalf(F + i * rsf, 1, X + i * rsx, 1); \
+		} \
+		return; \
+	} \
+	for (i = 0; i < n; ++i) \
+	{ \
+		mop##_poly_evalf(F + i * rsf, csf, X + i * rsx, csx); \
+	} \
+	return; \
+}
+
+GMF_RWA_BATCHF(Subasi2016)
+GMF_RWA_BATCHF(Goel2007)
+GMF_RWA_BATCHF(Liao2008)
+GMF_RWA_BATCHF(Ganesan2013)
+GMF_RWA_BATCHF(Padhi2016)
+GMF_RWA_BATCHF(Gao2020)
+GMF_RWA_BATCHF(Xu2020)
+GMF_RWA_BATCHF(Vaidyanathan2004)
+GMF_RWA_BATCHF(Chen2015)
+GMF_RWA_BATCHF(Ahmad2017)
+
+void (*rwa_batchf[10])(size_t n, const float *X, size_t rsx, size_t csx,
+		float *F, size_t rsf, size_t csf) =
+{	Subasi2016_batchf,
+	Goel2007_batchf,
+	Liao2008_batchf,
+	Ganesan2013_batchf,
+	Padhi2016_batchf,
+	Gao2020_batchf,
+	Xu2020_batchf,
+	Vaidyanathan2004_batchf,
+	Chen2015_batchf,
+	Ahmad2017_batchf
+};
+
+/** **************************************************************************
+ * Jacobians
+ *
+ * mop##_jacobian(F, J, xr) evaluates F as the problem function does and, in
+ * the same pass, the nobjs x nreal Jacobian J, row k being the gradient of
+ * F[k] (J[k * nreal + j] = dF_k / dx_j). The derivatives are exact: every
+ * objective is a polynomial (Xu2020's MRR a single product) differentiated
+ * term by term, and the rows of the maximized objectives are negated like
+ * F itself.
+ ** **************************************************************************/
+#define GMF_RWA_JAC_BATCH(mop) \
+static void mop##_jac_batch(size_t n, const double *X, size_t ldx, \
+		double *F, size_t ldf, double *J, size_t ldj) \
+{ \
+	size_t i; \
+	for (i = 0; i < n; ++i) \
+	{ \
+		mop##_jac(F + i * ldf, J + i * ldj, X + i * ldx); \
+	} \
+	return; \
+}
+
+GMF_RWA_JAC_BATCH(Subasi2016)
+GMF_RWA_JAC_BATCH(Goel2007)
+GMF_RWA_JAC_BATCH(Liao2008)
+GMF_RWA_JAC_BATCH(Ganesan2013)
+GMF_RWA_JAC_BATCH(Padhi2016)
+GMF_RWA_JAC_BATCH(Gao2020)
+GMF_RWA_JAC_BATCH(Xu2020)
+GMF_RWA_JAC_BATCH(Vaidyanathan2004)
+GMF_RWA_JAC_BATCH(Chen2015)
+GMF_RWA_JAC_BATCH(Ahmad2017)
+
+GMF_RWA_JAC_BATCH(Subasi2016_poly)
+GMF_RWA_JAC_BATCH(Goel2007_poly)
+GMF_RWA_JAC_BATCH(Liao2008_poly)
+GMF_RWA_JAC_BATCH(Ganesan2013_poly)
+GMF_RWA_JAC_BATCH(Padhi2016_poly)
+GMF_RWA_JAC_BATCH(Gao2020_poly)
+GMF_RWA_JAC_BATCH(Xu2020_poly)
+GMF_RWA_JAC_BATCH(Vaidyanathan2004_poly)
+GMF_RWA_JAC_BATCH(Chen2015_poly)
+GMF_RWA_JAC_BATCH(Ahmad2017_poly)
+
+void (*rwa_jacobian[10])(double *F, double *J, double *xr) =
+{	Subasi2016_jacobian,
+	Goel2007_jacobian,
+	Liao2008_jacobian,
+	Ganesan2013_jacobian,
+	Padhi2016_jacobian,
+	Gao2020_jacobian,
+	Xu2020_jacobian,
+	Vaidyanathan2004_jacobian,
+	Chen2015_jacobian,
+	Ahmad2017_jacobian
+};
+
+void (*rwa_jac_batch[10])(size_t n, const double *X, size_t ldx, double *F,
+		size_t ldf, double *J, size_t ldj) =
+{	Subasi2016_jac_batch,
+	Goel2007_jac_batch,
+	Liao2008_jac_batch,
+	Ganesan2013_jac_batch,
+	Padhi2016_jac_batch,
+	Gao2020_jac_batch,
+	Xu2020_jac_batch,
+	Vaidyanathan2004_jac_batch,
+	Chen2015_jac_batch,
+	Ahmad2017_jac_batch
+};
+
+void (*rwa_poly_jac_batch[10])(size_t n, const double *X, size_t ldx,
+		double *F, size_t ldf, double *J, size_t ldj) =
+{	Subasi2016_poly_jac_batch,
+	Goel2007_poly_jac_batch,
+	Liao2008_poly_jac_batch,
+	Ganesan2013_poly_jac_batch,
+	Padhi2016_poly_jac_batch,
+	Gao2020_poly_jac_batch,
+	Xu2020_poly_jac_batch,
+	Vaidyanathan2004_poly_jac_batch,
+	Chen2015_poly_jac_batch,
+	Ahmad2017_poly_jac_batch
 };
 
-void gmf_clean_benchmark()
+/** **************************************************************************
+ * SIMD batch evaluation
+ *
+ * Column-major batches are structure-of-arrays input: variable j of points
+ * i..i+7 is contiguous, so the kernels above vectorize across points. Each
+ * kernel is compiled once more for AVX2 (4 points per instruction) and once
+ * for AVX-512F (8 points per instruction), and the widest variant supported
+ * by the running CPU is picked on first use. The single-precision kernels
+ * get twice as many points per instruction.
+ *
+ * Accuracy: the variants perform exactly the operations of the scalar
+ * kernel, in the same order and without FMA contraction (all objectives are
+ * built from +, -, * and, for Xu2020, one /), so the results are
+ * bit-identical to the scalar path (0 ULP). If the scalar code is itself
+ * built with FMA contraction enabled (e.g. -march=native), every contracted
+ * a * b + c saves one rounding and the difference per objective is bounded
+ * by 2 * k * DBL_EPSILON * (sum of |terms|), k being the number of terms.
+ ** **************************************************************************/
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GMF_RWA_SIMD
+#endif
+
+#ifdef GMF_RWA_SIMD
+#ifdef __clang__
+#define GMF_AVX2 __attribute__((target("avx2")))
+#define GMF_AVX512 __attribute__((target("avx512f")))
+#define GMF_IVDEP _Pragma("clang loop vectorize(enable)")
+#else
+#define GMF_AVX2 __attribute__((target("avx2"), \
+		optimize("tree-vectorize", "vect-cost-model=dynamic", "fp-contract=off")))
+#define GMF_AVX512 __attribute__((target("avx512f,prefer-vector-width=512"), \
+		optimize("tree-vectorize", "vect-cost-model=dynamic", "fp-contract=off")))
+#define GMF_IVDEP _Pragma("GCC ivdep")
+#endif
+
+#define GMF_RWA_SOA(mop, isa, attr) \
+static attr void mop##_soa_##isa(size_t n, const double *X, size_t ldx, \
+		double *F, size_t ldf) \
+{ \
+	size_t i; \
+	GMF_IVDEP \
+	for (i = 0; i < n; ++i) \
+	{ \
+		mop##_eval(F + i, ldf, X + i, ldx); \
+	} \
+	return; \
+}
+#define GMF_RWA_SOA_ALL(mop) \
+	GMF_RWA_SOA(mop, avx2, GMF_AVX2) \
+	GMF_RWA_SOA(mop, avx512, GMF_AVX512)
+#define GMF_RWA_SOAF(mop, isa, attr) \
+static attr void mop##_soaf_##isa(size_t n, const float *X, size_t ldx, \
+		float *F, size_t ldf) \
+{ \
+	size_t i; \
+	GMF_IVDEP \
+	for (i = 0; i < n; ++i) \
+	{ \
+		mop##_poly_evalf(F + i, ldf, X + i, ldx); \
+	} \
+	return; \
+}
+#define GMF_RWA_SOAF_ALL(mop) \
+	GMF_RWA_SOAF(mop, avx2, GMF_AVX2) \
+	GMF_RWA_SOAF(mop, avx512, GMF_AVX512)
+
+GMF_RWA_SOA_ALL(Subasi2016)
+GMF_RWA_SOA_ALL(Goel2007)
+GMF_RWA_SOA_ALL(Liao2008)
+GMF_RWA_SOA_ALL(Ganesan2013)
+GMF_RWA_SOA_ALL(Padhi2016)
+GMF_RWA_SOA_ALL(Gao2020)
+GMF_RWA_SOA_ALL(Xu2020)
+GMF_RWA_SOA_ALL(Vaidyanathan2004)
+GMF_RWA_SOA_ALL(Chen2015)
+GMF_RWA_SOA_ALL(Ahmad2017)
+
+GMF_RWA_SOA_ALL(Subasi2016_poly)
+GMF_RWA_SOA_ALL(Goel2007_poly)
+GMF_RWA_SOA_ALL(Liao2008_poly)
+GMF_RWA_SOA_ALL(Ganesan2013_poly)
+GMF_RWA_SOA_ALL(Padhi2016_poly)
+GMF_RWA_SOA_ALL(Gao2020_poly)
+GMF_RWA_SOA_ALL(Xu2020_poly)
+GMF_RWA_SOA_ALL(Vaidyanathan2004_poly)
+GMF_RWA_SOA_ALL(Chen2015_poly)
+GMF_RWA_SOA_ALL(Ahmad2017_poly)
+
+void (*rwa_soa[2][10])(size_t n, const double *X, size_t ldx, double *F,
+		size_t ldf) =
+{
+{	Subasi2016_soa_avx2,
+	Goel2007_soa_avx2,
+	Liao2008_soa_avx2,
+	Ganesan2013_soa_avx2,
+	Padhi2016_soa_avx2,
+	Gao2020_soa_avx2,
+	Xu2020_soa_avx2,
+	Vaidyanathan2004_soa_avx2,
+	Chen2015_soa_avx2,
+	Ahmad2017_soa_avx2 },
+{	Subasi2016_soa_avx512,
+	Goel2007_soa_avx512,
+	Liao2008_soa_avx512,
+	Ganesan2013_soa_avx512,
+	Padhi2016_soa_avx512,
+	Gao2020_soa_avx512,
+	Xu2020_soa_avx512,
+	Vaidyanathan2004_soa_avx512,
+	Chen2015_soa_avx512,
+	Ahmad2017_soa_avx512 } };
+
+void (*rwa_poly_soa[2][10])(size_t n, const double *X, size_t ldx,
+		double *F, size_t ldf) =
+{
+{	Subasi2016_poly_soa_avx2,
+	Goel2007_poly_soa_avx2,
+	Liao2008_poly_soa_avx2,
+	Ganesan2013_poly_soa_avx2,
+	Padhi2016_poly_soa_avx2,
+	Gao2020_poly_soa_avx2,
+	Xu2020_poly_soa_avx2,
+	Vaidyanathan2004_poly_soa_avx2,
+	Chen2015_poly_soa_avx2,
+	Ahmad2017_poly_soa_avx2 },
+{	Subasi2016_poly_soa_avx512,
+	Goel2007_poly_soa_avx512,
+	Liao2008_poly_soa_avx512,
+	Ganesan2013_poly_soa_avx512,
+	Padhi2016_poly_soa_avx512,
+	Gao2020_poly_soa_avx512,
+	Xu2020_poly_soa_avx512,
+	Vaidyanathan2004_poly_soa_avx512,
+	Chen2015_poly_soa_avx512,
+	Ahmad2017_poly_soa_avx512 } };
+
+GMF_RWA_SOAF_ALL(Subasi2016)
+GMF_RWA_SOAF_ALL(Goel2007)
+GMF_RWA_SOAF_ALL(Liao2008)
+GMF_RWA_SOAF_ALL(Ganesan2013)
+GMF_RWA_SOAF_ALL(Padhi2016)
+GMF_RWA_SOAF_ALL(Gao2020)
+GMF_RWA_SOAF_ALL(Xu2020)
+GMF_RWA_SOAF_ALL(Vaidyanathan2004)
+GMF_RWA_SOAF_ALL(Chen2015)
+GMF_RWA_SOAF_ALL(Ahmad2017)
+
+void (*rwa_soaf[2][10])(size_t n, const float *X, size_t ldx, float *F,
+		size_t ldf) =
+{
+{	Subasi2016_soaf_avx2,
+	Goel2007_soaf_avx2,
+	Liao2008_soaf_avx2,
+	Ganesan2013_soaf_avx2,
+	Padhi2016_soaf_avx2,
+	Gao2020_soaf_avx2,
+	Xu2020_soaf_avx2,
+	Vaidyanathan2004_soaf_avx2,
+	Chen2015_soaf_avx2,
+	Ahmad2017_soaf_avx2 },
+{	Subasi2016_soaf_avx512,
+	Goel2007_soaf_avx512,
+	Liao2008_soaf_avx512,
+	Ganesan2013_soaf_avx512,
+	Padhi2016_soaf_avx512,
+	Gao2020_soaf_avx512,
+	Xu2020_soaf_avx512,
+	Vaidyanathan2004_soaf_avx512,
+	Chen2015_soaf_avx512,
+	Ahmad2017_soaf_avx512 } };
+#endif
+
+/*
+ * The level supported by the CPU, detected once (every thread detects the
+ * same value, so a race only repeats the detection), and the level in use,
+ * -1 until forced. Both are published with a single store, so concurrent
+ * evaluations always see a valid level.
+ */
+static atomic_int rwa_simd_cpu = -1;
+static atomic_int rwa_simd = -1;
+
+static int gmf_rwa_simd_cpu()
+{
+	int level = atomic_load_explicit(&rwa_simd_cpu, memory_order_relaxed);
+
+	if (level < 0)
+	{
+		level = gmf_simd_scalar;
+#ifdef GMF_RWA_SIMD
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx512f"))
+		{
+			level = gmf_simd_avx512;
+		}
+		else if (__builtin_cpu_supports("avx2"))
+		{
+			level = gmf_simd_avx2;
+		}
+#endif
+		atomic_store_explicit(&rwa_simd_cpu, level, memory_order_relaxed);
+	}
+	return level;
+}
+
+/**
+ * Returns the SIMD level used by column-major batches
+ * (gmf_simd_scalar, gmf_simd_avx2 or gmf_simd_avx512).
+ */
+int gmf_rwa_simd_level()
+{
+	int level = atomic_load_explicit(&rwa_simd, memory_order_relaxed);
+
+	return level < 0 ? gmf_rwa_simd_cpu() : level;
+}
+
+/**
+ * Forces a SIMD level (e.g. gmf_simd_scalar to check against the reference).
+ * Levels above the one supported by the CPU are clamped.
+ */
+void gmf_rwa_set_simd_level(int level)
+{
+	int cpu = gmf_rwa_simd_cpu();
+
+	level = level < gmf_simd_scalar ? gmf_simd_scalar : level;
+	level = level > cpu ? cpu : level;
+	atomic_store_explicit(&rwa_simd, level, memory_order_relaxed);
+	return;
+}
+
+static atomic_int rwa_kernels = gmf_kernels_reference;
+
+/**
+ * Returns the kernels used by the batch evaluators
+ * (gmf_kernels_reference or gmf_kernels_generated).
+ */
+int gmf_rwa_kernels()
+{
+	return atomic_load_explicit(&rwa_kernels, memory_order_relaxed);
+}
+
+/**
+ * Selects the hand-written kernels (the default) or the ones generated from
+ * the monomial tables of gmf_poly.c (gmf_poly_kernels.h), which take fewer
+ * flops but round differently (see gmf_poly.h). Applies to gmf_rwa_evaluate
+ * and gmf_rwa_evaluate_jacobian; single evaluations always use the
+ * reference. Returns 0 for an unknown value.
+ */
+int gmf_rwa_set_kernels(int kernels)
 {
-	strcpy(gmf_mop.benchmarck, "");
-	strcpy(gmf_mop.name, "");
+	if (kernels != gmf_kernels_reference && kernels != gmf_kernels_generated)
+	{
+		return 0;
+	}
+	atomic_store_explicit(&rwa_kernels, kernels, memory_order_relaxed);
+	return 1;
+}
 
-	gmf_mop.nreal = 0;
-	gmf_mop.nint = 0;
-	gmf_mop.nbin = 0;
-	gmf_mop.ncons = 0;
-	gmf_mop.nobjs = 0;
-	gmf_mop.dynamic_flag = 0;
+static void gmf_rwa_evaluate_soa(int function, size_t n, const double *X,
+		size_t ldx, double *F, size_t ldf)
+{
+	int level = gmf_rwa_simd_level();
+#ifdef GMF_RWA_SIMD
+	if (level != gmf_simd_scalar)
+	{
+		if (gmf_rwa_kernels() == gmf_kernels_generated)
+		{
+			rwa_poly_soa[level - gmf_simd_avx2][function](n, X, ldx, F, ldf);
+			return;
+		}
+		rwa_soa[level - gmf_simd_avx2][function](n, X, ldx, F, ldf);
+		return;
+	}
+#endif
+	if (gmf_rwa_kernels() == gmf_kernels_generated)
+	{
+		rwa_poly_batch[function](n, X, 1, ldx, F, 1, ldf);
+		return;
+	}
+	rwa_batch[function](n, X, 1, ldx, F, 1, ldf);
+	return;
+}
+
+/* Directory of the POF reference sets, see gmf_rwa_set_pof_dir */
+static char rwa_pof_dir[200] = "../POF";
+
+void gmf_clean_benchmark(struct gmf_mop_desc *mop)
+{
+	strcpy(mop->benchmarck, "");
+	strcpy(mop->name, "");
+
+	mop->nreal = 0;
+	mop->nint = 0;
+	mop->nbin = 0;
+	mop->ncons = 0;
+	mop->nobjs = 0;
+	mop->dynamic_flag = 0;
+	mop->xmin_real = NULL;
+	mop->xmax_real = NULL;
+	mop->ideal = NULL;
+	mop->nadir = NULL;
+	mop->worst = NULL;
 	return;
 }
 
 /** **************************************************************************
  ** Random numbers
  ** **************************************************************************/
+/*
+ * Generator behind gmf_rnd_perc and gmf_rwa_rnd_solution. It is shared
+ * process state: threads should sample with their own gmf_rng stream.
+ */
+static gmf_rng rwa_rng = { { 0, 0 }, 0, 0 };
+
+void gmf_rnd_seed(uint64_t seed)
+{
+	gmf_rng_init(&rwa_rng, seed, 0);
+	return;
+}
+
 double gmf_rnd_perc(void)
 {
-	return (double) rand() / (double) RAND_MAX;
+	return gmf_rng_uniform(&rwa_rng);
 }
 
 double rnd_real(double lb, double ub)
@@ -749,30 +1779,105 @@ void gmf_rwa_rnd_solution(double *xr)
 	return;
 }
 
+/**
+ * Fills n random solutions of mop, one per row of X (ldx >= nreal), with the
+ * same values as n * nreal calls of gmf_rng_real on rng, row by row.
+ */
+void gmf_rwa_rnd_solutions(gmf_rng *rng, const struct gmf_mop_desc *mop,
+		size_t n, double *X, size_t ldx)
+{
+	size_t i, j, nreal = mop->nreal;
+	double *x;
+
+	if (ldx == nreal)
+	{
+		gmf_rng_uniform_fill(rng, n * nreal, X);
+	}
+	for (i = 0; i < n; ++i)
+	{
+		x = X + i * ldx;
+		if (ldx != nreal)
+		{
+			gmf_rng_uniform_fill(rng, nreal, x);
+		}
+		for (j = 0; j < nreal; ++j)
+		{
+			x[j] = mop->xmin_real[j] + x[j] * (mop->xmax_real[j] - mop->xmin_real[j]);
+		}
+	}
+	return;
+}
+
 /** **************************************************************************
  ** Settings functions
  ** **************************************************************************/
-void gmf_rwa_settings(int function)
+/**
+ * Fills a problem descriptor from the registry (the bounds and extrema
+ * point into it, nothing is allocated)
+ */
+static void gmf_rwa_describe(struct gmf_mop_desc *mop, int function)
 {
-	void (*gmf_rwa_setup)();
-	gmf_clean_benchmark();
-	gmf_rwa_setup = rwa_setup[function];
-	gmf_rwa_setup();
-	gmf_test_problem = rwa_mop[function];
+	const struct gmf_rwa_entry *entry = &rwa_registry[function];
+
+	gmf_clean_benchmark(mop);
+	mop->nreal = entry->nreal;
+	mop->nobjs = entry->nobjs;
+	mop->xmin_real = entry->xmin;
+	mop->xmax_real = entry->xmax;
+
+	strcpy(mop->name, entry->name);
+	strcpy(mop->benchmarck, "RWA");
+	mop->ideal = entry->ideal;
+	mop->nadir = entry->nadir;
+	mop->worst = entry->worst;
+	snprintf(mop->PF_file, sizeof(mop->PF_file), "%s/%s",
+			getenv("GMF_POF_DIR") != NULL ? getenv("GMF_POF_DIR") : rwa_pof_dir,
+			entry->pof);
+	sprintf(mop->PS_file, " ");
+
+	mop->evaluations = 0;
+	return;
+}
 
-	strcpy(gmf_mop.name, rwa_name[function]);
-	strcpy(gmf_mop.benchmarck, "RWA");
-	sprintf(gmf_mop.PF_file, " ");
-	sprintf(gmf_mop.PS_file, " ");
+/**
+ * Sets the directory holding the <name>-<nobjs>objs.pof reference sets used
+ * for PF_file (default "../POF"; the GMF_POF_DIR environment variable wins).
+ */
+void gmf_rwa_set_pof_dir(const char *dir)
+{
+	snprintf(rwa_pof_dir, sizeof(rwa_pof_dir), "%s", dir);
+	return;
+}
 
-	gmf_mop.evaluations = 0;
+/**
+ * Sense (gmf_minimize or gmf_maximize) of objective k of problem `function`
+ * in its original formulation, 0 if there is no such objective
+ */
+int gmf_rwa_sense(int function, size_t k)
+{
+	if (function < subasi2016 || function > ahmad2017
+			|| k >= rwa_registry[function].nobjs)
+	{
+		return 0;
+	}
+	return rwa_registry[function].sense[k];
+}
+
+void gmf_rwa_settings(int function)
+{
+	gmf_rwa_describe(&gmf_mop, function);
+	gmf_test_problem = rwa_counted[function];
 	return;
 }
 
+/**
+ * Releases the global problem. The descriptor points into the registry, so
+ * only the bounds are cleared.
+ */
 void gmf_rwa_setdown()
 {
-	free(gmf_mop.xmin_real);
-	free(gmf_mop.xmax_real);
+	gmf_mop.xmin_real = NULL;
+	gmf_mop.xmax_real = NULL;
 	return;
 }
 
@@ -785,22 +1890,328 @@ void gmf_rwa_display_benchmark()
 	printf("RWA:\t");
 	for (function = subasi2016; function <= ahmad2017; ++function)
 	{
-		printf("%s ", rwa_name[function]);
+		printf("%s ", rwa_registry[function].name);
 	}
 	printf("\n");
 	return;
 }
 
+/**
+ * Name of problem `function`, NULL if unknown
+ */
+const char *gmf_rwa_name(int function)
+{
+	if (function < subasi2016 || function > ahmad2017)
+	{
+		return NULL;
+	}
+	return rwa_registry[function].name;
+}
+
+/**
+ * Registry entry of problem `function`, NULL if unknown
+ */
+const struct gmf_rwa_entry *gmf_rwa_registry(int function)
+{
+	if (function < subasi2016 || function > ahmad2017)
+	{
+		return NULL;
+	}
+	return &rwa_registry[function];
+}
+
+/**
+ * Registry entry of the problem of the given name, NULL if unknown
+ */
+const struct gmf_rwa_entry *gmf_rwa_lookup(const char *str_mop)
+{
+	size_t length = strlen(str_mop);
+	int function;
+
+	if (length == 0)
+	{
+		return NULL;
+	}
+	function = rwa_slot[GMF_RWA_HASH(str_mop, length)];
+	if (function < 0 || strcmp(rwa_registry[function].name, str_mop) != 0)
+	{
+		return NULL;
+	}
+	return &rwa_registry[function];
+}
+
+int gmf_rwa_index(char *str_mop)
+{
+	const struct gmf_rwa_entry *entry = gmf_rwa_lookup(str_mop);
+	return entry != NULL ? entry->function : -1;
+}
+
 int gmf_rwa_setup(char *str_mop)
 {
+	int function = gmf_rwa_index(str_mop);
+	if (function < 0)
+	{
+		return 0;
+	}
+	gmf_rwa_settings(function);
+	return 1;
+}
+
+/**
+ * Evaluates n decision vectors of problem `function` (see gmf_rwa_index).
+ * X holds the points and F receives the objectives, both stored in the given
+ * order (gmf_row_major: one point per row, ldx >= nreal and ldf >= nobjs;
+ * gmf_col_major: one point per column, ldx >= n and ldf >= n).
+ * Column-major batches run on the SIMD kernels (see gmf_rwa_simd_level).
+ * Returns 0 if the problem or the storage order is unknown.
+ */
+int gmf_rwa_evaluate(int function, size_t n, const double *X, size_t ldx,
+		double *F, size_t ldf, int order)
+{
+	GMF_STATS_BEGIN(start);
+	if (function < subasi2016 || function > ahmad2017)
+	{
+		return 0;
+	}
+	if (order == gmf_row_major && gmf_rwa_kernels() == gmf_kernels_generated)
+	{
+		rwa_poly_batch[function](n, X, ldx, 1, F, ldf, 1);
+	}
+	else if (order == gmf_row_major)
+	{
+		rwa_batch[function](n, X, ldx, 1, F, ldf, 1);
+	}
+	else if (order == gmf_col_major)
+	{
+		gmf_rwa_evaluate_soa(function, n, X, ldx, F, ldf);
+	}
+	else
+	{
+		return 0;
+	}
+	GMF_STATS_END(function, n, start);
+	return 1;
+}
+
+/*
+ * Largest |F - F64| of the single-precision path for every objective,
+ * F64 being the double reference: measured over 10^7 uniform points of the
+ * box (the points rounded to float, as the caller passes them) and doubled;
+ * bench/bench_float.c -t prints it.
+ */
+static const double rwa_float_error[10][7] =
+{
+{ 0.00052, 1.4e-05 }, /* Subasi2016 */
+{ 4.7e-07, 3.8e-07, 5e-07 }, /* Goel2007 */
+{ 0.00068, 5.8e-06, 1.6e-07 }, /* Liao2008 */
+{ 7.4e-05, 1.3e-05, 7e-07 }, /* Ganesan2013 */
+{ 0.0044, 0.0014, 0.00032 }, /* Padhi2016 */
+{ 29, 27, 0.099 }, /* Gao2020 */
+{ 0.00021, 3e-07, 0.0006 }, /* Xu2020 */
+{ 3.8e-07, 4e-07, 5e-07, 4.7e-07 }, /* Vaidyanathan2004 */
+{ 0.093, 1.2, 0.2, 0.0005, 4.1 }, /* Chen2015 */
+{ 0.00067, 0.0018, 0.00086, 0.0011, 3.8e-06, 0.002, 0.0014 } /* Ahmad2017 */
+};
+
+/**
+ * Absolute error bound of objective k of the single-precision evaluation of
+ * problem `function` (see rwa_float_error), -1 if unknown
+ */
+double gmf_rwa_float_error(int function, size_t k)
+{
+	if (function < subasi2016 || function > ahmad2017 || k >= 7)
+	{
+		return -1;
+	}
+	return rwa_float_error[function][k];
+}
+
+/**
+ * gmf_rwa_evaluate for points and objectives of the given element type:
+ * gmf_float64 (double, the reference kernels) or gmf_float32 (float, the
+ * kernels generated from the monomial tables, within gmf_rwa_float_error
+ * of the reference). Returns 0 if the problem, storage order or type is
+ * unknown.
+ */
+int gmf_rwa_evaluate_typed(int function, size_t n, const void *X, size_t ldx,
+		void *F, size_t ldf, int order, int type)
+{
+	int level = gmf_rwa_simd_level();
+
+	if (type == gmf_float64)
+	{
+		return gmf_rwa_evaluate(function, n, X, ldx, F, ldf, order);
+	}
+	GMF_STATS_BEGIN(start);
+	if (type != gmf_float32 || function < subasi2016 || function > ahmad2017)
+	{
+		return 0;
+	}
+	if (order == gmf_row_major)
+	{
+		rwa_batchf[function](n, X, ldx, 1, F, ldf, 1);
+	}
+	else if (order != gmf_col_major)
+	{
+		return 0;
+	}
+#ifdef GMF_RWA_SIMD
+	else if (level != gmf_simd_scalar)
+	{
+		rwa_soaf[level - gmf_simd_avx2][function](n, X, ldx, F, ldf);
+	}
+#endif
+	else
+	{
+		rwa_batchf[function](n, X, 1, ldx, F, 1, ldf);
+	}
+	GMF_STATS_END(function, n, start);
+	return 1;
+}
+
+/**
+ * Evaluates n decision vectors of problem `function` together with their
+ * Jacobians. Point i is row i of X and F (ldx >= nreal, ldf >= nobjs) and its
+ * nobjs x nreal Jacobian, row-major, starts at J + i * ldj
+ * (ldj >= nobjs * nreal). Returns 0 if the problem is unknown.
+ */
+int gmf_rwa_evaluate_jacobian(int function, size_t n, const double *X,
+		size_t ldx, double *F, size_t ldf, double *J, size_t ldj)
+{
+	GMF_STATS_BEGIN(start);
+	if (function < subasi2016 || function > ahmad2017)
+	{
+		return 0;
+	}
+	if (gmf_rwa_kernels() == gmf_kernels_generated)
+	{
+		rwa_poly_jac_batch[function](n, X, ldx, F, ldf, J, ldj);
+	}
+	else
+	{
+		rwa_jac_batch[function](n, X, ldx, F, ldf, J, ldj);
+	}
+	GMF_STATS_END(function, n, start);
+	return 1;
+}
+
+/** **************************************************************************
+ ** Problem handles
+ **
+ ** A handle owns its own descriptor, so any number of problems can be alive
+ ** at once and evaluated from different threads. The evaluation counter is
+ ** atomic, so a single handle may also be shared between threads.
+ ** **************************************************************************/
+struct gmf_rwa_problem
+{
+	struct gmf_mop_desc mop;
 	int function;
-	for (function = subasi2016; function <= ahmad2017; ++function)
+	atomic_size_t evaluations;
+};
+
+gmf_rwa_problem *gmf_rwa_create(char *str_mop)
+{
+	gmf_rwa_problem *problem;
+	int function = gmf_rwa_index(str_mop);
+	if (function < 0)
 	{
-		if (strcmp(rwa_name[function], str_mop) == 0)
-		{
-			gmf_rwa_settings(function);
-			return 1;
-		}
+		return NULL;
+	}
+	problem = malloc(sizeof(gmf_rwa_problem));
+	if (problem == NULL)
+	{
+		return NULL;
+	}
+	gmf_rwa_describe(&problem->mop, function);
+	problem->function = function;
+	atomic_init(&problem->evaluations, 0);
+	return problem;
+}
+
+void gmf_rwa_destroy(gmf_rwa_problem *problem)
+{
+	if (problem == NULL)
+	{
+		return;
+	}
+	free(problem);
+	return;
+}
+
+const struct gmf_mop_desc *gmf_rwa_desc(const gmf_rwa_problem *problem)
+{
+	return &problem->mop;
+}
+
+int gmf_rwa_function(const gmf_rwa_problem *problem)
+{
+	return problem->function;
+}
+
+size_t gmf_rwa_evaluations(const gmf_rwa_problem *problem)
+{
+	return atomic_load_explicit(&problem->evaluations, memory_order_relaxed);
+}
+
+void gmf_rwa_reset_evaluations(gmf_rwa_problem *problem)
+{
+	atomic_store_explicit(&problem->evaluations, 0, memory_order_relaxed);
+	return;
+}
+
+/**
+ * Evaluates one decision vector xr (nreal values) into F (nobjs values)
+ */
+void gmf_rwa_eval(gmf_rwa_problem *problem, double *F, double *xr)
+{
+	GMF_STATS_BEGIN(start);
+	rwa_mop[problem->function](F, NULL, xr, NULL, NULL);
+	atomic_fetch_add_explicit(&problem->evaluations, 1, memory_order_relaxed);
+	GMF_STATS_END(problem->function, 1, start);
+	return;
+}
+
+/**
+ * Batch version of gmf_rwa_eval, see gmf_rwa_evaluate for the layout
+ */
+int gmf_rwa_eval_batch(gmf_rwa_problem *problem, size_t n, const double *X,
+		size_t ldx, double *F, size_t ldf, int order)
+{
+	if (!gmf_rwa_evaluate(problem->function, n, X, ldx, F, ldf, order))
+	{
+		return 0;
+	}
+	atomic_fetch_add_explicit(&problem->evaluations, n, memory_order_relaxed);
+	return 1;
+}
+
+/**
+ * Evaluates xr into F and its Jacobian into J (nobjs x nreal, row-major).
+ * Counts as one evaluation.
+ */
+void gmf_rwa_eval_jacobian(gmf_rwa_problem *problem, double *F, double *J,
+		double *xr)
+{
+	GMF_STATS_BEGIN(start);
+	rwa_jacobian[problem->function](F, J, xr);
+	atomic_fetch_add_explicit(&problem->evaluations, 1, memory_order_relaxed);
+	GMF_STATS_END(problem->function, 1, start);
+	return;
+}
+
+/**
+ * Batch version of gmf_rwa_eval_jacobian, see gmf_rwa_evaluate_jacobian for
+ * the layout
+ */
+int gmf_rwa_eval_jacobian_batch(gmf_rwa_problem *problem, size_t n,
+		const double *X, size_t ldx, double *F, size_t ldf, double *J,
+		size_t ldj)
+{
+	if (!gmf_rwa_evaluate_jacobian(problem->function, n, X, ldx, F, ldf, J,
+			ldj))
+	{
+		return 0;
 	}
-	return 0;
+	atomic_fetch_add_explicit(&problem->evaluations, n, memory_order_relaxed);
+	return 1;
 }
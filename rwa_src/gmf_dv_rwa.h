@@ -7,10 +7,75 @@
 #ifndef GMF_DV_RWA_H_
 #define GMF_DV_RWA_H_
 
+#include <stddef.h>
+#include "gmf_rng.h"
+
+struct gmf_mop_desc;
+
+/*
+ * Static, read-only registry of the problems. gmf_rwa_lookup finds the
+ * entry of a name with a perfect hash (one hash and one strcmp),
+ * gmf_rwa_registry the entry of an index; both return NULL if unknown.
+ * Descriptors filled by gmf_rwa_setup and gmf_rwa_create point into the
+ * registry for their bounds and extrema, so they allocate nothing.
+ */
+struct gmf_rwa_entry
+{
+	const char *name;
+	int function; /* index, as gmf_rwa_index */
+	size_t nreal;
+	size_t nobjs;
+	const double *xmin; /* box, nreal values */
+	const double *xmax;
+	const int *sense; /* gmf_minimize or gmf_maximize, as published */
+	const char *pof; /* reference set, in the POF directory */
+	const double *ideal; /* as gmf_mop_desc */
+	const double *nadir;
+	const double *worst;
+};
+
+const struct gmf_rwa_entry *gmf_rwa_lookup(const char *str_mop);
+const struct gmf_rwa_entry *gmf_rwa_registry(int function);
 
 void gmf_rwa_setdown();
 void gmf_rwa_display_benchmark();
 int gmf_rwa_setup(char *str_mop);
 void gmf_rwa_rnd_solution(double *xr);
+void gmf_rnd_seed(uint64_t seed);
+void gmf_rwa_rnd_solutions(gmf_rng *rng, const struct gmf_mop_desc *mop,
+		size_t n, double *X, size_t ldx);
+int gmf_rwa_index(char *str_mop);
+const char *gmf_rwa_name(int function);
+int gmf_rwa_sense(int function, size_t k);
+void gmf_rwa_set_pof_dir(const char *dir);
+int gmf_rwa_evaluate(int function, size_t n, const double *X, size_t ldx,
+		double *F, size_t ldf, int order);
+int gmf_rwa_evaluate_typed(int function, size_t n, const void *X, size_t ldx,
+		void *F, size_t ldf, int order, int type);
+double gmf_rwa_float_error(int function, size_t k);
+int gmf_rwa_evaluate_jacobian(int function, size_t n, const double *X,
+		size_t ldx, double *F, size_t ldf, double *J, size_t ldj);
+int gmf_rwa_simd_level();
+void gmf_rwa_set_simd_level(int level);
+int gmf_rwa_kernels();
+int gmf_rwa_set_kernels(int kernels);
+
+/* Reentrant problem handles */
+typedef struct gmf_rwa_problem gmf_rwa_problem;
+
+gmf_rwa_problem *gmf_rwa_create(char *str_mop);
+void gmf_rwa_destroy(gmf_rwa_problem *problem);
+const struct gmf_mop_desc *gmf_rwa_desc(const gmf_rwa_problem *problem);
+int gmf_rwa_function(const gmf_rwa_problem *problem);
+size_t gmf_rwa_evaluations(const gmf_rwa_problem *problem);
+void gmf_rwa_reset_evaluations(gmf_rwa_problem *problem);
+void gmf_rwa_eval(gmf_rwa_problem *problem, double *F, double *xr);
+int gmf_rwa_eval_batch(gmf_rwa_problem *problem, size_t n, const double *X,
+		size_t ldx, double *F, size_t ldf, int order);
+void gmf_rwa_eval_jacobian(gmf_rwa_problem *problem, double *F, double *J,
+		double *xr);
+int gmf_rwa_eval_jacobian_batch(gmf_rwa_problem *problem, size_t n,
+		const double *X, size_t ldx, double *F, size_t ldf, double *J,
+		size_t ldj);
 
 #endif /* GMF_DV_RWA_H_ */
@@ -0,0 +1,559 @@
+/*
+ * gmf_extrema.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+
+#include "gmf_global.h"
+#include "gmf_extrema.h"
+
+#define GMF_EXTREMA_MAXVARS 16
+#define GMF_EXTREMA_MAXOBJS 16
+#define GMF_EXTREMA_PAYOFF 1e-6 /* slack and tolerance of the payoff table */
+#define GMF_EXTREMA_PAYOFF_BOXES (1 << 16)
+
+/**
+ * Sub-box of the table's variables with a lower bound of the objective
+ */
+struct gmf_box
+{
+	double bound;
+	double lo[GMF_EXTREMA_MAXVARS];
+	double hi[GMF_EXTREMA_MAXVARS];
+};
+
+/**
+ * Search state: the objective sum_k w_k f_k, minimized over the points
+ * with f_c <= limit (no constraint if c is nobjs), the incumbent and a
+ * min-heap of boxes
+ */
+struct gmf_search
+{
+	const struct gmf_poly *poly;
+	double w[GMF_EXTREMA_MAXOBJS];
+	size_t c;
+	double limit;
+	double tol; /* absolute */
+	double best;
+	double x[GMF_EXTREMA_MAXVARS];
+	double pruned; /* lowest bound of the boxes dropped */
+	struct gmf_box *heap;
+	size_t size;
+	size_t capacity;
+	size_t boxes; /* bounded so far */
+	size_t maxboxes;
+};
+
+/**
+ * Range [a, b] of t^e for t in [lo, hi]
+ */
+static void gmf_pow_range(double lo, double hi, unsigned e, double *a,
+		double *b)
+{
+	double p = 1.0, q = 1.0;
+	unsigned i;
+
+	for (i = 0; i < e; ++i)
+	{
+		p *= lo;
+		q *= hi;
+	}
+	if (e % 2 == 0 && lo < 0.0 && hi > 0.0)
+	{
+		*a = 0.0;
+		*b = fmax(p, q);
+		return;
+	}
+	*a = fmin(p, q);
+	*b = fmax(p, q);
+	return;
+}
+
+/**
+ * [a, b] times [c, d] into [a, b]
+ */
+static void gmf_mul_range(double *a, double *b, double c, double d)
+{
+	double p = *a * c, q = *a * d, r = *b * c, t = *b * d;
+
+	*a = fmin(fmin(p, q), fmin(r, t));
+	*b = fmax(fmax(p, q), fmax(r, t));
+	return;
+}
+
+/**
+ * Range of monomial e over the box of the original variables [xl, xu],
+ * with the power of variable `skip` lowered by one (none if nvars)
+ */
+static void gmf_monomial_range(const unsigned char *e, size_t nvars,
+		size_t skip, const double *xl, const double *xu, double *a, double *b)
+{
+	double c, d;
+	size_t j;
+
+	*a = 1.0;
+	*b = 1.0;
+	for (j = 0; j < nvars; ++j)
+	{
+		if (e[j] - (j == skip) > 0)
+		{
+			gmf_pow_range(xl[j], xu[j], e[j] - (j == skip), &c, &d);
+			gmf_mul_range(a, b, c, d);
+		}
+	}
+	return;
+}
+
+/**
+ * Objective at point u, the incumbent updated if u is feasible
+ */
+static double gmf_search_point(struct gmf_search *search, const double *u)
+{
+	double F[GMF_EXTREMA_MAXOBJS], f = 0.0;
+	size_t k;
+
+	gmf_poly_evaluate(search->poly, 1, u, search->poly->nvars, F,
+			search->poly->nobjs);
+	for (k = 0; k < search->poly->nobjs; ++k)
+	{
+		f += search->w[k] * F[k];
+	}
+	if (f < search->best && (search->c == search->poly->nobjs
+			|| F[search->c] <= search->limit))
+	{
+		search->best = f;
+		memcpy(search->x, u, sizeof(double) * search->poly->nvars);
+	}
+	return f;
+}
+
+/**
+ * Lower bound of the objective over the box (see gmf_extrema.h), the
+ * enclosure of its gradient in G and its magnitude over the box in
+ * *magnitude. Evaluates the centre. INFINITY if the box lies beyond the
+ * constraint.
+ */
+static double gmf_search_bound(struct gmf_search *search,
+		const struct gmf_box *box, double *Gl, double *Gu, double *magnitude)
+{
+	const struct gmf_poly *poly = search->poly;
+	const size_t nvars = poly->nvars, nobjs = poly->nobjs;
+	double xl[GMF_EXTREMA_MAXVARS], xu[GMF_EXTREMA_MAXVARS];
+	double c[GMF_EXTREMA_MAXVARS], scale, coef, a, b, natural, centred;
+	double constraint = 0.0;
+	const unsigned char *e;
+	size_t t, j, k;
+
+	for (j = 0; j < nvars; ++j)
+	{
+		scale = poly->scale == NULL ? 1.0 : poly->scale[j];
+		xl[j] = poly->scale == NULL ? box->lo[j] : poly->shift[j]
+				+ scale * box->lo[j];
+		xu[j] = poly->scale == NULL ? box->hi[j] : poly->shift[j]
+				+ scale * box->hi[j];
+		c[j] = 0.5 * (box->lo[j] + box->hi[j]);
+		Gl[j] = 0.0;
+		Gu[j] = 0.0;
+	}
+	natural = 0.0;
+	*magnitude = 0.0;
+	for (t = 0; t < poly->nterms; ++t)
+	{
+		e = poly->power + t * nvars;
+		coef = 0.0;
+		for (k = 0; k < nobjs; ++k)
+		{
+			coef += search->w[k] * poly->coef[t * nobjs + k];
+		}
+		gmf_monomial_range(e, nvars, nvars, xl, xu, &a, &b);
+		if (search->c < nobjs)
+		{
+			constraint += fmin(poly->coef[t * nobjs + search->c] * a,
+					poly->coef[t * nobjs + search->c] * b);
+		}
+		if (coef == 0.0)
+		{
+			continue;
+		}
+		natural += fmin(coef * a, coef * b);
+		*magnitude += fabs(coef) * fmax(fabs(a), fabs(b));
+		for (j = 0; j < nvars; ++j)
+		{
+			if (e[j] > 0)
+			{
+				gmf_monomial_range(e, nvars, j, xl, xu, &a, &b);
+				scale = coef * e[j] * (poly->scale == NULL ? 1.0
+						: poly->scale[j]);
+				Gl[j] += fmin(scale * a, scale * b);
+				Gu[j] += fmax(scale * a, scale * b);
+			}
+		}
+	}
+
+	if (constraint > search->limit)
+	{
+		return INFINITY;
+	}
+
+	/* mean value form around the centre */
+	centred = gmf_search_point(search, c);
+	for (j = 0; j < nvars; ++j)
+	{
+		a = Gl[j];
+		b = Gu[j];
+		gmf_mul_range(&a, &b, box->lo[j] - c[j], box->hi[j] - c[j]);
+		centred += a;
+	}
+	return fmax(natural, centred) - 4.0 * DBL_EPSILON * poly->nterms
+			* *magnitude;
+}
+
+static int gmf_search_push(struct gmf_search *search,
+		const struct gmf_box *box)
+{
+	struct gmf_box *heap;
+	size_t i, parent;
+
+	if (box->bound >= search->best - search->tol)
+	{
+		search->pruned = fmin(search->pruned, box->bound);
+		return 1;
+	}
+	if (search->size == search->capacity)
+	{
+		heap = realloc(search->heap, sizeof(struct gmf_box)
+				* (search->capacity > 0 ? 2 * search->capacity : 256));
+		if (heap == NULL)
+		{
+			return 0;
+		}
+		search->heap = heap;
+		search->capacity = search->capacity > 0 ? 2 * search->capacity : 256;
+	}
+	for (i = search->size++; i > 0; i = parent)
+	{
+		parent = (i - 1) / 2;
+		if (search->heap[parent].bound <= box->bound)
+		{
+			break;
+		}
+		search->heap[i] = search->heap[parent];
+	}
+	search->heap[i] = *box;
+	return 1;
+}
+
+static void gmf_search_pop(struct gmf_search *search, struct gmf_box *box)
+{
+	struct gmf_box *heap = search->heap, *last;
+	size_t i = 0, child;
+
+	*box = heap[0];
+	last = &heap[--search->size];
+	for (child = 1; child < search->size; child = 2 * i + 1)
+	{
+		if (child + 1 < search->size
+				&& heap[child + 1].bound < heap[child].bound)
+		{
+			++child;
+		}
+		if (last->bound <= heap[child].bound)
+		{
+			break;
+		}
+		heap[i] = heap[child];
+		i = child;
+	}
+	heap[i] = *last;
+	return;
+}
+
+/**
+ * Moves the box onto the faces where the objective decreases along a
+ * variable of one-signed gradient (without a constraint, which the move
+ * could leave), bounds it and queues it
+ */
+static int gmf_search_box(struct gmf_search *search, struct gmf_box *box,
+		double *magnitude)
+{
+	double Gl[GMF_EXTREMA_MAXVARS], Gu[GMF_EXTREMA_MAXVARS];
+	size_t j, moved;
+
+	if (++search->boxes > search->maxboxes)
+	{
+		return 0;
+	}
+	box->bound = gmf_search_bound(search, box, Gl, Gu, magnitude);
+	moved = 0;
+	for (j = 0; j < search->poly->nvars && search->c == search->poly->nobjs
+			&& box->bound < INFINITY; ++j)
+	{
+		if (box->lo[j] < box->hi[j] && Gl[j] >= 0.0)
+		{
+			box->hi[j] = box->lo[j];
+			++moved;
+		}
+		else if (box->lo[j] < box->hi[j] && Gu[j] <= 0.0)
+		{
+			box->lo[j] = box->hi[j];
+			++moved;
+		}
+	}
+	if (moved > 0)
+	{
+		box->bound = fmax(box->bound, gmf_search_bound(search, box, Gl, Gu,
+				magnitude));
+	}
+	return gmf_search_push(search, box);
+}
+
+/**
+ * Minimum of the search objective over the table's box into *value (at
+ * search->x) and its lower bound into *bound; the incumbent may be seeded
+ */
+static int gmf_search_run(struct gmf_search *search, double tol,
+		double *value, double *bound)
+{
+	const struct gmf_poly *poly = search->poly;
+	const size_t nvars = poly->nvars;
+	struct gmf_box box, child;
+	double Gl[GMF_EXTREMA_MAXVARS], Gu[GMF_EXTREMA_MAXVARS];
+	double magnitude, width, widest;
+	size_t j, split;
+	int ok;
+
+	search->pruned = INFINITY;
+	memcpy(box.lo, poly->xmin, sizeof(double) * nvars);
+	memcpy(box.hi, poly->xmax, sizeof(double) * nvars);
+
+	/* the magnitude over the whole box sets the tolerance */
+	search->tol = INFINITY;
+	gmf_search_bound(search, &box, Gl, Gu, &magnitude);
+	search->tol = tol * magnitude;
+	ok = gmf_search_box(search, &box, &magnitude);
+
+	while (ok && search->size > 0)
+	{
+		gmf_search_pop(search, &box);
+		if (box.bound >= search->best - search->tol)
+		{
+			search->pruned = fmin(search->pruned, box.bound);
+			break;
+		}
+		split = nvars;
+		widest = 0.0;
+		for (j = 0; j < nvars; ++j)
+		{
+			width = (box.hi[j] - box.lo[j]) / (poly->xmax[j] - poly->xmin[j]);
+			if (width > widest)
+			{
+				widest = width;
+				split = j;
+			}
+		}
+		if (split == nvars)
+		{
+			continue;
+		}
+		child = box;
+		child.hi[split] = box.lo[split] = 0.5 * (box.lo[split]
+				+ box.hi[split]);
+		ok = gmf_search_box(search, &child, &magnitude)
+				&& gmf_search_box(search, &box, &magnitude);
+	}
+	if (search->size > 0)
+	{
+		search->pruned = fmin(search->pruned, search->heap[0].bound);
+	}
+	*value = search->best;
+	*bound = fmin(search->pruned, search->best);
+	free(search->heap);
+	search->heap = NULL;
+	search->size = 0;
+	search->capacity = 0;
+	return ok;
+}
+
+int gmf_poly_extremum(const struct gmf_poly *poly, size_t k, int sense,
+		double tol, double *x, double *value, double *bound)
+{
+	struct gmf_search search;
+	double s = sense == gmf_maximize ? -1.0 : 1.0;
+	int ok;
+
+	if (poly->nvars > GMF_EXTREMA_MAXVARS
+			|| poly->nobjs > GMF_EXTREMA_MAXOBJS || k >= poly->nobjs)
+	{
+		return 0;
+	}
+	memset(&search, 0, sizeof(search));
+	search.poly = poly;
+	search.w[k] = s;
+	search.c = poly->nobjs;
+	search.best = INFINITY;
+	search.maxboxes = GMF_EXTREMA_MAXBOXES;
+	ok = gmf_search_run(&search, tol, value, bound);
+	*value *= s;
+	*bound *= s;
+	if (x != NULL)
+	{
+		memcpy(x, search.x, sizeof(double) * poly->nvars);
+	}
+	return ok;
+}
+
+int gmf_poly_ideal_nadir(const struct gmf_poly *poly, double tol,
+		double *ideal, double *nadir, double *worst)
+{
+	const size_t nvars = poly->nvars, nobjs = poly->nobjs;
+	double x[GMF_EXTREMA_MAXOBJS][GMF_EXTREMA_MAXVARS];
+	double low[GMF_EXTREMA_MAXOBJS], high[GMF_EXTREMA_MAXOBJS];
+	double F[GMF_EXTREMA_MAXOBJS], value, bound;
+	struct gmf_search search;
+	size_t j, k;
+	int ok = 1;
+
+	if (nvars > GMF_EXTREMA_MAXVARS || nobjs > GMF_EXTREMA_MAXOBJS)
+	{
+		return 0;
+	}
+	for (k = 0; k < nobjs; ++k)
+	{
+		ok &= gmf_poly_extremum(poly, k, gmf_minimize, tol, x[k], &low[k],
+				&bound);
+		ok &= gmf_poly_extremum(poly, k, gmf_maximize, tol, NULL, &high[k],
+				&bound);
+	}
+
+	/*
+	 * Payoff table of Pareto-optimal minimizers: among the points within
+	 * tol of the range of f_k from its minimum, the one of least sum of
+	 * the other objectives scaled by their ranges.
+	 */
+	for (k = 0; k < nobjs; ++k)
+	{
+		memset(&search, 0, sizeof(search));
+		search.poly = poly;
+		for (j = 0; j < nobjs; ++j)
+		{
+			search.w[j] = j == k || high[j] <= low[j] ? 0.0
+					: 1.0 / (high[j] - low[j]);
+		}
+		search.c = k;
+		search.limit = low[k] + GMF_EXTREMA_PAYOFF * (high[k] - low[k]);
+		search.best = INFINITY;
+		search.maxboxes = GMF_EXTREMA_PAYOFF_BOXES;
+		gmf_search_point(&search, x[k]);
+		gmf_search_run(&search, GMF_EXTREMA_PAYOFF, &value, &bound);
+		gmf_poly_evaluate(poly, 1, search.x, nvars, F, nobjs);
+		for (j = 0; j < nobjs && nadir != NULL; ++j)
+		{
+			nadir[j] = k == 0 ? F[j] : fmax(nadir[j], F[j]);
+		}
+	}
+	for (k = 0; k < nobjs; ++k)
+	{
+		if (ideal != NULL)
+		{
+			ideal[k] = low[k];
+		}
+		if (worst != NULL)
+		{
+			worst[k] = high[k];
+		}
+	}
+	return ok;
+}
+
+void gmf_poly_bound(const struct gmf_poly *poly, const double *lo,
+		const double *hi, double *Flo, double *Fhi, double *Gl, double *Gu)
+{
+	const size_t nvars = poly->nvars, nobjs = poly->nobjs;
+	double xl[GMF_EXTREMA_MAXVARS], xu[GMF_EXTREMA_MAXVARS];
+	double c[GMF_EXTREMA_MAXVARS], Fc[GMF_EXTREMA_MAXOBJS];
+	double gl[GMF_EXTREMA_MAXOBJS * GMF_EXTREMA_MAXVARS];
+	double gu[GMF_EXTREMA_MAXOBJS * GMF_EXTREMA_MAXVARS];
+	double magnitude[GMF_EXTREMA_MAXOBJS], scale, coef, a, b, p, q, slack;
+	const unsigned char *e;
+	size_t t, j, k;
+
+	for (j = 0; j < nvars; ++j)
+	{
+		scale = poly->scale == NULL ? 1.0 : poly->scale[j];
+		xl[j] = poly->scale == NULL ? lo[j] : poly->shift[j] + scale * lo[j];
+		xu[j] = poly->scale == NULL ? hi[j] : poly->shift[j] + scale * hi[j];
+		c[j] = 0.5 * (lo[j] + hi[j]);
+	}
+	for (k = 0; k < nobjs; ++k)
+	{
+		Flo[k] = 0.0;
+		Fhi[k] = 0.0;
+		magnitude[k] = 0.0;
+		for (j = 0; j < nvars; ++j)
+		{
+			gl[k * nvars + j] = 0.0;
+			gu[k * nvars + j] = 0.0;
+		}
+	}
+
+	/* natural enclosure and gradient, term by term */
+	for (t = 0; t < poly->nterms; ++t)
+	{
+		e = poly->power + t * nvars;
+		gmf_monomial_range(e, nvars, nvars, xl, xu, &a, &b);
+		for (k = 0; k < nobjs; ++k)
+		{
+			coef = poly->coef[t * nobjs + k];
+			Flo[k] += fmin(coef * a, coef * b);
+			Fhi[k] += fmax(coef * a, coef * b);
+			magnitude[k] += fabs(coef) * fmax(fabs(a), fabs(b));
+		}
+		for (j = 0; j < nvars; ++j)
+		{
+			if (e[j] == 0)
+			{
+				continue;
+			}
+			gmf_monomial_range(e, nvars, j, xl, xu, &a, &b);
+			scale = e[j] * (poly->scale == NULL ? 1.0 : poly->scale[j]);
+			for (k = 0; k < nobjs; ++k)
+			{
+				coef = scale * poly->coef[t * nobjs + k];
+				gl[k * nvars + j] += fmin(coef * a, coef * b);
+				gu[k * nvars + j] += fmax(coef * a, coef * b);
+			}
+		}
+	}
+
+	/* mean value form around the centre, the tighter side of each */
+	gmf_poly_evaluate(poly, 1, c, nvars, Fc, nobjs);
+	for (k = 0; k < nobjs; ++k)
+	{
+		p = Fc[k];
+		q = Fc[k];
+		for (j = 0; j < nvars; ++j)
+		{
+			a = gl[k * nvars + j];
+			b = gu[k * nvars + j];
+			gmf_mul_range(&a, &b, lo[j] - c[j], hi[j] - c[j]);
+			p += a;
+			q += b;
+		}
+		slack = 4.0 * DBL_EPSILON * poly->nterms * magnitude[k];
+		Flo[k] = fmax(Flo[k], p) - slack;
+		Fhi[k] = fmin(Fhi[k], q) + slack;
+	}
+	if (Gl != NULL)
+	{
+		memcpy(Gl, gl, sizeof(double) * nobjs * nvars);
+	}
+	if (Gu != NULL)
+	{
+		memcpy(Gu, gu, sizeof(double) * nobjs * nvars);
+	}
+	return;
+}
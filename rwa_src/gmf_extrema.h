@@ -0,0 +1,64 @@
+/*
+ * gmf_extrema.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+#ifndef GMF_EXTREMA_H_
+#define GMF_EXTREMA_H_
+
+#include <stddef.h>
+#include "gmf_poly.h"
+
+/*
+ * Global extrema of the objectives of a monomial table over its box, by
+ * branch and bound. A box is bounded from below by the larger of two
+ * interval enclosures of the objective: term by term (every monomial's
+ * range over a box is exact, only their sum overestimates) and the mean
+ * value form f(c) + G (X - c), G enclosing the gradient, whose error
+ * shrinks quadratically with the box. A gradient component of one sign
+ * moves the box onto the face where the objective is smaller, the box
+ * with the lowest bound is bisected along its widest variable (relative to
+ * the problem's box), and the objective at the centres of the boxes gives
+ * the incumbent. The search stops when no box can beat the incumbent by
+ * more than tol times the magnitude of the objective over the whole box.
+ *
+ * gmf_poly_extremum finds the minimum (sense gmf_minimize) or maximum
+ * (gmf_maximize) of objective k: value is attained at x (may be NULL) and
+ * bound is a certified bound on the other side (below the minimum, above
+ * the maximum) to rounding. Returns 0 if memory runs out or the boxes
+ * to bound exceed GMF_EXTREMA_MAXBOXES, with the best value and bound found.
+ *
+ * gmf_poly_ideal_nadir gives, for every objective, the ideal point (the
+ * minimum over the box, which is the minimum over the Pareto front since
+ * the problems have no constraints), the largest value over the box
+ * (worst, a bound on the nadir point) and the nadir estimate of the
+ * payoff table: the largest value of the objective at Pareto-optimal
+ * minimizers of every objective (among the points within 1e-6 of the
+ * range of f_k from its minimum, the one of least sum of the other
+ * objectives scaled by their ranges, searched with a budget of boxes).
+ * Those points lie on the front, so the estimate is below the nadir point
+ * (equal to it for two objectives); with more objectives the front may
+ * reach beyond it (by up to half the range for Chen2015 and
+ * Ahmad2017 against their reference sets). Any of ideal, nadir and worst
+ * may be NULL.
+ *
+ * gmf_poly_bound is the interval variant of a problem: for the sub-box
+ * [lo, hi] of the table's variables it gives bounds Flo <= f <= Fhi of
+ * every objective over the box, the tighter of the term by term and
+ * the mean value enclosures on each side, widened by the rounding error
+ * of the sums. Gl and Gu (nobjs rows of nvars values, may be NULL) get the
+ * enclosure of the gradient, so that a variable along which no objective
+ * decreases can be fixed to its lower end (see gmf_front.h). The bounds
+ * are those of the table, which agrees with the published formulas to
+ * rounding (gmf_poly.h).
+ */
+#define GMF_EXTREMA_MAXBOXES (1 << 20)
+
+int gmf_poly_extremum(const struct gmf_poly *poly, size_t k, int sense,
+		double tol, double *x, double *value, double *bound);
+int gmf_poly_ideal_nadir(const struct gmf_poly *poly, double tol,
+		double *ideal, double *nadir, double *worst);
+void gmf_poly_bound(const struct gmf_poly *poly, const double *lo,
+		const double *hi, double *Flo, double *Fhi, double *Gl, double *Gu);
+
+#endif /* GMF_EXTREMA_H_ */
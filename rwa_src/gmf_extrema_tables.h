@@ -0,0 +1,93 @@
+/*
+ * gmf_extrema_tables.h
+ *
+ * Generated by tools/gmf_extremagen from the tables of gmf_poly.c, do not edit.
+ * Included by gmf_dv_rwa.c.
+ */
+#ifndef GMF_EXTREMA_TABLES_H_
+#define GMF_EXTREMA_TABLES_H_
+
+static const double rwa_ideal[10][7] =
+{
+/* Subasi2016 */
+{ -1896.4969999999998, -5.3408499999999988 },
+/* Goel2007 */
+{ 0.0048800000000010224, 0.0088934139111038167, -0.43150000000000011 },
+/* Liao2008 */
+{ 1661.7078224999998, 6.1427999999999994, 0.039399999999999935 },
+/* Ganesan2013 */
+{ -143.07139733143126, -47.412532811470975, 0.44571811503041536 },
+/* Padhi2016 */
+{ -6318.7056000000011, -2353.8559999999998, -687.1303800799999 },
+/* Gao2020 */
+{ 14390126.151125001, 7978248.9888000004, -121280.19920149999 },
+/* Xu2020 */
+{ 59.100354347444913, 0.14702261551717155, -1919.0266418248373 },
+/* Vaidyanathan2004 */
+{ 0.0088934139111038167, -0.013830000000000054, -0.43150000000000011,
+	0.0048800000000010224 },
+/* Chen2015 */
+{ 38592.040000000001, -1176773.3775000004, -45604.695000000065,
+	4.1900000000000546, 520427.02000000002 },
+/* Ahmad2017 */
+{ -185.03124999992565, -122.02624999985073, 4.3610000002381639,
+	-44.488999999462976, 3.6822222222224807, 6855.9966863638301,
+	168.66999999999996 }
+};
+
+static const double rwa_nadir[10][7] =
+{
+/* Subasi2016 */
+{ -1147.097, 27.903350000000003 },
+/* Goel2007 */
+{ 0.9565874322704061, 0.98949121294860753, 0.98753105595401369 },
+/* Liao2008 */
+{ 1695.2002034999998, 10.745400000000002, 0.26400000000000001 },
+/* Ganesan2013 */
+{ -42.518746990839247, -46.123441233470977, 1.9671535106824503 },
+/* Padhi2016 */
+{ -3204.0239999999999, -308.88143999999994, -360.89679527999999 },
+/* Gao2020 */
+{ 25891799.337499999, 19951622.7355, -50246.620916499982 },
+/* Xu2020 */
+{ 455.31855040000005, 0.35210811199999981, -32.292679482002924 },
+/* Vaidyanathan2004 */
+{ 0.98949121294860753, 0.94177920316772368, 1.0964999999999998,
+	0.9565874322704061 },
+/* Chen2015 */
+{ 143938.08749999999, 792849.79250000045, 43045.989999999991,
+	281.55999999999995, 6767897.0687500006 },
+/* Ahmad2017 */
+{ -143.39499631355989, -82.89849589250025, 174.71519287109368,
+	6.7600000000002183, 5.1737724304199215, 7600.3957165535539,
+	551.55728332519448 }
+};
+
+static const double rwa_worst[10][7] =
+{
+/* Subasi2016 */
+{ -328.58699999999999, 32.22186 },
+/* Goel2007 */
+{ 1.2435, 1.002, 1.0964999999999998 },
+/* Liao2008 */
+{ 1704.5588674999999, 11.712427842022876, 0.26400000000000001 },
+/* Ganesan2013 */
+{ -42.518746990839247, -45.884281190808437, 1.9671535108613396 },
+/* Padhi2016 */
+{ -1643.9840000000002, 291.95456000000001, -150.19519 },
+/* Gao2020 */
+{ 29520283.961600002, 20733925.832857266, -44771.443183464988 },
+/* Xu2020 */
+{ 483.85994810350542, 0.64850652799999997, -15.991888681873645 },
+/* Vaidyanathan2004 */
+{ 1.002, 1.0178255813953001, 1.0964999999999998, 1.2435 },
+/* Chen2015 */
+{ 144351.88750000001, 792849.79250000045, 162732.23999999999,
+	758.98500000000013, 6767897.0687500006 },
+/* Ahmad2017 */
+{ -117.83000000000015, -34.229999999999563, 281.93000000000018,
+	24.136133332997815, 5.5099999999999998, 7644.1599999999999,
+	692.66999999999916 }
+};
+
+#endif /* GMF_EXTREMA_TABLES_H_ */
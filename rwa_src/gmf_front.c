@@ -0,0 +1,222 @@
+/*
+ * gmf_front.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "gmf_global.h"
+#include "gmf_extrema.h"
+#include "gmf_front.h"
+
+#define GMF_FRONT_MAXVARS 16
+#define GMF_FRONT_MAXOBJS 16
+
+/**
+ * Generation of boxes, lower then upper corner (2 * nvars values a box)
+ */
+struct gmf_front_queue
+{
+	double *box;
+	size_t size;
+	size_t capacity;
+};
+
+static int gmf_front_push(struct gmf_front_queue *queue, const double *lo,
+		const double *hi, size_t nvars)
+{
+	double *box;
+
+	if (queue->size == queue->capacity)
+	{
+		box = realloc(queue->box, sizeof(double) * 2 * nvars
+				* (queue->capacity > 0 ? 2 * queue->capacity : 1024));
+		if (box == NULL)
+		{
+			return 0;
+		}
+		queue->box = box;
+		queue->capacity = queue->capacity > 0 ? 2 * queue->capacity : 1024;
+	}
+	box = queue->box + queue->size++ * 2 * nvars;
+	memcpy(box, lo, sizeof(double) * nvars);
+	memcpy(box + nvars, hi, sizeof(double) * nvars);
+	return 1;
+}
+
+/**
+ * Bounds the box into Flo, after fixing the variables along which no
+ * objective decreases to the end where all of them are smallest
+ */
+static void gmf_front_enclose(const struct gmf_poly *poly, double *lo,
+		double *hi, double *Flo)
+{
+	const size_t nvars = poly->nvars, nobjs = poly->nobjs;
+	double Fhi[GMF_FRONT_MAXOBJS], face[GMF_FRONT_MAXOBJS];
+	double Gl[GMF_FRONT_MAXOBJS * GMF_FRONT_MAXVARS];
+	double Gu[GMF_FRONT_MAXOBJS * GMF_FRONT_MAXVARS];
+	size_t j, k, up, down, moved = 0;
+
+	gmf_poly_bound(poly, lo, hi, Flo, Fhi, Gl, Gu);
+	for (j = 0; j < nvars; ++j)
+	{
+		up = 0;
+		down = 0;
+		for (k = 0; k < nobjs; ++k)
+		{
+			up += Gl[k * nvars + j] >= 0.0;
+			down += Gu[k * nvars + j] <= 0.0;
+		}
+		if (lo[j] < hi[j] && up == nobjs)
+		{
+			hi[j] = lo[j];
+			++moved;
+		}
+		else if (lo[j] < hi[j] && down == nobjs)
+		{
+			lo[j] = hi[j];
+			++moved;
+		}
+	}
+	if (moved > 0)
+	{
+		gmf_poly_bound(poly, lo, hi, face, Fhi, NULL, NULL);
+		for (k = 0; k < nobjs; ++k)
+		{
+			Flo[k] = fmax(Flo[k], face[k]);
+		}
+	}
+	return;
+}
+
+/**
+ * Bounds a batch of n boxes, offers their centres to the archive, then
+ * splits the boxes it does not cover into the next generation
+ */
+static int gmf_front_batch(const struct gmf_poly *poly, gmf_archive *archive,
+		const double *eps, double *box, size_t n, double *Flo, double *C,
+		double *F, struct gmf_front_queue *next, struct gmf_front_stats *stats)
+{
+	const size_t nvars = poly->nvars, nobjs = poly->nobjs;
+	double *lo, *hi, width, widest, mid;
+	size_t i, j, k, split;
+
+	for (i = 0; i < n; ++i)
+	{
+		lo = box + i * 2 * nvars;
+		hi = lo + nvars;
+		gmf_front_enclose(poly, lo, hi, Flo + i * nobjs);
+		for (j = 0; j < nvars; ++j)
+		{
+			C[i * nvars + j] = 0.5 * (lo[j] + hi[j]);
+		}
+		for (k = 0; k < nobjs; ++k)
+		{
+			Flo[i * nobjs + k] += eps[k];
+		}
+	}
+	gmf_poly_evaluate(poly, n, C, nvars, F, nobjs);
+	for (i = 0; i < n; ++i)
+	{
+		if (gmf_archive_insert(archive, F + i * nobjs, C + i * nvars) < 0)
+		{
+			return 0;
+		}
+	}
+	stats->boxes += n;
+	stats->evaluations += n;
+
+	for (i = 0; i < n; ++i)
+	{
+		lo = box + i * 2 * nvars;
+		hi = lo + nvars;
+		split = nvars;
+		widest = 0.0;
+		for (j = 0; j < nvars; ++j)
+		{
+			width = (hi[j] - lo[j]) / (poly->xmax[j] - poly->xmin[j]);
+			if (width > widest)
+			{
+				widest = width;
+				split = j;
+			}
+		}
+		if (split == nvars || gmf_archive_dominated(archive, Flo + i * nobjs))
+		{
+			++stats->pruned;
+			continue;
+		}
+		mid = 0.5 * (lo[split] + hi[split]);
+		width = hi[split];
+		hi[split] = mid;
+		if (!gmf_front_push(next, lo, hi, nvars))
+		{
+			return 0;
+		}
+		hi[split] = width;
+		lo[split] = mid;
+		if (!gmf_front_push(next, lo, hi, nvars))
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+int gmf_poly_front(const struct gmf_poly *poly, gmf_archive *archive,
+		const double *eps, size_t maxboxes, struct gmf_front_stats *stats)
+{
+	const size_t nvars = poly->nvars, nobjs = poly->nobjs;
+	struct gmf_front_queue queue[2], swap;
+	struct gmf_front_stats count;
+	double *Flo, *C, *F;
+	size_t i, n;
+	int ok;
+
+	if (nvars > GMF_FRONT_MAXVARS || nobjs > GMF_FRONT_MAXOBJS)
+	{
+		return 0;
+	}
+	memset(queue, 0, sizeof(queue));
+	memset(&count, 0, sizeof(count));
+	Flo = malloc(sizeof(double) * GMF_FRONT_BATCH * nobjs);
+	C = malloc(sizeof(double) * GMF_FRONT_BATCH * nvars);
+	F = malloc(sizeof(double) * GMF_FRONT_BATCH * nobjs);
+	ok = Flo != NULL && C != NULL && F != NULL
+			&& gmf_front_push(&queue[0], poly->xmin, poly->xmax, nvars);
+
+	while (ok && queue[0].size > 0)
+	{
+		if (maxboxes > 0 && count.boxes + queue[0].size > maxboxes)
+		{
+			ok = 0;
+			break;
+		}
+		queue[1].size = 0;
+		for (i = 0; ok && i < queue[0].size; i += n)
+		{
+			n = queue[0].size - i < GMF_FRONT_BATCH ? queue[0].size - i
+					: GMF_FRONT_BATCH;
+			ok = gmf_front_batch(poly, archive, eps,
+					queue[0].box + i * 2 * nvars, n, Flo, C, F, &queue[1],
+					&count);
+		}
+		++count.depth;
+		swap = queue[0];
+		queue[0] = queue[1];
+		queue[1] = swap;
+	}
+	count.open = queue[0].size;
+	if (stats != NULL)
+	{
+		*stats = count;
+	}
+	free(queue[0].box);
+	free(queue[1].box);
+	free(Flo);
+	free(C);
+	free(F);
+	return ok;
+}
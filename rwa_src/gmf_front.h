@@ -0,0 +1,57 @@
+/*
+ * gmf_front.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+#ifndef GMF_FRONT_H_
+#define GMF_FRONT_H_
+
+#include <stddef.h>
+#include "gmf_poly.h"
+#include "gmf_archive.h"
+
+/*
+ * Certified reference fronts by branch and bound over the decision space.
+ * The box of the table is bisected recursively (along the variable widest
+ * relative to the box), a generation at a time, and every box is bounded
+ * with gmf_poly_bound. A box is dropped when its lower-bound vector Flo,
+ * relaxed by eps, is dominated by the archive:
+ *
+ *     a_k <= Flo_k + eps_k   for every k, for some archived point a,
+ *
+ * since then every point of the box is within eps of being dominated.
+ * Boxes are processed in batches of GMF_FRONT_BATCH: the centres of a batch
+ * are evaluated together and offered to the archive before any box of the
+ * batch is tested, and the boxes that survive are split for the next
+ * generation. A variable along which no objective decreases over a box
+ * (one-signed gradient enclosures) is first fixed to the end where all of
+ * them are smallest, as the rest of the box is dominated by that face.
+ *
+ * When every box is dropped, the archive eps-covers the Pareto front of the
+ * table: every f(x) has an archived a with a_k <= f_k(x) + eps_k. Points
+ * leave the archive only for points that dominate them, which keeps the
+ * guarantee, so the archive must be created without a capacity (its
+ * truncation drops points); it may be seeded, e.g. with a POF reference
+ * set, and its decision vectors are those of the table (nreal = nvars).
+ * eps_k = tol (worst_k - ideal_k) with the descriptor's extrema is the
+ * natural choice; the work grows as the eps shrink.
+ *
+ * gmf_poly_front returns 1 when the front is certified, 0 if memory runs out
+ * or more than maxboxes boxes (0 for no limit) had to be bounded, with the
+ * archive holding the front found so far. stats may be NULL.
+ */
+#define GMF_FRONT_BATCH 256
+
+struct gmf_front_stats
+{
+	size_t boxes; /* bounded */
+	size_t pruned; /* dropped as dominated */
+	size_t evaluations; /* centres offered to the archive */
+	size_t depth; /* generations */
+	size_t open; /* boxes left undecided */
+};
+
+int gmf_poly_front(const struct gmf_poly *poly, gmf_archive *archive,
+		const double *eps, size_t maxboxes, struct gmf_front_stats *stats);
+
+#endif /* GMF_FRONT_H_ */
@@ -10,11 +10,36 @@
 #define gmf_true 1
 #define gmf_false 0
 
+/* Storage order of the point matrices used by the batch evaluators */
+#define gmf_row_major 0
+#define gmf_col_major 1
+
+/* Instruction sets of the column-major (SoA) batch kernels */
+#define gmf_simd_scalar 0
+#define gmf_simd_avx2 1
+#define gmf_simd_avx512 2
+
+/* Element types of the typed batch evaluator */
+#define gmf_float64 0
+#define gmf_float32 1
+
+/* Kernels of the batch evaluators */
+#define gmf_kernels_reference 0
+#define gmf_kernels_generated 1
+
+/* Objective senses */
+#define gmf_minimize 1
+#define gmf_maximize -1
+
 extern void (*gmf_test_problem)(double *F, double *G, double *xr, int *xi,
 		int *xb);
 
 
-struct
+/*
+ * Problem descriptor. gmf_mop is the descriptor of the problem selected with
+ * gmf_rwa_setup; problem handles (gmf_rwa_create) carry their own.
+ */
+struct gmf_mop_desc
 {
 	char benchmarck[50];
 	char name[50];
@@ -33,10 +58,22 @@ struct
 	size_t evaluations;
 	size_t std;
 
-	double *xmin_real;
-	double *xmax_real;
+	const double *xmin_real; /* static, see gmf_rwa_registry */
+	const double *xmax_real;
 	int *xmin_int;
 	int *xmax_int;
-} gmf_mop;
+
+	/*
+	 * Per objective, as F (maximized objectives negated), precomputed by
+	 * tools/gmf_extremagen; NULL if unknown. ideal is exact (the minima
+	 * over the box), worst the maxima over the box and nadir the payoff
+	 * table estimate of the nadir point, between the two (gmf_extrema.h).
+	 */
+	const double *ideal;
+	const double *nadir;
+	const double *worst;
+};
+
+extern struct gmf_mop_desc gmf_mop;
 
 #endif /* GMF_GLOBAL_H_ */
@@ -0,0 +1,477 @@
+/*
+ * gmf_hv.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "gmf_global.h"
+#include "gmf_hv.h"
+
+/**
+ * Point with its sort keys
+ */
+struct gmf_hv_key
+{
+	double key;
+	double tie;
+	const double *row;
+};
+
+/**
+ * Scratch space of one thread: for every dimension d a set of up to n
+ * points of d coordinates with their sort keys, and the 2D front of the 3D
+ * sweep. Allocated once per call; the recursion allocates nothing.
+ */
+struct gmf_hv_work
+{
+	double *set[GMF_HV_MAXOBJS + 1];
+	struct gmf_hv_key *keys[GMF_HV_MAXOBJS + 1];
+	double *front;
+};
+
+static void gmf_hv_work_free(struct gmf_hv_work *work)
+{
+	size_t d;
+	for (d = 0; d <= GMF_HV_MAXOBJS; ++d)
+	{
+		free(work->set[d]);
+		free(work->keys[d]);
+	}
+	free(work->front);
+	memset(work, 0, sizeof(struct gmf_hv_work));
+	return;
+}
+
+static int gmf_hv_work_init(struct gmf_hv_work *work, size_t n, size_t nobjs)
+{
+	size_t d;
+	memset(work, 0, sizeof(struct gmf_hv_work));
+	n = n > 0 ? n : 1;
+	for (d = 2; d <= nobjs; ++d)
+	{
+		work->set[d] = malloc(sizeof(double) * n * d);
+		work->keys[d] = malloc(sizeof(struct gmf_hv_key) * n);
+		if (work->set[d] == NULL || work->keys[d] == NULL)
+		{
+			gmf_hv_work_free(work);
+			return 0;
+		}
+	}
+	work->front = malloc(sizeof(double) * 2 * n);
+	if (work->front == NULL)
+	{
+		gmf_hv_work_free(work);
+		return 0;
+	}
+	return 1;
+}
+
+static int gmf_hv_compare(const void *a, const void *b)
+{
+	const struct gmf_hv_key *p = a, *q = b;
+	if (p->key != q->key)
+	{
+		return p->key < q->key ? -1 : 1;
+	}
+	if (p->tie != q->tie)
+	{
+		return p->tie < q->tie ? -1 : 1;
+	}
+	return 0;
+}
+
+/**
+ * Sorts the m points of set[d] into keys[d] by objective k, ties by the sum
+ * of the coordinates
+ */
+static void gmf_hv_sort(struct gmf_hv_work *work, size_t d, size_t m,
+		size_t k)
+{
+	struct gmf_hv_key *keys = work->keys[d];
+	const double *row;
+	double sum;
+	size_t i, j;
+	for (i = 0; i < m; ++i)
+	{
+		row = work->set[d] + i * d;
+		for (j = 0, sum = 0.0; j < d; ++j)
+		{
+			sum += row[j];
+		}
+		keys[i].key = row[k];
+		keys[i].tie = sum;
+		keys[i].row = row;
+	}
+	qsort(keys, m, sizeof(struct gmf_hv_key), gmf_hv_compare);
+	return;
+}
+
+static double gmf_hv_box(const double *p, size_t d, const double *ref)
+{
+	double volume = 1.0;
+	size_t k;
+	for (k = 0; k < d; ++k)
+	{
+		volume *= ref[k] - p[k];
+	}
+	return volume;
+}
+
+/** **************************************************************************
+ ** Two and three objectives
+ ** **************************************************************************/
+static double gmf_hv2(struct gmf_hv_work *work, size_t m, const double *ref)
+{
+	const struct gmf_hv_key *keys = work->keys[2];
+	double volume = 0.0, ymin = ref[1];
+	const double *p;
+	size_t i;
+
+	gmf_hv_sort(work, 2, m, 0);
+	for (i = 0; i < m; ++i)
+	{
+		p = keys[i].row;
+		if (p[1] < ymin)
+		{
+			volume += (ref[0] - p[0]) * (ymin - p[1]);
+			ymin = p[1];
+		}
+	}
+	return volume;
+}
+
+/**
+ * Inserts p into the 2D front (x ascending, y descending, size points) and
+ * returns the area it adds. Points of the front dominated by p are removed.
+ */
+static double gmf_hv3_insert(double *front, size_t *size, const double *p,
+		const double *ref)
+{
+	size_t lo = 0, hi = *size, mid, j, k;
+	double x, h, area = 0.0;
+
+	while (lo < hi)
+	{
+		mid = (lo + hi) / 2;
+		if (front[2 * mid] < p[0])
+		{
+			lo = mid + 1;
+		}
+		else
+		{
+			hi = mid;
+		}
+	}
+	j = lo;
+	if ((j > 0 && front[2 * j - 1] <= p[1])
+			|| (j < *size && front[2 * j] == p[0] && front[2 * j + 1] <= p[1]))
+	{
+		return 0.0;
+	}
+
+	/* walk the steps p covers, left to right */
+	x = p[0];
+	h = j > 0 ? front[2 * j - 1] : ref[1];
+	for (k = j; k < *size && front[2 * k + 1] >= p[1]; ++k)
+	{
+		area += (front[2 * k] - x) * (h - p[1]);
+		x = front[2 * k];
+		h = front[2 * k + 1];
+	}
+	area += ((k < *size ? front[2 * k] : ref[0]) - x) * (h - p[1]);
+
+	memmove(front + 2 * (j + 1), front + 2 * k,
+			sizeof(double) * 2 * (*size - k));
+	front[2 * j] = p[0];
+	front[2 * j + 1] = p[1];
+	*size = *size - (k - j) + 1;
+	return area;
+}
+
+static double gmf_hv3(struct gmf_hv_work *work, size_t m, const double *ref)
+{
+	const struct gmf_hv_key *keys = work->keys[3];
+	double area = 0.0, volume = 0.0, z;
+	const double *p;
+	size_t i, size = 0;
+
+	gmf_hv_sort(work, 3, m, 2);
+	for (i = 0; i < m; ++i)
+	{
+		p = keys[i].row;
+		area += gmf_hv3_insert(work->front, &size, p, ref);
+		z = i + 1 < m ? keys[i + 1].row[2] : ref[2];
+		volume += area * (z - p[2]);
+	}
+	return volume;
+}
+
+/** **************************************************************************
+ ** WFG
+ ** **************************************************************************/
+static double gmf_hv_set(struct gmf_hv_work *work, size_t d, size_t m,
+		const double *ref);
+
+/**
+ * Sorts set[d] into keys[d] by the last objective and drops dominated and
+ * repeated points; returns how many are left. A point can only be dominated
+ * by points sorted before it, so one pass against the kept points suffices.
+ */
+static size_t gmf_hv_filter(struct gmf_hv_work *work, size_t d, size_t m)
+{
+	struct gmf_hv_key *keys = work->keys[d];
+	const double *p, *q;
+	size_t i, j, k, kept = 0;
+
+	gmf_hv_sort(work, d, m, d - 1);
+	for (i = 0; i < m; ++i)
+	{
+		p = keys[i].row;
+		for (j = 0; j < kept; ++j)
+		{
+			q = keys[j].row;
+			for (k = 0; k < d && q[k] <= p[k]; ++k)
+			{
+			}
+			if (k == d)
+			{
+				break;
+			}
+		}
+		if (j == kept)
+		{
+			keys[kept++] = keys[i];
+		}
+	}
+	return kept;
+}
+
+/**
+ * Exclusive hypervolume of keys[i] with respect to keys[0..i-1], which are
+ * no worse in the last objective. Limited by keys[i] they all share its last
+ * coordinate, so the contribution is its height times a hypervolume one
+ * dimension down.
+ */
+static double gmf_hv_exclusive(struct gmf_hv_work *work,
+		const struct gmf_hv_key *keys, size_t i, size_t d, const double *ref)
+{
+	const double *p = keys[i].row, *q;
+	double *limited = work->set[d - 1];
+	size_t j, k;
+
+	for (j = 0; j < i; ++j)
+	{
+		q = keys[j].row;
+		for (k = 0; k < d - 1; ++k)
+		{
+			limited[j * (d - 1) + k] = q[k] > p[k] ? q[k] : p[k];
+		}
+	}
+	return (ref[d - 1] - p[d - 1])
+			* (gmf_hv_box(p, d - 1, ref) - gmf_hv_set(work, d - 1, i, ref));
+}
+
+/**
+ * Hypervolume of the m points in set[d]
+ */
+static double gmf_hv_set(struct gmf_hv_work *work, size_t d, size_t m,
+		const double *ref)
+{
+	double volume = 0.0;
+	size_t i;
+
+	if (m == 0)
+	{
+		return 0.0;
+	}
+	if (m == 1)
+	{
+		return gmf_hv_box(work->set[d], d, ref);
+	}
+	if (d == 2)
+	{
+		return gmf_hv2(work, m, ref);
+	}
+	if (d == 3)
+	{
+		return gmf_hv3(work, m, ref);
+	}
+	m = gmf_hv_filter(work, d, m);
+	for (i = 0; i < m; ++i)
+	{
+		volume += gmf_hv_exclusive(work, work->keys[d], i, d, ref);
+	}
+	return volume;
+}
+
+/** **************************************************************************
+ ** Entry points
+ ** **************************************************************************/
+struct gmf_hv_arg
+{
+	struct gmf_hv_work *work; /* one per worker */
+	const struct gmf_hv_key *keys;
+	size_t d;
+	const double *ref;
+	double *contribution;
+};
+
+static void gmf_hv_task(void *ptr, size_t begin, size_t end, int worker)
+{
+	struct gmf_hv_arg *arg = ptr;
+	size_t i;
+	for (i = begin; i < end; ++i)
+	{
+		arg->contribution[i] = gmf_hv_exclusive(&arg->work[worker], arg->keys,
+				i, arg->d, arg->ref);
+	}
+	return;
+}
+
+static double gmf_hv_run(gmf_pool *pool, size_t n, size_t nobjs,
+		const double *F, size_t ldf, int order, const double *ref)
+{
+	struct gmf_hv_arg arg;
+	struct gmf_hv_work *work;
+	double *set, *contribution, value, volume = 0.0;
+	int nworkers = pool != NULL ? gmf_pool_size(pool) : 1, w, ok;
+	size_t i, k, m = 0;
+
+	if (nobjs < 2 || nobjs > GMF_HV_MAXOBJS
+			|| (order != gmf_row_major && order != gmf_col_major))
+	{
+		return -1.0;
+	}
+	work = calloc(nworkers, sizeof(struct gmf_hv_work));
+	contribution = malloc(sizeof(double) * (n > 0 ? n : 1));
+	ok = work != NULL && contribution != NULL;
+	for (w = 0; ok && w < nworkers; ++w)
+	{
+		ok = gmf_hv_work_init(&work[w], n, nobjs);
+	}
+	if (!ok)
+	{
+		for (w = 0; work != NULL && w < nworkers; ++w)
+		{
+			gmf_hv_work_free(&work[w]);
+		}
+		free(work);
+		free(contribution);
+		return -1.0;
+	}
+
+	/* keep the points that strictly dominate the reference point */
+	set = work[0].set[nobjs];
+	for (i = 0; i < n; ++i)
+	{
+		for (k = 0; k < nobjs; ++k)
+		{
+			value = order == gmf_row_major ? F[i * ldf + k] : F[k * ldf + i];
+			if (!(value < ref[k]))
+			{
+				break;
+			}
+			set[m * nobjs + k] = value;
+		}
+		m += k == nobjs;
+	}
+
+	if (nobjs <= 3 || m <= 1)
+	{
+		volume = gmf_hv_set(&work[0], nobjs, m, ref);
+	}
+	else
+	{
+		arg.work = work;
+		arg.keys = work[0].keys[nobjs];
+		arg.d = nobjs;
+		arg.ref = ref;
+		arg.contribution = contribution;
+		m = gmf_hv_filter(&work[0], nobjs, m);
+		if (pool != NULL)
+		{
+			gmf_pool_for(pool, m, 1, gmf_hv_task, &arg);
+		}
+		else
+		{
+			gmf_hv_task(&arg, 0, m, 0);
+		}
+		for (i = 0; i < m; ++i)
+		{
+			volume += contribution[i];
+		}
+	}
+
+	for (w = 0; w < nworkers; ++w)
+	{
+		gmf_hv_work_free(&work[w]);
+	}
+	free(work);
+	free(contribution);
+	return volume;
+}
+
+double gmf_hv(size_t n, size_t nobjs, const double *F, size_t ldf, int order,
+		const double *ref)
+{
+	return gmf_hv_run(NULL, n, nobjs, F, ldf, order, ref);
+}
+
+double gmf_hv_parallel(gmf_pool *pool, size_t n, size_t nobjs,
+		const double *F, size_t ldf, int order, const double *ref)
+{
+	return gmf_hv_run(pool, n, nobjs, F, ldf, order, ref);
+}
+
+/**
+ * Hypervolume of a reference set (its columns are stored back to back)
+ */
+double gmf_hv_pof(const gmf_pof_view *view, const double *ref)
+{
+	return gmf_hv(view->npoints, view->nobjs, view->column[0], view->npoints,
+			gmf_col_major, ref);
+}
+
+/**
+ * Reference point of a problem: the nadir point of its reference set moved
+ * away from the front by margin times the range of every objective (a margin
+ * of 0.1 is usual). Returns 0 for an empty set.
+ */
+int gmf_hv_reference(const gmf_pof_view *view, double margin, double *ref)
+{
+	double width;
+	size_t k;
+
+	if (view->npoints == 0)
+	{
+		return 0;
+	}
+	for (k = 0; k < view->nobjs; ++k)
+	{
+		width = view->fmax[k] - view->fmin[k];
+		if (width <= 0.0)
+		{
+			width = fabs(view->fmax[k]) > 0.0 ? fabs(view->fmax[k]) : 1.0;
+		}
+		ref[k] = view->fmax[k] + margin * width;
+	}
+	return 1;
+}
+
+int gmf_hv_reference_mop(const struct gmf_mop_desc *mop, double margin,
+		double *ref)
+{
+	gmf_pof_view view;
+	int ok;
+
+	if (!gmf_pof_open_mop(mop, &view))
+	{
+		return 0;
+	}
+	ok = gmf_hv_reference(&view, margin, ref);
+	gmf_pof_close(&view);
+	return ok;
+}
@@ -0,0 +1,49 @@
+/*
+ * gmf_hv.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+#ifndef GMF_HV_H_
+#define GMF_HV_H_
+
+#include <stddef.h>
+#include "gmf_parallel.h"
+#include "gmf_pof.h"
+
+struct gmf_mop_desc;
+
+/* Largest number of objectives accepted by the hypervolume routines */
+#define GMF_HV_MAXOBJS GMF_POF_MAXOBJS
+
+/*
+ * Exact hypervolume of a set of minimized objective vectors with respect to
+ * a reference point. Points that do not strictly dominate the reference
+ * point add nothing and are dropped first. The algorithm depends on the
+ * number of objectives:
+ *
+ *  - 2: sort and sweep, O(n log n).
+ *  - 3: sweep along the third objective keeping the 2D front in a sorted
+ *    array and updating its area on every insertion (Beume et al. 2009).
+ *  - 4 and more: WFG (While, Bradstreet & Barone 2012) with the points
+ *    sliced along the last objective, so every exclusive contribution is a
+ *    hypervolume one dimension down; the recursion ends in the 3D sweep.
+ *
+ * The WFG contributions of the top level are independent and gmf_hv_parallel
+ * spreads them over a pool. They are summed in a fixed order, so the result
+ * does not depend on the number of threads and equals that of gmf_hv.
+ *
+ * F holds point i in row i (gmf_row_major) or column i (gmf_col_major) with
+ * leading dimension ldf, as in gmf_rwa_evaluate. Returns -1 if nobjs is out
+ * of range or memory runs out.
+ */
+double gmf_hv(size_t n, size_t nobjs, const double *F, size_t ldf, int order,
+		const double *ref);
+double gmf_hv_parallel(gmf_pool *pool, size_t n, size_t nobjs,
+		const double *F, size_t ldf, int order, const double *ref);
+double gmf_hv_pof(const gmf_pof_view *view, const double *ref);
+
+int gmf_hv_reference(const gmf_pof_view *view, double margin, double *ref);
+int gmf_hv_reference_mop(const struct gmf_mop_desc *mop, double margin,
+		double *ref);
+
+#endif /* GMF_HV_H_ */
@@ -0,0 +1,715 @@
+/*
+ * gmf_indicators.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "gmf_global.h"
+#include "gmf_indicators.h"
+
+#define GMF_KDTREE_MAGIC "GMFKDT\0"
+#define GMF_KDTREE_BOM 0x01020304u
+
+_Static_assert(sizeof(struct gmf_kdtree_header) == 64,
+		"the k-d tree header layout is part of the file format");
+
+/** **************************************************************************
+ ** Construction
+ ** **************************************************************************/
+
+/**
+ * Number of nodes of the implicit tree: a range is split while it holds
+ * more than leaf points, so depth L is enough once ceil(n / 2^L) <= leaf
+ */
+static size_t gmf_kdtree_nodes(size_t n, size_t leaf)
+{
+	size_t levels = 0;
+	while (levels < 48 && (n + ((size_t) 1 << levels) - 1) >> levels > leaf)
+	{
+		++levels;
+	}
+	return ((size_t) 2 << levels) - 1;
+}
+
+static void gmf_kd_swap(double *points, uint64_t *index, size_t d, size_t i,
+		size_t j)
+{
+	double t;
+	uint64_t u;
+	size_t k;
+	for (k = 0; k < d; ++k)
+	{
+		t = points[i * d + k];
+		points[i * d + k] = points[j * d + k];
+		points[j * d + k] = t;
+	}
+	u = index[i];
+	index[i] = index[j];
+	index[j] = u;
+	return;
+}
+
+/**
+ * Moves the rows of [begin, end) so that row nth holds the value it would
+ * have if the rows were sorted by coordinate k, with smaller values before
+ * it and larger ones after (three-way quickselect, median-of-three pivot)
+ */
+static void gmf_kd_select(double *points, uint64_t *index, size_t d,
+		size_t k, size_t begin, size_t end, size_t nth)
+{
+	size_t lt, gt, i;
+	double a, b, c, pivot, v;
+
+	while (end - begin > 1)
+	{
+		a = points[begin * d + k];
+		b = points[(begin + (end - begin) / 2) * d + k];
+		c = points[(end - 1) * d + k];
+		pivot = a < b ? (b < c ? b : (a < c ? c : a)) : (a < c ? a :
+				(b < c ? c : b));
+		lt = begin;
+		gt = end;
+		for (i = begin; i < gt;)
+		{
+			v = points[i * d + k];
+			if (v < pivot)
+			{
+				gmf_kd_swap(points, index, d, lt++, i++);
+			}
+			else if (v > pivot)
+			{
+				gmf_kd_swap(points, index, d, i, --gt);
+			}
+			else
+			{
+				++i;
+			}
+		}
+		if (nth < lt)
+		{
+			end = lt;
+		}
+		else if (nth >= gt)
+		{
+			begin = gt;
+		}
+		else
+		{
+			return;
+		}
+	}
+	return;
+}
+
+static void gmf_kd_build(const gmf_kdtree *tree, double *box, double *points,
+		uint64_t *index, size_t node, size_t begin, size_t end)
+{
+	size_t d = tree->nobjs, i, k, widest = 0, mid;
+	double *lo = box + node * 2 * d, *hi = lo + d;
+
+	for (k = 0; k < d; ++k)
+	{
+		lo[k] = hi[k] = points[begin * d + k];
+	}
+	for (i = begin + 1; i < end; ++i)
+	{
+		for (k = 0; k < d; ++k)
+		{
+			lo[k] = points[i * d + k] < lo[k] ? points[i * d + k] : lo[k];
+			hi[k] = points[i * d + k] > hi[k] ? points[i * d + k] : hi[k];
+		}
+	}
+	if (end - begin <= tree->leaf)
+	{
+		return;
+	}
+	for (k = 1; k < d; ++k)
+	{
+		widest = hi[k] - lo[k] > hi[widest] - lo[widest] ? k : widest;
+	}
+	mid = begin + (end - begin) / 2;
+	gmf_kd_select(points, index, d, widest, begin, end, mid);
+	gmf_kd_build(tree, box, points, index, 2 * node + 1, begin, mid);
+	gmf_kd_build(tree, box, points, index, 2 * node + 2, mid, end);
+	return;
+}
+
+/**
+ * Builds the tree over n points of F (row or column i is point i). Reuses
+ * the storage of a previous build when it is large enough. Returns 0 on
+ * failure.
+ */
+int gmf_kdtree_build(gmf_kdtree *tree, size_t n, size_t nobjs,
+		const double *F, size_t ldf, int order)
+{
+	size_t nnodes, bytes, i, k;
+	double *box, *points;
+	uint64_t *index;
+	void *memory;
+
+	if (nobjs == 0 || nobjs > GMF_POF_MAXOBJS || tree->map != NULL
+			|| (order != gmf_row_major && order != gmf_col_major))
+	{
+		return 0;
+	}
+	nnodes = gmf_kdtree_nodes(n, GMF_KDTREE_LEAF);
+	bytes = sizeof(double) * (2 * nnodes + n) * nobjs + sizeof(uint64_t) * n;
+	if (bytes > tree->capacity)
+	{
+		memory = realloc(tree->memory, bytes);
+		if (memory == NULL)
+		{
+			return 0;
+		}
+		tree->memory = memory;
+		tree->capacity = bytes;
+	}
+	box = tree->memory;
+	points = box + 2 * nnodes * nobjs;
+	index = (uint64_t*) (points + n * nobjs);
+	memset(box, 0, sizeof(double) * 2 * nnodes * nobjs);
+	for (i = 0; i < n; ++i)
+	{
+		for (k = 0; k < nobjs; ++k)
+		{
+			points[i * nobjs + k] =
+					order == gmf_row_major ? F[i * ldf + k] : F[k * ldf + i];
+		}
+		index[i] = i;
+	}
+
+	tree->nobjs = nobjs;
+	tree->npoints = n;
+	tree->nnodes = nnodes;
+	tree->leaf = GMF_KDTREE_LEAF;
+	tree->box = box;
+	tree->points = points;
+	tree->index = index;
+	if (n > 0)
+	{
+		gmf_kd_build(tree, box, points, index, 0, 0, n);
+	}
+	return 1;
+}
+
+void gmf_kdtree_free(gmf_kdtree *tree)
+{
+	if (tree->map != NULL)
+	{
+		munmap(tree->map, tree->map_size);
+	}
+	free(tree->memory);
+	memset(tree, 0, sizeof(gmf_kdtree));
+	return;
+}
+
+/** **************************************************************************
+ ** Files
+ ** **************************************************************************/
+static uint64_t gmf_kd_align(uint64_t bytes)
+{
+	return (bytes + 63) & ~(uint64_t) 63;
+}
+
+static int gmf_kd_write(FILE *fp, const void *data, size_t bytes)
+{
+	static const char zeros[64];
+	size_t pad = gmf_kd_align(bytes) - bytes;
+	return fwrite(data, 1, bytes, fp) == bytes
+			&& fwrite(zeros, 1, pad, fp) == pad;
+}
+
+/**
+ * Writes the tree to a temporary file of its own (mkstemp) renamed into
+ * place, as gmf_pof_convert does. Returns 0 on failure.
+ */
+int gmf_kdtree_save(const gmf_kdtree *tree, const char *file)
+{
+	struct gmf_kdtree_header header;
+	char tmp_file[512];
+	size_t box_bytes = sizeof(double) * 2 * tree->nnodes * tree->nobjs;
+	size_t point_bytes = sizeof(double) * tree->npoints * tree->nobjs;
+	FILE *fp;
+	int fd, ok;
+
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, GMF_KDTREE_MAGIC, 8);
+	header.byte_order = GMF_KDTREE_BOM;
+	header.version = GMF_KDTREE_VERSION;
+	header.nobjs = (uint32_t) tree->nobjs;
+	header.leaf = (uint32_t) tree->leaf;
+	header.npoints = tree->npoints;
+	header.nnodes = tree->nnodes;
+	header.box_offset = sizeof(header);
+	header.points_offset = header.box_offset + gmf_kd_align(box_bytes);
+	header.index_offset = header.points_offset + gmf_kd_align(point_bytes);
+
+	/* a name unique to this call, even between threads of one process */
+	snprintf(tmp_file, sizeof(tmp_file), "%s.XXXXXX", file);
+	fd = mkstemp(tmp_file);
+	if (fd < 0)
+	{
+		return 0;
+	}
+	fchmod(fd, 0644);
+	fp = fdopen(fd, "wb");
+	if (fp == NULL)
+	{
+		close(fd);
+		remove(tmp_file);
+		return 0;
+	}
+	ok = fwrite(&header, sizeof(header), 1, fp) == 1
+			&& gmf_kd_write(fp, tree->box, box_bytes)
+			&& gmf_kd_write(fp, tree->points, point_bytes)
+			&& gmf_kd_write(fp, tree->index, sizeof(uint64_t) * tree->npoints);
+	ok = fclose(fp) == 0 && ok;
+	if (!ok || rename(tmp_file, file) != 0)
+	{
+		remove(tmp_file);
+		return 0;
+	}
+	return 1;
+}
+
+/**
+ * Maps a k-d tree file. Returns 0 if it cannot be opened or is not a valid
+ * file for this machine.
+ */
+int gmf_kdtree_open(const char *file, gmf_kdtree *tree)
+{
+	const struct gmf_kdtree_header *header;
+	struct stat st;
+	uint64_t limit;
+	int fd;
+
+	memset(tree, 0, sizeof(gmf_kdtree));
+	fd = open(file, O_RDONLY);
+	if (fd < 0)
+	{
+		return 0;
+	}
+	if (fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(*header))
+	{
+		close(fd);
+		return 0;
+	}
+	tree->map_size = (size_t) st.st_size;
+	tree->map = mmap(NULL, tree->map_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (tree->map == MAP_FAILED)
+	{
+		tree->map = NULL;
+		return 0;
+	}
+
+	header = tree->map;
+	limit = tree->map_size / sizeof(double);
+	if (memcmp(header->magic, GMF_KDTREE_MAGIC, 8) != 0
+			|| header->byte_order != GMF_KDTREE_BOM
+			|| header->version != GMF_KDTREE_VERSION || header->nobjs == 0
+			|| header->nobjs > GMF_POF_MAXOBJS || header->leaf == 0
+			|| header->npoints > limit
+			|| header->nnodes != gmf_kdtree_nodes(header->npoints, header->leaf)
+			|| header->nnodes > limit
+			|| header->box_offset % 64 != 0 || header->points_offset % 64 != 0
+			|| header->index_offset % 64 != 0
+			|| header->box_offset + 2 * header->nnodes * header->nobjs * 8
+					> header->points_offset
+			|| header->points_offset + header->npoints * header->nobjs * 8
+					> header->index_offset
+			|| header->index_offset + header->npoints * 8 > tree->map_size)
+	{
+		gmf_kdtree_free(tree);
+		return 0;
+	}
+	tree->nobjs = header->nobjs;
+	tree->npoints = header->npoints;
+	tree->nnodes = header->nnodes;
+	tree->leaf = header->leaf;
+	tree->box = (const double*) ((const char*) tree->map + header->box_offset);
+	tree->points = (const double*) ((const char*) tree->map
+			+ header->points_offset);
+	tree->index = (const uint64_t*) ((const char*) tree->map
+			+ header->index_offset);
+	return 1;
+}
+
+/**
+ * Opens the tree of the reference set of a problem. It is kept in
+ * mop->PF_file plus "k", rebuilt when missing or older than the binary
+ * reference set; if it cannot be written the tree is built in memory.
+ */
+int gmf_kdtree_open_mop(const struct gmf_mop_desc *mop, gmf_kdtree *tree)
+{
+	char bin_file[sizeof(mop->PF_file) + 1];
+	char kd_file[sizeof(mop->PF_file) + 1];
+	struct stat bin, kd;
+	gmf_pof_view view;
+	gmf_kdtree built;
+	int ok = 1;
+
+	memset(tree, 0, sizeof(gmf_kdtree));
+	snprintf(bin_file, sizeof(bin_file), "%sb", mop->PF_file);
+	snprintf(kd_file, sizeof(kd_file), "%sk", mop->PF_file);
+	if (!gmf_pof_open_mop(mop, &view))
+	{
+		return 0;
+	}
+	if (stat(kd_file, &kd) != 0 || stat(bin_file, &bin) != 0
+			|| kd.st_mtime < bin.st_mtime)
+	{
+		memset(&built, 0, sizeof(gmf_kdtree));
+		if (gmf_kdtree_build(&built, view.npoints, view.nobjs, view.column[0],
+				view.npoints, gmf_col_major))
+		{
+			gmf_kdtree_save(&built, kd_file);
+		}
+		gmf_kdtree_free(&built);
+	}
+	if (!gmf_kdtree_open(kd_file, tree) || tree->nobjs != view.nobjs
+			|| tree->npoints != view.npoints)
+	{
+		gmf_kdtree_free(tree);
+		ok = gmf_kdtree_build(tree, view.npoints, view.nobjs, view.column[0],
+				view.npoints, gmf_col_major);
+	}
+	gmf_pof_close(&view);
+	return ok;
+}
+
+/** **************************************************************************
+ ** Nearest-neighbour queries
+ ** **************************************************************************/
+
+/**
+ * Squared scaled distance from q to the closest point of the box [lo, hi]
+ * (a point when lo = hi)
+ */
+static double gmf_kd_bound(const double *lo, const double *hi,
+		const double *q, const double *scale, size_t d, int distance)
+{
+	double sum = 0.0, t;
+	size_t k;
+	switch (distance)
+	{
+	case gmf_distance_igd_plus:
+		for (k = 0; k < d; ++k)
+		{
+			t = lo[k] > q[k] ? (lo[k] - q[k]) * scale[k] : 0.0;
+			sum += t * t;
+		}
+		break;
+	case gmf_distance_gd_plus:
+		for (k = 0; k < d; ++k)
+		{
+			t = q[k] > hi[k] ? (q[k] - hi[k]) * scale[k] : 0.0;
+			sum += t * t;
+		}
+		break;
+	default:
+		for (k = 0; k < d; ++k)
+		{
+			t = lo[k] > q[k] ? lo[k] - q[k] : (q[k] > hi[k] ? q[k] - hi[k] : 0.0);
+			t *= scale[k];
+			sum += t * t;
+		}
+		break;
+	}
+	return sum;
+}
+
+/**
+ * Distance from q to its nearest point of the tree. Subtrees are visited
+ * nearest box first and skipped once their box is no closer than the best
+ * point found.
+ */
+static double gmf_kd_nearest(const gmf_kdtree *tree, int distance,
+		const double *scale, const double *q, size_t *nearest)
+{
+	struct
+	{
+		size_t node;
+		size_t begin;
+		size_t end;
+		double bound;
+	} stack[128], top;
+	size_t d = tree->nobjs, i, mid, left, right, depth = 0, best_i = 0;
+	double best = HUGE_VAL, value, bound_left, bound_right;
+	const double *p;
+
+	stack[0].node = 0;
+	stack[0].begin = 0;
+	stack[0].end = tree->npoints;
+	stack[0].bound = gmf_kd_bound(tree->box, tree->box + d, q, scale, d,
+			distance);
+	depth = 1;
+	while (depth > 0)
+	{
+		top = stack[--depth];
+		if (top.bound >= best)
+		{
+			continue;
+		}
+		if (top.end - top.begin <= tree->leaf)
+		{
+			for (i = top.begin; i < top.end; ++i)
+			{
+				p = tree->points + i * d;
+				value = gmf_kd_bound(p, p, q, scale, d, distance);
+				if (value < best)
+				{
+					best = value;
+					best_i = i;
+				}
+			}
+			continue;
+		}
+		mid = top.begin + (top.end - top.begin) / 2;
+		left = 2 * top.node + 1;
+		right = 2 * top.node + 2;
+		bound_left = gmf_kd_bound(tree->box + left * 2 * d,
+				tree->box + left * 2 * d + d, q, scale, d, distance);
+		bound_right = gmf_kd_bound(tree->box + right * 2 * d,
+				tree->box + right * 2 * d + d, q, scale, d, distance);
+		/* the nearer child goes on top */
+		if (bound_left <= bound_right)
+		{
+			stack[depth].node = right;
+			stack[depth].begin = mid;
+			stack[depth].end = top.end;
+			stack[depth++].bound = bound_right;
+			stack[depth].node = left;
+			stack[depth].begin = top.begin;
+			stack[depth].end = mid;
+			stack[depth++].bound = bound_left;
+		}
+		else
+		{
+			stack[depth].node = left;
+			stack[depth].begin = top.begin;
+			stack[depth].end = mid;
+			stack[depth++].bound = bound_left;
+			stack[depth].node = right;
+			stack[depth].begin = mid;
+			stack[depth].end = top.end;
+			stack[depth++].bound = bound_right;
+		}
+	}
+	*nearest = tree->index[best_i];
+	return sqrt(best);
+}
+
+struct gmf_kd_query_arg
+{
+	const gmf_kdtree *tree;
+	int distance;
+	const double *scale;
+	const double *Q;
+	size_t ldq;
+	int order;
+	double *dist;
+	size_t *index;
+};
+
+static void gmf_kd_query_task(void *ptr, size_t begin, size_t end,
+		int worker)
+{
+	struct gmf_kd_query_arg *arg = ptr;
+	double q[GMF_POF_MAXOBJS];
+	size_t i, k, nearest;
+	(void) worker;
+	for (i = begin; i < end; ++i)
+	{
+		for (k = 0; k < arg->tree->nobjs; ++k)
+		{
+			q[k] = arg->order == gmf_row_major ? arg->Q[i * arg->ldq + k] :
+					arg->Q[k * arg->ldq + i];
+		}
+		arg->dist[i] = gmf_kd_nearest(arg->tree, arg->distance, arg->scale, q,
+				&nearest);
+		if (arg->index != NULL)
+		{
+			arg->index[i] = nearest;
+		}
+	}
+	return;
+}
+
+/**
+ * For each of the n query points of Q (row or column i is point i), the
+ * distance to its nearest tree point and, if index is not NULL, the position
+ * of that point in the set the tree was built from. Objective k is
+ * multiplied by scale[k] (NULL: no scaling). Runs on the pool when one is
+ * given. Returns 0 on an empty tree or bad arguments.
+ */
+int gmf_kdtree_nearest(gmf_pool *pool, const gmf_kdtree *tree, int distance,
+		const double *scale, size_t n, const double *Q, size_t ldq, int order,
+		double *dist, size_t *index)
+{
+	static const double ones[GMF_POF_MAXOBJS] =
+	{ 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+	struct gmf_kd_query_arg arg;
+
+	if (tree->npoints == 0 || distance < gmf_distance_euclidean
+			|| distance > gmf_distance_gd_plus
+			|| (order != gmf_row_major && order != gmf_col_major))
+	{
+		return 0;
+	}
+	arg.tree = tree;
+	arg.distance = distance;
+	arg.scale = scale != NULL ? scale : ones;
+	arg.Q = Q;
+	arg.ldq = ldq;
+	arg.order = order;
+	arg.dist = dist;
+	arg.index = index;
+	if (pool != NULL)
+	{
+		gmf_pool_for(pool, n, 64, gmf_kd_query_task, &arg);
+	}
+	else
+	{
+		gmf_kd_query_task(&arg, 0, n, 0);
+	}
+	return 1;
+}
+
+/** **************************************************************************
+ ** Indicators
+ ** **************************************************************************/
+static void gmf_indicator_scale(gmf_indicator *indicator, int normalize)
+{
+	const double *lo = indicator->reference.box;
+	const double *hi = lo + indicator->reference.nobjs;
+	size_t k;
+	for (k = 0; k < GMF_POF_MAXOBJS; ++k)
+	{
+		indicator->scale[k] = 1.0;
+		if (normalize && k < indicator->reference.nobjs && hi[k] > lo[k])
+		{
+			indicator->scale[k] = 1.0 / (hi[k] - lo[k]);
+		}
+	}
+	return;
+}
+
+int gmf_indicator_open(gmf_indicator *indicator, const char *kdtree_file,
+		int normalize)
+{
+	memset(indicator, 0, sizeof(gmf_indicator));
+	if (!gmf_kdtree_open(kdtree_file, &indicator->reference))
+	{
+		return 0;
+	}
+	gmf_indicator_scale(indicator, normalize);
+	return 1;
+}
+
+int gmf_indicator_open_mop(gmf_indicator *indicator,
+		const struct gmf_mop_desc *mop, int normalize)
+{
+	memset(indicator, 0, sizeof(gmf_indicator));
+	if (!gmf_kdtree_open_mop(mop, &indicator->reference))
+	{
+		return 0;
+	}
+	gmf_indicator_scale(indicator, normalize);
+	return 1;
+}
+
+void gmf_indicator_close(gmf_indicator *indicator)
+{
+	gmf_kdtree_free(&indicator->reference);
+	gmf_kdtree_free(&indicator->approx);
+	free(indicator->dist);
+	memset(indicator, 0, sizeof(gmf_indicator));
+	return;
+}
+
+/**
+ * Mean distance from the n points of Q to the tree
+ */
+static double gmf_indicator_mean(gmf_indicator *indicator, gmf_pool *pool,
+		const gmf_kdtree *tree, int distance, size_t n, const double *Q,
+		size_t ldq, int order)
+{
+	double *dist, sum = 0.0;
+	size_t i;
+
+	if (n == 0)
+	{
+		return -1.0;
+	}
+	if (n > indicator->capacity)
+	{
+		dist = realloc(indicator->dist, sizeof(double) * n);
+		if (dist == NULL)
+		{
+			return -1.0;
+		}
+		indicator->dist = dist;
+		indicator->capacity = n;
+	}
+	if (!gmf_kdtree_nearest(pool, tree, distance, indicator->scale, n, Q, ldq,
+			order, indicator->dist, NULL))
+	{
+		return -1.0;
+	}
+	for (i = 0; i < n; ++i)
+	{
+		sum += indicator->dist[i];
+	}
+	return sum / n;
+}
+
+double gmf_indicator_gd(gmf_indicator *indicator, gmf_pool *pool, size_t n,
+		const double *F, size_t ldf, int order)
+{
+	return gmf_indicator_mean(indicator, pool, &indicator->reference,
+			gmf_distance_euclidean, n, F, ldf, order);
+}
+
+double gmf_indicator_gd_plus(gmf_indicator *indicator, gmf_pool *pool,
+		size_t n, const double *F, size_t ldf, int order)
+{
+	return gmf_indicator_mean(indicator, pool, &indicator->reference,
+			gmf_distance_gd_plus, n, F, ldf, order);
+}
+
+double gmf_indicator_igd(gmf_indicator *indicator, gmf_pool *pool, size_t n,
+		const double *F, size_t ldf, int order)
+{
+	const gmf_kdtree *reference = &indicator->reference;
+	if (!gmf_kdtree_build(&indicator->approx, n, reference->nobjs, F, ldf,
+			order))
+	{
+		return -1.0;
+	}
+	return gmf_indicator_mean(indicator, pool, &indicator->approx,
+			gmf_distance_euclidean, reference->npoints, reference->points,
+			reference->nobjs, gmf_row_major);
+}
+
+double gmf_indicator_igd_plus(gmf_indicator *indicator, gmf_pool *pool,
+		size_t n, const double *F, size_t ldf, int order)
+{
+	const gmf_kdtree *reference = &indicator->reference;
+	if (!gmf_kdtree_build(&indicator->approx, n, reference->nobjs, F, ldf,
+			order))
+	{
+		return -1.0;
+	}
+	return gmf_indicator_mean(indicator, pool, &indicator->approx,
+			gmf_distance_igd_plus, reference->npoints, reference->points,
+			reference->nobjs, gmf_row_major);
+}
@@ -0,0 +1,118 @@
+/*
+ * gmf_indicators.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+#ifndef GMF_INDICATORS_H_
+#define GMF_INDICATORS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "gmf_parallel.h"
+#include "gmf_pof.h"
+
+struct gmf_mop_desc;
+
+#define GMF_KDTREE_VERSION 1
+#define GMF_KDTREE_LEAF 8
+
+/* Distances of the nearest-neighbour queries */
+#define gmf_distance_euclidean 0
+#define gmf_distance_igd_plus 1 /* query z, tree point a: |max(a - z, 0)| */
+#define gmf_distance_gd_plus 2 /* query a, tree point z: |max(a - z, 0)| */
+
+/*
+ * Binary k-d tree file (".pofk", next to the ".pofb" of the reference set):
+ * a 64-byte header, the node boxes, the points in tree order and their
+ * positions in the reference set. Node i covers a range of points that is
+ * split at its middle into nodes 2i+1 and 2i+2 while it holds more than
+ * leaf points, so only the boxes (lower then upper corner) are stored.
+ */
+struct gmf_kdtree_header
+{
+	char magic[8]; /* "GMFKDT\0\0" */
+	uint32_t byte_order; /* 0x01020304 */
+	uint32_t version;
+	uint32_t nobjs;
+	uint32_t leaf;
+	uint64_t npoints;
+	uint64_t nnodes;
+	uint64_t box_offset; /* bytes from the start of the file, 64-aligned */
+	uint64_t points_offset;
+	uint64_t index_offset;
+};
+
+/*
+ * k-d tree over a set of objective vectors, split at the median of the
+ * widest coordinate. Either mapped from a file (map != NULL) or built in
+ * memory; a built tree keeps its storage, so rebuilding it for a set of the
+ * same size allocates nothing. Zero it before the first build.
+ */
+typedef struct gmf_kdtree
+{
+	size_t nobjs;
+	size_t npoints;
+	size_t nnodes;
+	size_t leaf;
+	const double *box;
+	const double *points;
+	const uint64_t *index;
+
+	void *map;
+	size_t map_size;
+	void *memory;
+	size_t capacity; /* bytes of memory */
+} gmf_kdtree;
+
+int gmf_kdtree_build(gmf_kdtree *tree, size_t n, size_t nobjs,
+		const double *F, size_t ldf, int order);
+int gmf_kdtree_save(const gmf_kdtree *tree, const char *file);
+int gmf_kdtree_open(const char *file, gmf_kdtree *tree);
+int gmf_kdtree_open_mop(const struct gmf_mop_desc *mop, gmf_kdtree *tree);
+void gmf_kdtree_free(gmf_kdtree *tree);
+int gmf_kdtree_nearest(gmf_pool *pool, const gmf_kdtree *tree, int distance,
+		const double *scale, size_t n, const double *Q, size_t ldq, int order,
+		double *dist, size_t *index);
+
+/*
+ * GD, GD+, IGD and IGD+ of an approximation set against the reference set of
+ * a problem, all as mean distances (GD: from every approximation point to
+ * the reference set, IGD: from every reference point to the approximation
+ * set; the "+" versions use the dominance distance of Ishibuchi et al. 2015).
+ *
+ * The reference set is indexed once by a k-d tree cached in its ".pofk"
+ * file, which answers the GD queries. The IGD queries go the other way, so
+ * they use a tree over the approximation set, rebuilt on every call in
+ * storage kept by the indicator (O(n log n), small next to the queries).
+ * Queries run on the pool when one is given (NULL: calling thread) and the
+ * distances are summed in a fixed order, so results do not depend on the
+ * number of threads. An indicator must not be used by two threads at once.
+ *
+ * With normalize, objective k is divided by the range of the reference set
+ * in that objective. F holds point i in row or column i, as in
+ * gmf_rwa_evaluate. The functions return -1 on an empty set or no memory.
+ */
+typedef struct gmf_indicator
+{
+	gmf_kdtree reference;
+	double scale[GMF_POF_MAXOBJS];
+	gmf_kdtree approx;
+	double *dist;
+	size_t capacity;
+} gmf_indicator;
+
+int gmf_indicator_open(gmf_indicator *indicator, const char *kdtree_file,
+		int normalize);
+int gmf_indicator_open_mop(gmf_indicator *indicator,
+		const struct gmf_mop_desc *mop, int normalize);
+void gmf_indicator_close(gmf_indicator *indicator);
+double gmf_indicator_gd(gmf_indicator *indicator, gmf_pool *pool, size_t n,
+		const double *F, size_t ldf, int order);
+double gmf_indicator_gd_plus(gmf_indicator *indicator, gmf_pool *pool,
+		size_t n, const double *F, size_t ldf, int order);
+double gmf_indicator_igd(gmf_indicator *indicator, gmf_pool *pool, size_t n,
+		const double *F, size_t ldf, int order);
+double gmf_indicator_igd_plus(gmf_indicator *indicator, gmf_pool *pool,
+		size_t n, const double *F, size_t ldf, int order);
+
+#endif /* GMF_INDICATORS_H_ */
@@ -0,0 +1,252 @@
+/*
+ * gmf_mixed.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+#include <stdlib.h>
+
+#include "gmf_global.h"
+#include "gmf_nds.h"
+#include "gmf_mixed.h"
+
+/**
+ * Points converted and evaluated at a time, in column-major buffers
+ */
+#define GMF_MIXED_CHUNK 1024
+
+/**
+ * Rows of the reference front under one lower corner
+ */
+#define GMF_MIXED_BLOCK 16
+
+/**
+ * Offset of element (i, k) of a matrix of points in the given order
+ */
+static size_t gmf_mixed_at(size_t i, size_t k, size_t ld, int order)
+{
+	return order == gmf_row_major ? i * ld + k : k * ld + i;
+}
+
+/**
+ * Single-precision pass: points in chunks to float, evaluated column-major
+ * (the SIMD kernels) and the objectives widened back into F
+ */
+static int gmf_mixed_float(int function, size_t n, size_t d, size_t m,
+		const double *X, size_t ldx, double *F, size_t ldf, int order)
+{
+	float *Y = malloc(sizeof(float) * GMF_MIXED_CHUNK * (d + m));
+	float *G = Y + GMF_MIXED_CHUNK * d;
+	size_t begin, c, i, j;
+
+	if (Y == NULL)
+	{
+		return 0;
+	}
+	for (begin = 0; begin < n; begin += c)
+	{
+		c = n - begin < GMF_MIXED_CHUNK ? n - begin : GMF_MIXED_CHUNK;
+		for (j = 0; j < d; ++j)
+		{
+			for (i = 0; i < c; ++i)
+			{
+				Y[j * c + i] = (float) X[gmf_mixed_at(begin + i, j, ldx,
+						order)];
+			}
+		}
+		gmf_rwa_evaluate_typed(function, c, Y, c, G, c, gmf_col_major,
+				gmf_float32);
+		for (j = 0; j < m; ++j)
+		{
+			for (i = 0; i < c; ++i)
+			{
+				F[gmf_mixed_at(begin + i, j, ldf, order)] = G[j * c + i];
+			}
+		}
+	}
+	free(Y);
+	return 1;
+}
+
+/**
+ * Double pass over the points listed in `index`: gathered in chunks,
+ * evaluated column-major and scattered back into F
+ */
+static int gmf_mixed_double(gmf_rwa_problem *problem, size_t count,
+		const size_t *index, size_t d, size_t m, const double *X, size_t ldx,
+		double *F, size_t ldf, int order)
+{
+	double *Y = malloc(sizeof(double) * GMF_MIXED_CHUNK * (d + m));
+	double *G = Y + GMF_MIXED_CHUNK * d;
+	size_t begin, c, i, j;
+
+	if (Y == NULL)
+	{
+		return 0;
+	}
+	for (begin = 0; begin < count; begin += c)
+	{
+		c = count - begin < GMF_MIXED_CHUNK ? count - begin : GMF_MIXED_CHUNK;
+		for (j = 0; j < d; ++j)
+		{
+			for (i = 0; i < c; ++i)
+			{
+				Y[j * c + i] = X[gmf_mixed_at(index[begin + i], j, ldx,
+						order)];
+			}
+		}
+		gmf_rwa_eval_batch(problem, c, Y, c, G, c, gmf_col_major);
+		for (j = 0; j < m; ++j)
+		{
+			for (i = 0; i < c; ++i)
+			{
+				F[gmf_mixed_at(index[begin + i], j, ldf, order)] =
+						G[j * c + i];
+			}
+		}
+	}
+	free(Y);
+	return 1;
+}
+
+static int gmf_mixed_compare(const void *a, const void *b)
+{
+	double fa = *(const double*) a;
+	double fb = *(const double*) b;
+	return (fa > fb) - (fa < fb);
+}
+
+/**
+ * Whether row r of the reference is below f in every objective
+ */
+static int gmf_mixed_below(const double *row, const double *f, size_t m)
+{
+	size_t k;
+
+	for (k = 0; k < m; ++k)
+	{
+		if (!(row[k] < f[k]))
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/**
+ * Whether some row of the reference (sorted by f1, margin added) is below
+ * f, trying first the row that was below the last point. Blocks of
+ * GMF_MIXED_BLOCK rows are skipped when their lower corner is not below f.
+ */
+static int gmf_mixed_dominated(const double *ref, const double *lower,
+		size_t size, size_t m, const double *f, size_t *witness)
+{
+	size_t b, r, end;
+
+	if (*witness < size && gmf_mixed_below(ref + *witness * m, f, m))
+	{
+		return 1;
+	}
+	for (b = 0; b * GMF_MIXED_BLOCK < size && lower[b * m] < f[0]; ++b)
+	{
+		if (!gmf_mixed_below(lower + b * m, f, m))
+		{
+			continue;
+		}
+		end = (b + 1) * GMF_MIXED_BLOCK < size ? (b + 1) * GMF_MIXED_BLOCK
+				: size;
+		for (r = b * GMF_MIXED_BLOCK; r < end; ++r)
+		{
+			if (gmf_mixed_below(ref + r * m, f, m))
+			{
+				*witness = r;
+				return 1;
+			}
+		}
+	}
+	return 0;
+}
+
+int gmf_rwa_mixed_evaluate(gmf_rwa_problem *problem, size_t n,
+		const double *X, size_t ldx, double *F, size_t ldf, int order,
+		const double *R, size_t size, size_t ldr, size_t *refined)
+{
+	const struct gmf_mop_desc *mop = gmf_rwa_desc(problem);
+	int function = gmf_rwa_function(problem);
+	size_t d = mop->nreal, m = mop->nobjs, count = 0, witness = 0, i, k;
+	size_t *index;
+	double *ref, *lower, e[7], f[7];
+	int ok;
+
+	if (order != gmf_row_major && order != gmf_col_major)
+	{
+		return 0;
+	}
+	for (k = 0; k < m; ++k)
+	{
+		e[k] = (R == NULL ? 2.0 : 1.0) * gmf_rwa_float_error(function, k);
+		if (e[k] < 0.0)
+		{
+			if (refined != NULL)
+			{
+				*refined = n;
+			}
+			return gmf_rwa_eval_batch(problem, n, X, ldx, F, ldf, order);
+		}
+	}
+	index = malloc(sizeof(size_t) * n);
+	ref = malloc(sizeof(double) * m * 2 * (R == NULL ? n : size));
+	if (index == NULL || ref == NULL || !gmf_mixed_float(function, n, d, m,
+			X, ldx, F, ldf, order) || (R == NULL
+			&& !gmf_nds_front(n, m, F, ldf, order, index, &size)))
+	{
+		free(index);
+		free(ref);
+		return 0;
+	}
+
+	/*
+	 * Reference rows packed with the margin added and sorted by f1 (the
+	 * rows start with it), then the lower corner of every block of rows.
+	 * Every point not robustly dominated goes to `index`.
+	 */
+	for (i = 0; i < size; ++i)
+	{
+		for (k = 0; k < m; ++k)
+		{
+			ref[i * m + k] = e[k] + (R == NULL ? F[gmf_mixed_at(index[i], k,
+					ldf, order)] : R[i * ldr + k]);
+		}
+	}
+	qsort(ref, size, sizeof(double) * m, gmf_mixed_compare);
+	lower = ref + size * m;
+	for (i = 0; i < size; ++i)
+	{
+		for (k = 0; k < m; ++k)
+		{
+			if (i % GMF_MIXED_BLOCK == 0 || ref[i * m + k]
+					< lower[i / GMF_MIXED_BLOCK * m + k])
+			{
+				lower[i / GMF_MIXED_BLOCK * m + k] = ref[i * m + k];
+			}
+		}
+	}
+	for (i = 0; i < n; ++i)
+	{
+		for (k = 0; k < m; ++k)
+		{
+			f[k] = F[gmf_mixed_at(i, k, ldf, order)];
+		}
+		if (!gmf_mixed_dominated(ref, lower, size, m, f, &witness))
+		{
+			index[count++] = i;
+		}
+	}
+	ok = gmf_mixed_double(problem, count, index, d, m, X, ldx, F, ldf, order);
+	free(index);
+	free(ref);
+	if (refined != NULL)
+	{
+		*refined = count;
+	}
+	return ok;
+}
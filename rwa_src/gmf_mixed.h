@@ -0,0 +1,51 @@
+/*
+ * gmf_mixed.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+#ifndef GMF_MIXED_H_
+#define GMF_MIXED_H_
+
+#include <stddef.h>
+#include "gmf_dv_rwa.h"
+
+/*
+ * Mixed-precision batch evaluation. All points are first evaluated in
+ * single precision (gmf_rwa_evaluate_typed with gmf_float32), then only the
+ * points that may be non-dominated with respect to the current front are
+ * evaluated again in double. With e_k = gmf_rwa_float_error of objective k,
+ * a point p keeps its single-precision values when some row r of the
+ * reference front has
+ *
+ *     R_r,k + e_k < F_p,k   for every k,
+ *
+ * so that r dominates p in double precision too. The reference front is
+ * given by the caller in R (size rows of nobjs double values, row-major
+ * with leading dimension ldr, e.g. from gmf_archive_get), or, if R is NULL,
+ * it is the single-precision front of the batch itself and the margin is
+ * 2 e_k. As long as the bounds hold:
+ *
+ *  - with R, every point not dominated by a row of R gets its double
+ *    values, so offering the batch to an archive holding R accepts the
+ *    same points as after a double evaluation;
+ *  - without R, the non-dominated points of the result are exactly those
+ *    of a double evaluation, with the same values.
+ *
+ * The other points may be off by e_k. Same layout as gmf_rwa_evaluate
+ * (objectives minimized, as the problem evaluates them). Only the double
+ * evaluations are counted on the problem handle; `refined` (may be NULL)
+ * gets their number. Problems without error bounds are evaluated in
+ * double. Returns 0 if memory runs out or the storage order is unknown.
+ *
+ * The filter is not free: sorting the batch (R NULL) takes about 300 ns
+ * a point, and a scan of R, in blocks of rows skipped by their lower
+ * corner, from 40 ns to a few microseconds for fronts of thousands of
+ * points in 5 to 7 objectives. That is more than a double evaluation of
+ * any of these polynomial problems: for them the plain single-precision
+ * path is the fast one, and the mode pays off only for costlier objectives.
+ */
+int gmf_rwa_mixed_evaluate(gmf_rwa_problem *problem, size_t n,
+		const double *X, size_t ldx, double *F, size_t ldf, int order,
+		const double *R, size_t size, size_t ldr, size_t *refined);
+
+#endif /* GMF_MIXED_H_ */
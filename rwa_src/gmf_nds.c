@@ -0,0 +1,837 @@
+/*
+ * gmf_nds.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "gmf_global.h"
+#include "gmf_nds.h"
+
+#define GMF_NDS_NONE ((size_t) -1)
+
+/**
+ * Points in lexicographic order: P holds them row by row, order[i] is the
+ * position of row i in F and rank[i] its front
+ */
+struct gmf_nds_work
+{
+	size_t n;
+	size_t d;
+	double *P;
+	size_t *order;
+	size_t *rank;
+};
+
+static int gmf_nds_less(const double *a, const double *b, size_t d)
+{
+	size_t k;
+	for (k = 0; k < d; ++k)
+	{
+		if (a[k] != b[k])
+		{
+			return a[k] < b[k];
+		}
+	}
+	return 0;
+}
+
+static int gmf_nds_equal(const double *a, const double *b, size_t d)
+{
+	size_t k;
+	for (k = 0; k < d && a[k] == b[k]; ++k)
+	{
+	}
+	return k == d;
+}
+
+/**
+ * q dominates p, knowing that q comes before p and differs from it: only
+ * objectives 1..d-1 need comparing
+ */
+static int gmf_nds_dominates(const double *q, const double *p, size_t d)
+{
+	size_t k;
+	for (k = 1; k < d; ++k)
+	{
+		if (q[k] > p[k])
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+static void gmf_nds_work_free(struct gmf_nds_work *work)
+{
+	free(work->P);
+	free(work->order);
+	free(work->rank);
+	return;
+}
+
+/**
+ * Copies F and sorts it lexicographically (bottom-up merge sort of the row
+ * indices, then one gather). Returns 0 if memory runs out.
+ */
+static int gmf_nds_work_init(struct gmf_nds_work *work, size_t n, size_t d,
+		const double *F, size_t ldf, int order)
+{
+	double *T = malloc(sizeof(double) * (n > 0 ? n : 1) * d);
+	size_t *tmp = malloc(sizeof(size_t) * (n > 0 ? n : 1)), *a, *b, *swap;
+	size_t width, lo, mid, hi, i, j, k, out;
+
+	memset(work, 0, sizeof(struct gmf_nds_work));
+	work->n = n;
+	work->d = d;
+	work->P = malloc(sizeof(double) * (n > 0 ? n : 1) * d);
+	work->order = malloc(sizeof(size_t) * (n > 0 ? n : 1));
+	work->rank = malloc(sizeof(size_t) * (n > 0 ? n : 1));
+	if (T == NULL || tmp == NULL || work->P == NULL || work->order == NULL
+			|| work->rank == NULL)
+	{
+		free(T);
+		free(tmp);
+		gmf_nds_work_free(work);
+		return 0;
+	}
+
+	for (i = 0; i < n; ++i)
+	{
+		for (k = 0; k < d; ++k)
+		{
+			T[i * d + k] = order == gmf_row_major ? F[i * ldf + k] :
+					F[k * ldf + i];
+		}
+		work->order[i] = i;
+	}
+	a = work->order;
+	b = tmp;
+	for (width = 1; width < n; width *= 2)
+	{
+		for (lo = 0; lo < n; lo += 2 * width)
+		{
+			mid = lo + width < n ? lo + width : n;
+			hi = lo + 2 * width < n ? lo + 2 * width : n;
+			for (i = lo, j = mid, out = lo; out < hi; ++out)
+			{
+				if (j >= hi || (i < mid && !gmf_nds_less(T + a[j] * d,
+						T + a[i] * d, d)))
+				{
+					b[out] = a[i++];
+				}
+				else
+				{
+					b[out] = a[j++];
+				}
+			}
+		}
+		swap = a;
+		a = b;
+		b = swap;
+	}
+	if (a != work->order)
+	{
+		memcpy(work->order, a, sizeof(size_t) * n);
+	}
+	for (i = 0; i < n; ++i)
+	{
+		memcpy(work->P + i * d, T + work->order[i] * d, sizeof(double) * d);
+	}
+	free(T);
+	free(tmp);
+	return 1;
+}
+
+/** **************************************************************************
+ ** Two objectives
+ ** **************************************************************************/
+static size_t gmf_nds_rank2(struct gmf_nds_work *work, double *last,
+		size_t limit)
+{
+	const double *p;
+	size_t i, lo, hi, mid, nfronts = 0;
+
+	for (i = 0; i < work->n; ++i)
+	{
+		p = work->P + 2 * i;
+		if (i > 0 && gmf_nds_equal(p, p - 2, 2))
+		{
+			work->rank[i] = work->rank[i - 1];
+			continue;
+		}
+		/* first front whose smallest f2 is above p's */
+		for (lo = 0, hi = nfronts; lo < hi;)
+		{
+			mid = (lo + hi) / 2;
+			if (last[mid] <= p[1])
+			{
+				lo = mid + 1;
+			}
+			else
+			{
+				hi = mid;
+			}
+		}
+		work->rank[i] = lo;
+		if (lo < limit)
+		{
+			nfronts += lo == nfronts;
+			last[lo] = p[1];
+		}
+	}
+	return nfronts;
+}
+
+/** **************************************************************************
+ ** Three objectives
+ ** **************************************************************************/
+
+/**
+ * (f2, f3) values of a front not dominated by one another: f2 increasing,
+ * f3 decreasing
+ */
+struct gmf_nds_stair
+{
+	double *step;
+	size_t size;
+	size_t capacity;
+};
+
+static size_t gmf_nds_stair_find(const struct gmf_nds_stair *stair, double x)
+{
+	size_t lo = 0, hi = stair->size, mid;
+	while (lo < hi)
+	{
+		mid = (lo + hi) / 2;
+		if (stair->step[2 * mid] < x)
+		{
+			lo = mid + 1;
+		}
+		else
+		{
+			hi = mid;
+		}
+	}
+	return lo;
+}
+
+/**
+ * Some point of the front dominates p: the last step with f2 <= p's has
+ * the smallest f3 among them
+ */
+static int gmf_nds_stair_dominates(const struct gmf_nds_stair *stair,
+		const double *p)
+{
+	size_t j = gmf_nds_stair_find(stair, p[1]);
+	if (j < stair->size && stair->step[2 * j] == p[1])
+	{
+		return stair->step[2 * j + 1] <= p[2];
+	}
+	return j > 0 && stair->step[2 * j - 1] <= p[2];
+}
+
+static int gmf_nds_stair_insert(struct gmf_nds_stair *stair, const double *p)
+{
+	size_t j = gmf_nds_stair_find(stair, p[1]), k;
+	double *step;
+
+	for (k = j; k < stair->size && stair->step[2 * k + 1] >= p[2]; ++k)
+	{
+	}
+	if (k == j && stair->size == stair->capacity)
+	{
+		stair->capacity = stair->capacity > 0 ? 2 * stair->capacity : 8;
+		step = realloc(stair->step, sizeof(double) * 2 * stair->capacity);
+		if (step == NULL)
+		{
+			return 0;
+		}
+		stair->step = step;
+	}
+	memmove(stair->step + 2 * (j + 1), stair->step + 2 * k,
+			sizeof(double) * 2 * (stair->size - k));
+	stair->step[2 * j] = p[1];
+	stair->step[2 * j + 1] = p[2];
+	stair->size = stair->size - (k - j) + 1;
+	return 1;
+}
+
+static size_t gmf_nds_rank3(struct gmf_nds_work *work,
+		struct gmf_nds_stair *stairs, size_t limit, int *ok)
+{
+	const double *p;
+	size_t i, lo, hi, mid, nfronts = 0;
+
+	for (i = 0; i < work->n; ++i)
+	{
+		p = work->P + 3 * i;
+		if (i > 0 && gmf_nds_equal(p, p - 3, 3))
+		{
+			work->rank[i] = work->rank[i - 1];
+			continue;
+		}
+		for (lo = 0, hi = nfronts; lo < hi;)
+		{
+			mid = (lo + hi) / 2;
+			if (gmf_nds_stair_dominates(&stairs[mid], p))
+			{
+				lo = mid + 1;
+			}
+			else
+			{
+				hi = mid;
+			}
+		}
+		work->rank[i] = lo;
+		if (lo < limit)
+		{
+			nfronts += lo == nfronts;
+			if (!gmf_nds_stair_insert(&stairs[lo], p))
+			{
+				*ok = 0;
+				return nfronts;
+			}
+		}
+	}
+	return nfronts;
+}
+
+/** **************************************************************************
+ ** Four and more objectives
+ ** **************************************************************************/
+
+/* Points per leaf of a dominance tree */
+#define GMF_NDS_BUCKET 16
+
+/**
+ * Node of a dominance tree (after the NDTree of ENS-NDT, Gustavsson &
+ * Syberfeldt 2018). An inner node sends points with f_k < value left and the
+ * others right; a leaf keeps copies of its points in a bucket, so scanning
+ * it reads contiguous memory. Every node also keeps the lower corner of its
+ * points, so a subtree that cannot hold a point dominating the query is
+ * skipped whole.
+ */
+struct gmf_nds_node
+{
+	size_t left; /* GMF_NDS_NONE for a leaf */
+	size_t right;
+	size_t k;
+	double value;
+	size_t bucket;
+	size_t count;
+};
+
+/**
+ * Dominance trees of all the fronts, nodes and buckets taken from growing
+ * pools
+ */
+struct gmf_nds_forest
+{
+	size_t d;
+	struct gmf_nds_node *node;
+	double *lower; /* d values per node */
+	size_t size;
+	size_t capacity;
+	double *bucket; /* GMF_NDS_BUCKET points of d values per bucket */
+	size_t nbuckets;
+	size_t bucket_capacity;
+	double *split; /* points of the leaf being split */
+};
+
+static void *gmf_nds_grow(void *data, size_t *capacity, size_t size,
+		size_t bytes)
+{
+	size_t wanted = *capacity > 0 ? *capacity : 64;
+	while (wanted <= size)
+	{
+		wanted *= 2;
+	}
+	data = realloc(data, bytes * wanted);
+	if (data != NULL)
+	{
+		*capacity = wanted;
+	}
+	return data;
+}
+
+/**
+ * New leaf with an empty bucket (bucket GMF_NDS_NONE: take a new one)
+ */
+static size_t gmf_nds_leaf_new(struct gmf_nds_forest *forest, size_t bucket)
+{
+	size_t d = forest->d, capacity, k;
+	struct gmf_nds_node *node;
+	double *data;
+
+	if (forest->size == forest->capacity)
+	{
+		capacity = forest->capacity;
+		node = gmf_nds_grow(forest->node, &capacity, forest->size,
+				sizeof(struct gmf_nds_node));
+		if (node == NULL)
+		{
+			return GMF_NDS_NONE;
+		}
+		forest->node = node;
+		data = realloc(forest->lower, sizeof(double) * d * capacity);
+		if (data == NULL)
+		{
+			return GMF_NDS_NONE;
+		}
+		forest->lower = data;
+		forest->capacity = capacity;
+	}
+	if (bucket == GMF_NDS_NONE)
+	{
+		if (forest->nbuckets == forest->bucket_capacity)
+		{
+			data = gmf_nds_grow(forest->bucket, &forest->bucket_capacity,
+					forest->nbuckets, sizeof(double) * d * GMF_NDS_BUCKET);
+			if (data == NULL)
+			{
+				return GMF_NDS_NONE;
+			}
+			forest->bucket = data;
+		}
+		bucket = forest->nbuckets++;
+	}
+	node = &forest->node[forest->size];
+	node->left = GMF_NDS_NONE;
+	node->right = GMF_NDS_NONE;
+	node->bucket = bucket;
+	node->count = 0;
+	for (k = 0; k < d; ++k)
+	{
+		forest->lower[forest->size * d + k] = HUGE_VAL;
+	}
+	return forest->size++;
+}
+
+static void gmf_nds_lower(double *lower, const double *p, size_t d)
+{
+	size_t k;
+	for (k = 1; k < d; ++k)
+	{
+		lower[k] = p[k] < lower[k] ? p[k] : lower[k];
+	}
+	return;
+}
+
+static void gmf_nds_leaf_add(struct gmf_nds_forest *forest, size_t id,
+		const double *p)
+{
+	struct gmf_nds_node *node = &forest->node[id];
+	size_t d = forest->d;
+	memcpy(forest->bucket + (node->bucket * GMF_NDS_BUCKET + node->count) * d,
+			p, sizeof(double) * d);
+	node->count++;
+	gmf_nds_lower(forest->lower + id * d, p, d);
+	return;
+}
+
+/**
+ * Splits a full leaf at the middle of the range of an objective, the first
+ * whose values differ starting from k (objectives cycle with the depth).
+ * Points of one front always differ somewhere in f2..fd, or one would
+ * dominate the other.
+ */
+static int gmf_nds_leaf_split(struct gmf_nds_forest *forest, size_t id,
+		size_t k)
+{
+	size_t d = forest->d, n = forest->node[id].count, tries, i, left, right;
+	double *points = forest->split, lo = 0.0, hi = 0.0, value;
+
+	memcpy(points, forest->bucket + forest->node[id].bucket * GMF_NDS_BUCKET * d,
+			sizeof(double) * n * d);
+	for (tries = 1; tries < d; ++tries, k = k % (d - 1) + 1)
+	{
+		lo = hi = points[k];
+		for (i = 1; i < n; ++i)
+		{
+			lo = points[i * d + k] < lo ? points[i * d + k] : lo;
+			hi = points[i * d + k] > hi ? points[i * d + k] : hi;
+		}
+		if (lo < hi)
+		{
+			break;
+		}
+	}
+	if (tries == d)
+	{
+		return 0;
+	}
+	value = lo + 0.5 * (hi - lo);
+	value = value > lo ? value : hi;
+
+	/* the left leaf takes over the bucket */
+	left = gmf_nds_leaf_new(forest, forest->node[id].bucket);
+	right = gmf_nds_leaf_new(forest, GMF_NDS_NONE);
+	if (left == GMF_NDS_NONE || right == GMF_NDS_NONE)
+	{
+		return 0;
+	}
+	for (i = 0; i < n; ++i)
+	{
+		gmf_nds_leaf_add(forest, points[i * d + k] < value ? left : right,
+				points + i * d);
+	}
+	forest->node[id].left = left;
+	forest->node[id].right = right;
+	forest->node[id].k = k;
+	forest->node[id].value = value;
+	return 1;
+}
+
+static int gmf_nds_tree_insert(struct gmf_nds_forest *forest, size_t root,
+		const double *p)
+{
+	size_t d = forest->d, id = root, depth = 0;
+
+	while (forest->node[id].left != GMF_NDS_NONE)
+	{
+		gmf_nds_lower(forest->lower + id * d, p, d);
+		id = p[forest->node[id].k] < forest->node[id].value ?
+				forest->node[id].left : forest->node[id].right;
+		++depth;
+	}
+	if (forest->node[id].count == GMF_NDS_BUCKET)
+	{
+		if (!gmf_nds_leaf_split(forest, id, depth % (d - 1) + 1))
+		{
+			return 0;
+		}
+		return gmf_nds_tree_insert(forest, id, p);
+	}
+	gmf_nds_leaf_add(forest, id, p);
+	return 1;
+}
+
+/**
+ * Some point of the tree rooted at id dominates p
+ */
+static int gmf_nds_tree_dominates(const struct gmf_nds_forest *forest,
+		size_t id, const double *p)
+{
+	const struct gmf_nds_node *node = &forest->node[id];
+	const double *lower = forest->lower + id * forest->d, *q;
+	size_t d = forest->d, k, i;
+
+	for (k = 1; k < d; ++k)
+	{
+		if (lower[k] > p[k])
+		{
+			return 0;
+		}
+	}
+	if (node->left == GMF_NDS_NONE)
+	{
+		q = forest->bucket + node->bucket * GMF_NDS_BUCKET * d;
+		for (i = 0; i < node->count; ++i, q += d)
+		{
+			if (gmf_nds_dominates(q, p, d))
+			{
+				return 1;
+			}
+		}
+		return 0;
+	}
+	return gmf_nds_tree_dominates(forest, node->left, p)
+			|| (p[node->k] >= node->value
+					&& gmf_nds_tree_dominates(forest, node->right, p));
+}
+
+static void gmf_nds_forest_free(struct gmf_nds_forest *forest)
+{
+	free(forest->node);
+	free(forest->lower);
+	free(forest->bucket);
+	free(forest->split);
+	return;
+}
+
+static int gmf_nds_forest_init(struct gmf_nds_forest *forest, size_t d)
+{
+	memset(forest, 0, sizeof(struct gmf_nds_forest));
+	forest->d = d;
+	forest->split = malloc(sizeof(double) * d * GMF_NDS_BUCKET);
+	return forest->split != NULL;
+}
+
+/**
+ * Empties the forest, keeping its storage
+ */
+static void gmf_nds_forest_clear(struct gmf_nds_forest *forest)
+{
+	forest->size = 0;
+	forest->nbuckets = 0;
+	return;
+}
+
+/**
+ * ENS-BS with one dominance tree per front
+ */
+static size_t gmf_nds_rank_ens(struct gmf_nds_work *work, size_t *root,
+		size_t limit, int *ok)
+{
+	struct gmf_nds_forest forest;
+	const double *p;
+	size_t i, lo, hi, mid, nfronts = 0, d = work->d;
+
+	if (!gmf_nds_forest_init(&forest, d))
+	{
+		*ok = 0;
+		return 0;
+	}
+	for (i = 0; i < work->n; ++i)
+	{
+		p = work->P + i * d;
+		if (i > 0 && gmf_nds_equal(p, p - d, d))
+		{
+			work->rank[i] = work->rank[i - 1];
+			continue;
+		}
+		for (lo = 0, hi = nfronts; lo < hi;)
+		{
+			mid = (lo + hi) / 2;
+			if (gmf_nds_tree_dominates(&forest, root[mid], p))
+			{
+				lo = mid + 1;
+			}
+			else
+			{
+				hi = mid;
+			}
+		}
+		work->rank[i] = lo;
+		if (lo < limit)
+		{
+			if (lo == nfronts)
+			{
+				root[nfronts] = gmf_nds_leaf_new(&forest, GMF_NDS_NONE);
+				if (root[nfronts++] == GMF_NDS_NONE)
+				{
+					*ok = 0;
+					break;
+				}
+			}
+			if (!gmf_nds_tree_insert(&forest, root[lo], p))
+			{
+				*ok = 0;
+				break;
+			}
+		}
+	}
+	gmf_nds_forest_free(&forest);
+	return nfronts;
+}
+
+/**
+ * Kung's algorithm on the distinct points idx[l..r): the front of the top
+ * half, then the points of the bottom half's front that it does not
+ * dominate, tested against a dominance tree of the top front. The front is
+ * left in idx[l..) and its size returned.
+ */
+static size_t gmf_nds_kung(const struct gmf_nds_work *work,
+		struct gmf_nds_forest *forest, size_t *idx, size_t l, size_t r, int *ok)
+{
+	size_t m, nt, nb, count, i, root, d = work->d;
+
+	if (r - l <= 1 || !*ok)
+	{
+		return r - l;
+	}
+	m = l + (r - l) / 2;
+	nt = gmf_nds_kung(work, forest, idx, l, m, ok);
+	nb = gmf_nds_kung(work, forest, idx, m, r, ok);
+	if (!*ok)
+	{
+		return 0;
+	}
+
+	gmf_nds_forest_clear(forest);
+	root = gmf_nds_leaf_new(forest, GMF_NDS_NONE);
+	*ok = root != GMF_NDS_NONE;
+	for (i = l; *ok && i < l + nt; ++i)
+	{
+		*ok = gmf_nds_tree_insert(forest, root, work->P + idx[i] * d);
+	}
+	if (!*ok)
+	{
+		return 0;
+	}
+	count = nt;
+	for (i = m; i < m + nb; ++i)
+	{
+		if (!gmf_nds_tree_dominates(forest, root, work->P + idx[i] * d))
+		{
+			idx[l + count++] = idx[i];
+		}
+	}
+	return count;
+}
+
+/** **************************************************************************
+ ** Entry points
+ ** **************************************************************************/
+
+/**
+ * Ranks the sorted points, tracking at most limit fronts (points behind
+ * them get rank limit). Returns 0 if memory runs out.
+ */
+static int gmf_nds_rank_sorted(struct gmf_nds_work *work, size_t limit,
+		size_t *nfronts)
+{
+	size_t n = work->n > 0 ? work->n : 1, i;
+	struct gmf_nds_stair *stairs;
+	size_t *root;
+	double *last;
+	int ok = 1;
+
+	limit = limit < n ? limit : n;
+	if (work->d == 2)
+	{
+		last = malloc(sizeof(double) * limit);
+		if (last == NULL)
+		{
+			return 0;
+		}
+		*nfronts = gmf_nds_rank2(work, last, limit);
+		free(last);
+	}
+	else if (work->d == 3)
+	{
+		stairs = calloc(limit, sizeof(struct gmf_nds_stair));
+		if (stairs == NULL)
+		{
+			return 0;
+		}
+		*nfronts = gmf_nds_rank3(work, stairs, limit, &ok);
+		for (i = 0; i < limit; ++i)
+		{
+			free(stairs[i].step);
+		}
+		free(stairs);
+	}
+	else
+	{
+		root = malloc(sizeof(size_t) * limit);
+		if (root == NULL)
+		{
+			return 0;
+		}
+		*nfronts = gmf_nds_rank_ens(work, root, limit, &ok);
+		free(root);
+	}
+	return ok;
+}
+
+int gmf_nds_rank(size_t n, size_t nobjs, const double *F, size_t ldf,
+		int order, size_t *rank, size_t *nfronts)
+{
+	struct gmf_nds_work work;
+	size_t i;
+
+	if (nobjs < 2 || (order != gmf_row_major && order != gmf_col_major))
+	{
+		return 0;
+	}
+	if (!gmf_nds_work_init(&work, n, nobjs, F, ldf, order))
+	{
+		return 0;
+	}
+	if (!gmf_nds_rank_sorted(&work, n, nfronts))
+	{
+		gmf_nds_work_free(&work);
+		return 0;
+	}
+	for (i = 0; i < n; ++i)
+	{
+		rank[work.order[i]] = work.rank[i];
+	}
+	gmf_nds_work_free(&work);
+	return 1;
+}
+
+int gmf_nds_front(size_t n, size_t nobjs, const double *F, size_t ldf,
+		int order, size_t *front, size_t *size)
+{
+	struct gmf_nds_forest forest;
+	struct gmf_nds_work work;
+	size_t *idx, i, m = 0, count, nfronts;
+	int ok = 1;
+
+	if (nobjs < 2 || (order != gmf_row_major && order != gmf_col_major))
+	{
+		return 0;
+	}
+	if (!gmf_nds_work_init(&work, n, nobjs, F, ldf, order))
+	{
+		return 0;
+	}
+	if (nobjs <= 3)
+	{
+		ok = gmf_nds_rank_sorted(&work, 1, &nfronts);
+	}
+	else
+	{
+		/* Kung on the distinct points, copies follow their first instance */
+		idx = malloc(sizeof(size_t) * (n > 0 ? n : 1));
+		ok = idx != NULL;
+		for (i = 0; ok && i < n; ++i)
+		{
+			work.rank[i] = 1;
+			if (i == 0 || !gmf_nds_equal(work.P + i * nobjs,
+					work.P + (i - 1) * nobjs, nobjs))
+			{
+				idx[m++] = i;
+			}
+		}
+		ok = ok && gmf_nds_forest_init(&forest, nobjs);
+		if (ok)
+		{
+			count = gmf_nds_kung(&work, &forest, idx, 0, m, &ok);
+			for (i = 0; i < count; ++i)
+			{
+				work.rank[idx[i]] = 0;
+			}
+			for (i = 1; i < n; ++i)
+			{
+				if (gmf_nds_equal(work.P + i * nobjs, work.P + (i - 1) * nobjs,
+						nobjs))
+				{
+					work.rank[i] = work.rank[i - 1];
+				}
+			}
+			gmf_nds_forest_free(&forest);
+		}
+		free(idx);
+	}
+	if (!ok)
+	{
+		gmf_nds_work_free(&work);
+		return 0;
+	}
+
+	/* back to the original order: mark, then collect */
+	for (i = 0; i < n; ++i)
+	{
+		front[i] = 0;
+	}
+	for (i = 0; i < n; ++i)
+	{
+		front[work.order[i]] = work.rank[i] == 0;
+	}
+	for (i = 0, m = 0; i < n; ++i)
+	{
+		if (front[i])
+		{
+			front[m++] = i;
+		}
+	}
+	*size = m;
+	gmf_nds_work_free(&work);
+	return 1;
+}
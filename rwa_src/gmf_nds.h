@@ -0,0 +1,43 @@
+/*
+ * gmf_nds.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+#ifndef GMF_NDS_H_
+#define GMF_NDS_H_
+
+#include <stddef.h>
+
+/*
+ * Non-dominated sorting of minimized objective vectors. F holds point i in
+ * row i (gmf_row_major) or column i (gmf_col_major) with leading dimension
+ * ldf, as written by gmf_rwa_evaluate; values must not be NaN. Point a
+ * dominates b when it is no worse in every objective and better in one;
+ * equal points always share a front.
+ *
+ * Points are first sorted lexicographically, so a point can only be
+ * dominated by points before it, and then:
+ *
+ *  - 2 objectives: every front is summed up by the smallest f2 it holds,
+ *    and the front of a point is found by binary search, O(N log N).
+ *  - 3 objectives: every front keeps the staircase of its (f2, f3) values;
+ *    a point is tested against a front by one binary search in it and the
+ *    front is again found by binary search over the fronts.
+ *  - 4 and more: ENS-BS (Zhang et al. 2015), binary search over the fronts,
+ *    with every front held in a dominance tree (as in ENS-NDT) whose nodes
+ *    keep the lower corner of their points, so a test visits only subtrees
+ *    that may hold a dominating point. The first front alone uses Kung's
+ *    divide and conquer (Kung, Luccio & Preparata 1975), the bottom half
+ *    tested against a dominance tree of the top half's front.
+ *
+ * gmf_nds_rank gives the front of every point (0 for the non-dominated
+ * ones) and the number of fronts. gmf_nds_front gives the indices of the
+ * non-dominated points in increasing order (front must have room for n).
+ * Both return 0 if memory runs out or the arguments are invalid.
+ */
+int gmf_nds_rank(size_t n, size_t nobjs, const double *F, size_t ldf,
+		int order, size_t *rank, size_t *nfronts);
+int gmf_nds_front(size_t n, size_t nobjs, const double *F, size_t ldf,
+		int order, size_t *front, size_t *size);
+
+#endif /* GMF_NDS_H_ */
@@ -0,0 +1,374 @@
+/*
+ * gmf_parallel.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "gmf_global.h"
+#include "gmf_parallel.h"
+
+/**
+ * Slice of the iteration range owned by one worker. Padded to a cache line
+ * so that workers do not share lines while taking chunks.
+ */
+struct gmf_slice
+{
+	pthread_mutex_t lock;
+	size_t begin;
+	size_t end;
+	char pad[64];
+};
+
+struct gmf_pool
+{
+	int nthreads;
+	pthread_t *threads;
+	struct gmf_slice *slices;
+
+	pthread_mutex_t lock;
+	pthread_cond_t start;
+	pthread_cond_t done;
+	size_t generation;
+	int running;
+	int quit;
+
+	gmf_pool_task task;
+	void *arg;
+	size_t grain;
+};
+
+struct gmf_worker_arg
+{
+	gmf_pool *pool;
+	int id;
+};
+
+int gmf_cpu_count()
+{
+	long n = sysconf(_SC_NPROCESSORS_ONLN);
+	return n < 1 ? 1 : (int) n;
+}
+
+/**
+ * Takes the next chunk from the worker's own slice
+ */
+static int gmf_pool_take(gmf_pool *pool, int id, size_t *begin, size_t *end)
+{
+	struct gmf_slice *slice = &pool->slices[id];
+	int found = gmf_false;
+	pthread_mutex_lock(&slice->lock);
+	if (slice->begin < slice->end)
+	{
+		*begin = slice->begin;
+		*end = slice->end - slice->begin > pool->grain ?
+				slice->begin + pool->grain : slice->end;
+		slice->begin = *end;
+		found = gmf_true;
+	}
+	pthread_mutex_unlock(&slice->lock);
+	return found;
+}
+
+/**
+ * Moves the back half of the fullest other slice into the worker's slice
+ */
+static int gmf_pool_steal(gmf_pool *pool, int id)
+{
+	int i, victim = -1;
+	size_t size, best = 0, mid, end;
+	struct gmf_slice *slice;
+
+	for (i = 1; i < pool->nthreads; ++i)
+	{
+		slice = &pool->slices[(id + i) % pool->nthreads];
+		pthread_mutex_lock(&slice->lock);
+		size = slice->begin < slice->end ? slice->end - slice->begin : 0;
+		pthread_mutex_unlock(&slice->lock);
+		if (size > best)
+		{
+			best = size;
+			victim = (id + i) % pool->nthreads;
+		}
+	}
+	if (victim < 0)
+	{
+		return gmf_false;
+	}
+
+	slice = &pool->slices[victim];
+	pthread_mutex_lock(&slice->lock);
+	if (slice->begin >= slice->end)
+	{
+		pthread_mutex_unlock(&slice->lock);
+		return gmf_true; /* lost the race, look again */
+	}
+	end = slice->end;
+	size = end - slice->begin;
+	mid = size > pool->grain ? end - size / 2 : slice->begin;
+	slice->end = mid;
+	pthread_mutex_unlock(&slice->lock);
+
+	slice = &pool->slices[id];
+	pthread_mutex_lock(&slice->lock);
+	slice->begin = mid;
+	slice->end = end;
+	pthread_mutex_unlock(&slice->lock);
+	return gmf_true;
+}
+
+static void gmf_pool_work(gmf_pool *pool, int id)
+{
+	size_t begin, end;
+	for (;;)
+	{
+		while (gmf_pool_take(pool, id, &begin, &end))
+		{
+			pool->task(pool->arg, begin, end, id);
+		}
+		if (!gmf_pool_steal(pool, id))
+		{
+			break;
+		}
+	}
+	return;
+}
+
+static void *gmf_pool_main(void *ptr)
+{
+	struct gmf_worker_arg *worker = ptr;
+	gmf_pool *pool = worker->pool;
+	int id = worker->id;
+	size_t generation = 0;
+
+	free(worker);
+	for (;;)
+	{
+		pthread_mutex_lock(&pool->lock);
+		while (!pool->quit && pool->generation == generation)
+		{
+			pthread_cond_wait(&pool->start, &pool->lock);
+		}
+		if (pool->quit)
+		{
+			pthread_mutex_unlock(&pool->lock);
+			break;
+		}
+		generation = pool->generation;
+		pthread_mutex_unlock(&pool->lock);
+
+		gmf_pool_work(pool, id);
+
+		pthread_mutex_lock(&pool->lock);
+		if (--pool->running == 0)
+		{
+			pthread_cond_signal(&pool->done);
+		}
+		pthread_mutex_unlock(&pool->lock);
+	}
+	return NULL;
+}
+
+/**
+ * Creates a pool of nthreads workers (the caller included).
+ * nthreads <= 0 uses one worker per online CPU.
+ */
+gmf_pool *gmf_pool_create(int nthreads)
+{
+	gmf_pool *pool;
+	struct gmf_worker_arg *worker;
+	int i;
+
+	if (nthreads <= 0)
+	{
+		nthreads = gmf_cpu_count();
+	}
+	pool = calloc(1, sizeof(gmf_pool));
+	if (pool == NULL)
+	{
+		return NULL;
+	}
+	pool->nthreads = nthreads;
+	pool->threads = malloc(sizeof(pthread_t) * nthreads);
+	pool->slices = calloc(nthreads, sizeof(struct gmf_slice));
+	if (pool->threads == NULL || pool->slices == NULL)
+	{
+		free(pool->threads);
+		free(pool->slices);
+		free(pool);
+		return NULL;
+	}
+	for (i = 0; i < nthreads; ++i)
+	{
+		pthread_mutex_init(&pool->slices[i].lock, NULL);
+	}
+	pthread_mutex_init(&pool->lock, NULL);
+	pthread_cond_init(&pool->start, NULL);
+	pthread_cond_init(&pool->done, NULL);
+
+	for (i = 1; i < nthreads; ++i)
+	{
+		worker = malloc(sizeof(struct gmf_worker_arg));
+		if (worker == NULL)
+		{
+			pool->nthreads = i;
+			break;
+		}
+		worker->pool = pool;
+		worker->id = i;
+		if (pthread_create(&pool->threads[i], NULL, gmf_pool_main, worker) != 0)
+		{
+			/* run with the threads we could start */
+			free(worker);
+			pool->nthreads = i;
+			break;
+		}
+	}
+	return pool;
+}
+
+void gmf_pool_destroy(gmf_pool *pool)
+{
+	int i;
+	if (pool == NULL)
+	{
+		return;
+	}
+	pthread_mutex_lock(&pool->lock);
+	pool->quit = gmf_true;
+	pthread_cond_broadcast(&pool->start);
+	pthread_mutex_unlock(&pool->lock);
+	for (i = 1; i < pool->nthreads; ++i)
+	{
+		pthread_join(pool->threads[i], NULL);
+	}
+	for (i = 0; i < pool->nthreads; ++i)
+	{
+		pthread_mutex_destroy(&pool->slices[i].lock);
+	}
+	pthread_mutex_destroy(&pool->lock);
+	pthread_cond_destroy(&pool->start);
+	pthread_cond_destroy(&pool->done);
+	free(pool->threads);
+	free(pool->slices);
+	free(pool);
+	return;
+}
+
+int gmf_pool_size(const gmf_pool *pool)
+{
+	return pool->nthreads;
+}
+
+/**
+ * Runs task over [0, n) in chunks of at most grain indices (grain 0 picks
+ * about 16 chunks per worker) and returns when every index has been done.
+ */
+void gmf_pool_for(gmf_pool *pool, size_t n, size_t grain, gmf_pool_task task,
+		void *arg)
+{
+	int i;
+	size_t per;
+
+	if (n == 0)
+	{
+		return;
+	}
+	if (grain == 0)
+	{
+		grain = n / (16 * (size_t) pool->nthreads);
+		grain = grain < 1 ? 1 : grain;
+	}
+	if (pool->nthreads == 1 || n <= grain)
+	{
+		task(arg, 0, n, 0);
+		return;
+	}
+
+	per = n / pool->nthreads;
+	for (i = 0; i < pool->nthreads; ++i)
+	{
+		pool->slices[i].begin = per * i;
+		pool->slices[i].end = i == pool->nthreads - 1 ? n : per * (i + 1);
+	}
+	pool->task = task;
+	pool->arg = arg;
+	pool->grain = grain;
+
+	pthread_mutex_lock(&pool->lock);
+	pool->running = pool->nthreads - 1;
+	pool->generation++;
+	pthread_cond_broadcast(&pool->start);
+	pthread_mutex_unlock(&pool->lock);
+
+	gmf_pool_work(pool, 0);
+
+	pthread_mutex_lock(&pool->lock);
+	while (pool->running > 0)
+	{
+		pthread_cond_wait(&pool->done, &pool->lock);
+	}
+	pthread_mutex_unlock(&pool->lock);
+	return;
+}
+
+/** **************************************************************************
+ ** Parallel batch evaluation
+ ** **************************************************************************/
+struct gmf_eval_arg
+{
+	gmf_rwa_problem *problem;
+	const double *X;
+	size_t ldx;
+	double *F;
+	size_t ldf;
+	int order;
+};
+
+static void gmf_eval_task(void *ptr, size_t begin, size_t end, int worker)
+{
+	struct gmf_eval_arg *arg = ptr;
+	(void) worker;
+	if (arg->order == gmf_row_major)
+	{
+		gmf_rwa_eval_batch(arg->problem, end - begin, arg->X + begin * arg->ldx,
+				arg->ldx, arg->F + begin * arg->ldf, arg->ldf, arg->order);
+	}
+	else
+	{
+		gmf_rwa_eval_batch(arg->problem, end - begin, arg->X + begin, arg->ldx,
+				arg->F + begin, arg->ldf, arg->order);
+	}
+	return;
+}
+
+/**
+ * Evaluates n points on the pool, same layout as gmf_rwa_evaluate.
+ * Row i of F (column i in column-major order) always comes from point i of
+ * X, whatever the number of threads.
+ */
+int gmf_rwa_parallel_evaluate(gmf_pool *pool, gmf_rwa_problem *problem,
+		size_t n, const double *X, size_t ldx, double *F, size_t ldf, int order)
+{
+	struct gmf_eval_arg arg;
+	size_t grain;
+
+	if (order != gmf_row_major && order != gmf_col_major)
+	{
+		return 0;
+	}
+	arg.problem = problem;
+	arg.X = X;
+	arg.ldx = ldx;
+	arg.F = F;
+	arg.ldf = ldf;
+	arg.order = order;
+
+	/* chunks of whole cache lines and SIMD vectors, ~16 per worker */
+	grain = n / (16 * (size_t) gmf_pool_size(pool));
+	grain = grain < 512 ? 512 : (grain + 7) & ~(size_t) 7;
+	gmf_pool_for(pool, n, grain, gmf_eval_task, &arg);
+	return 1;
+}
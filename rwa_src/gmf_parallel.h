@@ -0,0 +1,37 @@
+/*
+ * gmf_parallel.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+#ifndef GMF_PARALLEL_H_
+#define GMF_PARALLEL_H_
+
+#include <stddef.h>
+#include "gmf_dv_rwa.h"
+
+/*
+ * Pool of worker threads running parallel loops over [0, n). Every worker
+ * owns a contiguous slice of the range and takes grain-sized chunks from its
+ * front; a worker that runs out of work steals the back half of the largest
+ * slice it finds. The calling thread takes part as worker 0.
+ *
+ * Each index is handed to the task exactly once, so a task that writes
+ * output i only from input i gives the same result for any thread count.
+ * Loops must not be nested, and a pool runs one loop at a time.
+ */
+typedef struct gmf_pool gmf_pool;
+
+typedef void (*gmf_pool_task)(void *arg, size_t begin, size_t end,
+		int worker);
+
+gmf_pool *gmf_pool_create(int nthreads);
+void gmf_pool_destroy(gmf_pool *pool);
+int gmf_pool_size(const gmf_pool *pool);
+int gmf_cpu_count();
+void gmf_pool_for(gmf_pool *pool, size_t n, size_t grain, gmf_pool_task task,
+		void *arg);
+
+int gmf_rwa_parallel_evaluate(gmf_pool *pool, gmf_rwa_problem *problem,
+		size_t n, const double *X, size_t ldx, double *F, size_t ldf, int order);
+
+#endif /* GMF_PARALLEL_H_ */
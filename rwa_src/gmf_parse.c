@@ -0,0 +1,353 @@
+/*
+ * gmf_parse.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "gmf_parse.h"
+
+static const double exact_pow10[23] =
+{ 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13,
+		1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+static int gmf_is_digit(char c)
+{
+	return c >= '0' && c <= '9';
+}
+
+static int gmf_is_blank(char c)
+{
+	return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+/**
+ * strtod on the token starting at s (up to the next blank or end)
+ */
+static const char *gmf_parse_slow(const char *s, const char *end,
+		double *value)
+{
+	char token[1024], *stop; /* DBL_MAX in %f is 309 digits */
+	size_t n = 0;
+	while (s + n < end && !gmf_is_blank(s[n]) && s[n] != '\n')
+	{
+		++n;
+	}
+	if (n == 0 || n >= sizeof(token))
+	{
+		return NULL;
+	}
+	memcpy(token, s, n);
+	token[n] = '\0';
+	*value = strtod(token, &stop);
+	return stop == token ? NULL : s + (stop - token);
+}
+
+/**
+ * Converts the number at the start of [s, end). Returns the first character
+ * after it, or NULL if there is no number.
+ */
+const char *gmf_parse_double(const char *s, const char *end, double *value)
+{
+	const char *p = s, *q;
+	uint64_t w = 0;
+	int nd = 0, e10 = 0, exponent = 0, negative = 0, exact = 1, any = 0;
+	double v;
+
+	if (p < end && (*p == '-' || *p == '+'))
+	{
+		negative = *p++ == '-';
+	}
+	while (p < end && *p == '0')
+	{
+		any = 1;
+		++p;
+	}
+	for (; p < end && gmf_is_digit(*p); ++p)
+	{
+		any = 1;
+		if (nd < 19)
+		{
+			w = 10 * w + (uint64_t) (*p - '0');
+			++nd;
+		}
+		else
+		{
+			++e10;
+			exact &= *p == '0';
+		}
+	}
+	if (p < end && *p == '.')
+	{
+		++p;
+		if (nd == 0)
+		{
+			for (; p < end && *p == '0'; ++p)
+			{
+				any = 1;
+				--e10;
+			}
+		}
+		for (; p < end && gmf_is_digit(*p); ++p)
+		{
+			any = 1;
+			if (nd < 19)
+			{
+				w = 10 * w + (uint64_t) (*p - '0');
+				++nd;
+				--e10;
+			}
+			else
+			{
+				exact &= *p == '0';
+			}
+		}
+	}
+	if (!any)
+	{
+		return gmf_parse_slow(s, end, value); /* inf, nan */
+	}
+	if (p < end && (*p == 'e' || *p == 'E'))
+	{
+		q = p + 1;
+		if (q < end && (*q == '-' || *q == '+'))
+		{
+			++q;
+		}
+		if (q < end && gmf_is_digit(*q))
+		{
+			for (p = q; p < end && gmf_is_digit(*p); ++p)
+			{
+				if (exponent < 100000)
+				{
+					exponent = 10 * exponent + (*p - '0');
+				}
+			}
+			e10 += q[-1] == '-' ? -exponent : exponent;
+		}
+	}
+	if (!exact || (p < end && !gmf_is_blank(*p) && *p != '\n'))
+	{
+		return gmf_parse_slow(s, end, value); /* long or hex numbers */
+	}
+
+	while (w != 0 && w % 10 == 0)
+	{
+		w /= 10;
+		++e10;
+	}
+	if (w == 0)
+	{
+		v = 0.0;
+	}
+	else if (w <= (uint64_t) 1 << 53 && e10 >= -22 && e10 <= 22)
+	{
+		v = (double) w;
+		v = e10 < 0 ? v / exact_pow10[-e10] : v * exact_pow10[e10];
+	}
+	else
+	{
+		return gmf_parse_slow(s, end, value);
+	}
+	*value = negative ? -v : v;
+	return p;
+}
+
+/**
+ * Reads more of the file behind the unparsed part of the buffer
+ */
+static void gmf_parser_fill(gmf_parser *parser)
+{
+	ssize_t got;
+	if (parser->begin > 0)
+	{
+		memmove(parser->buf, parser->buf + parser->begin,
+				parser->end - parser->begin);
+		parser->end -= parser->begin;
+		parser->begin = 0;
+	}
+	while (parser->end < GMF_PARSE_BUFSIZE)
+	{
+		got = read(parser->fd, parser->buf + parser->end,
+				GMF_PARSE_BUFSIZE - parser->end);
+		if (got <= 0)
+		{
+			parser->eof = 1;
+			break;
+		}
+		parser->end += (size_t) got;
+	}
+	return;
+}
+
+/**
+ * Returns the next line, [line, *eol), or NULL at the end of the file
+ */
+static const char *gmf_parser_line(gmf_parser *parser, const char **eol)
+{
+	const char *line, *nl;
+	for (;;)
+	{
+		line = parser->buf + parser->begin;
+		nl = memchr(line, '\n', parser->end - parser->begin);
+		if (nl != NULL || (parser->eof && parser->begin < parser->end))
+		{
+			*eol = nl != NULL ? nl : parser->buf + parser->end;
+			parser->begin = nl != NULL ? (size_t) (nl - parser->buf) + 1 :
+					parser->end;
+			parser->line++;
+			return line;
+		}
+		if (parser->eof)
+		{
+			return NULL;
+		}
+		if (parser->begin == 0 && parser->end == GMF_PARSE_BUFSIZE)
+		{
+			parser->failed = 1; /* line longer than the buffer */
+			return NULL;
+		}
+		gmf_parser_fill(parser);
+	}
+}
+
+static const char *gmf_skip_blanks(const char *p, const char *end)
+{
+	while (p < end && gmf_is_blank(*p))
+	{
+		++p;
+	}
+	return p;
+}
+
+/**
+ * Opens a text file of ncols numbers per line. With ncols = 0 the count is
+ * taken from the first non-blank line; otherwise a first line with another
+ * count is an error (pass gmf_mop.nobjs to check a POF file). Returns 0 on
+ * failure.
+ */
+int gmf_parser_open(gmf_parser *parser, const char *file, size_t ncols)
+{
+	const char *line, *eol, *p;
+	size_t count;
+	double value;
+
+	memset(parser, 0, sizeof(gmf_parser));
+	parser->fd = open(file, O_RDONLY);
+	if (parser->fd < 0)
+	{
+		return 0;
+	}
+	parser->buf = malloc(GMF_PARSE_BUFSIZE);
+	if (parser->buf == NULL)
+	{
+		gmf_parser_close(parser);
+		return 0;
+	}
+
+	/* count the numbers of the first line, then rewind to it */
+	for (;;)
+	{
+		line = gmf_parser_line(parser, &eol);
+		if (line == NULL)
+		{
+			parser->ncols = ncols;
+			return !parser->failed; /* empty file */
+		}
+		p = gmf_skip_blanks(line, eol);
+		if (p < eol)
+		{
+			break;
+		}
+	}
+	parser->begin = (size_t) (line - parser->buf);
+	parser->line--;
+	for (count = 0; p < eol; ++count)
+	{
+		p = gmf_parse_double(p, eol, &value);
+		if (p == NULL)
+		{
+			gmf_parser_close(parser);
+			return 0;
+		}
+		p = gmf_skip_blanks(p, eol);
+	}
+	if (ncols != 0 && count != ncols)
+	{
+		gmf_parser_close(parser);
+		return 0;
+	}
+	parser->ncols = count;
+	return 1;
+}
+
+/**
+ * Reads the next point into row (ncols values). Blank lines are skipped.
+ * Returns 1 on success, 0 at the end of the file and -1 on a malformed
+ * line (its number is parser->line).
+ */
+int gmf_parser_next(gmf_parser *parser, double *row)
+{
+	const char *line, *eol, *p;
+	size_t k;
+
+	do
+	{
+		line = gmf_parser_line(parser, &eol);
+		if (line == NULL)
+		{
+			return parser->failed ? -1 : 0;
+		}
+		p = gmf_skip_blanks(line, eol);
+	} while (p == eol);
+
+	for (k = 0; k < parser->ncols; ++k)
+	{
+		p = gmf_parse_double(p, eol, &row[k]);
+		if (p == NULL)
+		{
+			parser->failed = 1;
+			return -1;
+		}
+		p = gmf_skip_blanks(p, eol);
+	}
+	if (p != eol)
+	{
+		parser->failed = 1;
+		return -1;
+	}
+	return 1;
+}
+
+/**
+ * Reads up to n points, one per row of X (ldx >= ncols). Returns the number
+ * read; check parser->failed to tell the end of the file from an error.
+ */
+size_t gmf_parser_read(gmf_parser *parser, size_t n, double *X, size_t ldx)
+{
+	size_t i;
+	for (i = 0; i < n; ++i)
+	{
+		if (gmf_parser_next(parser, X + i * ldx) != 1)
+		{
+			break;
+		}
+	}
+	return i;
+}
+
+void gmf_parser_close(gmf_parser *parser)
+{
+	if (parser->fd >= 0)
+	{
+		close(parser->fd);
+	}
+	free(parser->buf);
+	parser->fd = -1;
+	parser->buf = NULL;
+	return;
+}
@@ -0,0 +1,44 @@
+/*
+ * gmf_parse.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+#ifndef GMF_PARSE_H_
+#define GMF_PARSE_H_
+
+#include <stddef.h>
+
+#define GMF_PARSE_BUFSIZE (1 << 20)
+
+/*
+ * Streaming reader of whitespace-separated numeric text files with one point
+ * per line (the layout of the POF reference sets and of run dumps written
+ * with %e). The file is read in GMF_PARSE_BUFSIZE chunks into a buffer
+ * allocated once at open, and numbers are converted in place, so reading
+ * allocates nothing per line.
+ *
+ * A number whose significant digits fit in 53 bits once trailing zeros are
+ * dropped, and whose decimal exponent is at most 22 in magnitude, is
+ * converted exactly with one IEEE multiply or divide (Clinger's fast path);
+ * this covers most %e output. Anything else falls back to strtod, so the
+ * result is always the correctly rounded double.
+ */
+typedef struct gmf_parser
+{
+	int fd;
+	char *buf;
+	size_t begin;
+	size_t end;
+	int eof;
+	size_t ncols;
+	size_t line; /* last line read, for error messages */
+	int failed; /* malformed or too long line */
+} gmf_parser;
+
+int gmf_parser_open(gmf_parser *parser, const char *file, size_t ncols);
+int gmf_parser_next(gmf_parser *parser, double *row);
+size_t gmf_parser_read(gmf_parser *parser, size_t n, double *X, size_t ldx);
+void gmf_parser_close(gmf_parser *parser);
+const char *gmf_parse_double(const char *s, const char *end, double *value);
+
+#endif /* GMF_PARSE_H_ */
@@ -0,0 +1,269 @@
+/*
+ * gmf_pof.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "gmf_global.h"
+#include "gmf_dv_rwa.h"
+#include "gmf_parse.h"
+#include "gmf_pof.h"
+
+#define GMF_POF_MAGIC "GMFPOF\0"
+#define GMF_POF_BOM 0x01020304u
+
+_Static_assert(sizeof(struct gmf_pof_header) == 320,
+		"the POF header layout is part of the file format");
+
+/**
+ * Reads a text POF file (one point per line) into a malloc'd row-major
+ * matrix. The number of columns is taken from the first line.
+ */
+static double *gmf_pof_read_text(const char *txt_file, size_t *nobjs,
+		size_t *npoints)
+{
+	gmf_parser parser;
+	double *data = NULL, *tmp;
+	size_t n = 0, capacity = 0, got;
+
+	if (!gmf_parser_open(&parser, txt_file, 0) || parser.ncols == 0)
+	{
+		gmf_parser_close(&parser);
+		return NULL;
+	}
+	do
+	{
+		if (n == capacity)
+		{
+			capacity = capacity == 0 ? 1024 : 2 * capacity;
+			tmp = realloc(data, sizeof(double) * parser.ncols * capacity);
+			if (tmp == NULL)
+			{
+				free(data);
+				gmf_parser_close(&parser);
+				return NULL;
+			}
+			data = tmp;
+		}
+		got = gmf_parser_read(&parser, capacity - n, data + n * parser.ncols,
+				parser.ncols);
+		n += got;
+	} while (n == capacity);
+	gmf_parser_close(&parser);
+	if (parser.failed)
+	{
+		free(data);
+		return NULL;
+	}
+	*nobjs = parser.ncols;
+	*npoints = n;
+	return data;
+}
+
+/**
+ * Converts a text POF file into the binary format. sense holds the
+ * gmf_minimize/gmf_maximize sense of each objective (NULL: all minimized).
+ * The output is written to a temporary file and renamed, so concurrent
+ * readers never see a partial file. Returns 0 on failure.
+ */
+int gmf_pof_convert(const char *txt_file, const char *bin_file,
+		const int *sense)
+{
+	struct gmf_pof_header header;
+	char tmp_file[512];
+	double *data, *column;
+	size_t nobjs, npoints, i, k;
+	FILE *fp;
+	int fd, ok = 1;
+
+	data = gmf_pof_read_text(txt_file, &nobjs, &npoints);
+	if (data == NULL)
+	{
+		return 0;
+	}
+	if (nobjs > GMF_POF_MAXOBJS)
+	{
+		free(data);
+		return 0;
+	}
+
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, GMF_POF_MAGIC, 8);
+	header.byte_order = GMF_POF_BOM;
+	header.version = GMF_POF_VERSION;
+	header.nobjs = (uint32_t) nobjs;
+	header.npoints = npoints;
+	header.data_offset = sizeof(header);
+	for (k = 0; k < nobjs; ++k)
+	{
+		header.sense[k] = (int8_t) (sense != NULL ? sense[k] : gmf_minimize);
+		header.fmin[k] = npoints > 0 ? data[k] : 0.0;
+		header.fmax[k] = header.fmin[k];
+		for (i = 1; i < npoints; ++i)
+		{
+			if (data[i * nobjs + k] < header.fmin[k])
+			{
+				header.fmin[k] = data[i * nobjs + k];
+			}
+			if (data[i * nobjs + k] > header.fmax[k])
+			{
+				header.fmax[k] = data[i * nobjs + k];
+			}
+		}
+	}
+
+	/* a name unique to this call, even between threads of one process */
+	column = malloc(sizeof(double) * (npoints > 0 ? npoints : 1));
+	snprintf(tmp_file, sizeof(tmp_file), "%s.XXXXXX", bin_file);
+	fd = mkstemp(tmp_file);
+	if (fd >= 0)
+	{
+		fchmod(fd, 0644);
+	}
+	fp = fd >= 0 ? fdopen(fd, "wb") : NULL;
+	if (column == NULL || fp == NULL)
+	{
+		free(column);
+		free(data);
+		if (fp != NULL)
+		{
+			fclose(fp);
+		}
+		else if (fd >= 0)
+		{
+			close(fd);
+		}
+		if (fd >= 0)
+		{
+			remove(tmp_file);
+		}
+		return 0;
+	}
+	ok = fwrite(&header, sizeof(header), 1, fp) == 1;
+	for (k = 0; ok && k < nobjs; ++k)
+	{
+		for (i = 0; i < npoints; ++i)
+		{
+			column[i] = data[i * nobjs + k];
+		}
+		ok = fwrite(column, sizeof(double), npoints, fp) == npoints;
+	}
+	ok = fclose(fp) == 0 && ok;
+	free(column);
+	free(data);
+	if (!ok || rename(tmp_file, bin_file) != 0)
+	{
+		remove(tmp_file);
+		return 0;
+	}
+	return 1;
+}
+
+/**
+ * Maps a binary POF file. Returns 0 if it cannot be opened or is not a
+ * valid file for this machine.
+ */
+int gmf_pof_open(const char *bin_file, gmf_pof_view *view)
+{
+	const struct gmf_pof_header *header;
+	struct stat st;
+	size_t k;
+	int fd;
+
+	memset(view, 0, sizeof(gmf_pof_view));
+	fd = open(bin_file, O_RDONLY);
+	if (fd < 0)
+	{
+		return 0;
+	}
+	if (fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(*header))
+	{
+		close(fd);
+		return 0;
+	}
+	view->map_size = (size_t) st.st_size;
+	view->map = mmap(NULL, view->map_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (view->map == MAP_FAILED)
+	{
+		view->map = NULL;
+		return 0;
+	}
+
+	header = view->map;
+	if (memcmp(header->magic, GMF_POF_MAGIC, 8) != 0
+			|| header->byte_order != GMF_POF_BOM
+			|| header->version != GMF_POF_VERSION
+			|| header->nobjs > GMF_POF_MAXOBJS
+			|| header->data_offset % 8 != 0
+			|| header->data_offset > view->map_size
+			|| (view->map_size - header->data_offset) / sizeof(double)
+					/ (header->nobjs > 0 ? header->nobjs : 1) < header->npoints)
+	{
+		gmf_pof_close(view);
+		return 0;
+	}
+	view->nobjs = header->nobjs;
+	view->npoints = header->npoints;
+	view->sense = header->sense;
+	view->fmin = header->fmin;
+	view->fmax = header->fmax;
+	for (k = 0; k < view->nobjs; ++k)
+	{
+		view->column[k] = (const double*) ((const char*) view->map
+				+ header->data_offset) + k * view->npoints;
+	}
+	return 1;
+}
+
+/**
+ * Opens the reference set of a problem. mop->PF_file names the text file;
+ * its binary twin (same name plus "b") is created next to it when missing or
+ * older than the text file, then mapped.
+ */
+int gmf_pof_open_mop(const struct gmf_mop_desc *mop, gmf_pof_view *view)
+{
+	char bin_file[sizeof(mop->PF_file) + 1];
+	int sense[GMF_POF_MAXOBJS];
+	int function = gmf_rwa_index((char*) mop->name);
+	struct stat txt, bin;
+	size_t k;
+
+	snprintf(bin_file, sizeof(bin_file), "%sb", mop->PF_file);
+	if (stat(mop->PF_file, &txt) == 0
+			&& (stat(bin_file, &bin) != 0 || bin.st_mtime < txt.st_mtime))
+	{
+		for (k = 0; k < mop->nobjs && k < GMF_POF_MAXOBJS; ++k)
+		{
+			sense[k] = function >= 0 ? gmf_rwa_sense(function, k) : gmf_minimize;
+		}
+		gmf_pof_convert(mop->PF_file, bin_file, sense);
+	}
+	if (!gmf_pof_open(bin_file, view))
+	{
+		return 0;
+	}
+	if (view->nobjs != mop->nobjs)
+	{
+		gmf_pof_close(view);
+		return 0;
+	}
+	return 1;
+}
+
+void gmf_pof_close(gmf_pof_view *view)
+{
+	if (view->map != NULL)
+	{
+		munmap(view->map, view->map_size);
+	}
+	memset(view, 0, sizeof(gmf_pof_view));
+	return;
+}
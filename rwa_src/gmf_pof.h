@@ -0,0 +1,63 @@
+/*
+ * gmf_pof.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+#ifndef GMF_POF_H_
+#define GMF_POF_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct gmf_mop_desc;
+
+#define GMF_POF_MAXOBJS 16
+#define GMF_POF_VERSION 1
+
+/*
+ * Binary POF file (".pofb"): a fixed 320-byte header followed by the
+ * objective values stored by column, column k holding the npoints values of
+ * objective k. Values are native doubles; the byte-order mark rejects files
+ * written on a machine of the other endianness. Values are the minimized
+ * F components, sense[k] records the original sense of objective k.
+ */
+struct gmf_pof_header
+{
+	char magic[8]; /* "GMFPOF\0\0" */
+	uint32_t byte_order; /* 0x01020304 */
+	uint32_t version;
+	uint32_t nobjs;
+	uint32_t reserved;
+	uint64_t npoints;
+	uint64_t data_offset; /* bytes from the start of the file, 64-aligned */
+	int8_t sense[GMF_POF_MAXOBJS];
+	uint64_t reserved2;
+	double fmin[GMF_POF_MAXOBJS];
+	double fmax[GMF_POF_MAXOBJS];
+};
+
+/*
+ * Read-only view of a mapped binary POF file. Columns point straight into
+ * the mapping, so opening a file costs no parsing or copying and processes
+ * opening the same file share its page cache.
+ */
+typedef struct gmf_pof_view
+{
+	size_t nobjs;
+	size_t npoints;
+	const int8_t *sense;
+	const double *fmin;
+	const double *fmax;
+	const double *column[GMF_POF_MAXOBJS];
+
+	void *map;
+	size_t map_size;
+} gmf_pof_view;
+
+int gmf_pof_convert(const char *txt_file, const char *bin_file,
+		const int *sense);
+int gmf_pof_open(const char *bin_file, gmf_pof_view *view);
+int gmf_pof_open_mop(const struct gmf_mop_desc *mop, gmf_pof_view *view);
+void gmf_pof_close(gmf_pof_view *view);
+
+#endif /* GMF_POF_H_ */
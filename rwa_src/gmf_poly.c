@@ -0,0 +1,1322 @@
+/*
+ * gmf_poly.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "gmf_global.h"
+#include "gmf_poly.h"
+
+/** **************************************************************************
+ ** Monomial tables, by graded order. Coefficients of F (maximized
+ ** objectives negated).
+ ** **************************************************************************/
+/* Subasi2016: x0 = H, x1 = t, x2 = Sy, x3 = theta, x4 = Re */
+static const unsigned char subasi2016_power[17][5] =
+{
+{ 0, 0, 0, 0, 0 },
+{ 1, 0, 0, 0, 0 },
+{ 0, 1, 0, 0, 0 },
+{ 0, 0, 1, 0, 0 },
+{ 0, 0, 0, 1, 0 },
+{ 0, 0, 0, 0, 1 },
+{ 2, 0, 0, 0, 0 },
+{ 1, 1, 0, 0, 0 },
+{ 1, 0, 1, 0, 0 },
+{ 1, 0, 0, 1, 0 },
+{ 1, 0, 0, 0, 1 },
+{ 0, 1, 1, 0, 0 },
+{ 0, 1, 0, 1, 0 },
+{ 0, 1, 0, 0, 1 },
+{ 0, 0, 1, 1, 0 },
+{ 0, 0, 1, 0, 1 },
+{ 0, 0, 0, 1, 1 } };
+
+static const double subasi2016_coef[17][2] =
+{
+{ -89.027, 0.4753 },
+{ -0.3, -0.0181 },
+{ 0.096, 0.042 },
+{ 1.124, 0.05481 },
+{ 0.968, -0.0191 },
+{ -0.04148, -3.416e-05 },
+{ 0.0, 0.006777 },
+{ -0.0464, 0.0 },
+{ 0.0244, -0.008851 },
+{ -0.0159, 0.008702 },
+{ -0.0004151, 0.0 },
+{ -0.1111, 0.0 },
+{ 0.0, 0.01536 },
+{ 0.0, -2.761e-05 },
+{ 0.0, -0.0044 },
+{ 0.0004121, 9.714e-06 },
+{ -0.0004192, 0.0 } };
+
+static const double subasi2016_bounds[2][5] =
+{
+{ 20.0, 6.0, 20.0, 0.0, 8000.0 },
+{ 60.0, 15.0, 40.0, 30.0, 25000.0 } };
+
+/* Goel2007: x0 = a, x1 = DHA, x2 = DOA, x3 = OPTT */
+static const unsigned char goel2007_power[22][4] =
+{
+{ 0, 0, 0, 0 },
+{ 1, 0, 0, 0 },
+{ 0, 1, 0, 0 },
+{ 0, 0, 1, 0 },
+{ 0, 0, 0, 1 },
+{ 2, 0, 0, 0 },
+{ 1, 1, 0, 0 },
+{ 1, 0, 1, 0 },
+{ 1, 0, 0, 1 },
+{ 0, 2, 0, 0 },
+{ 0, 1, 1, 0 },
+{ 0, 1, 0, 1 },
+{ 0, 0, 2, 0 },
+{ 0, 0, 1, 1 },
+{ 0, 0, 0, 2 },
+{ 2, 1, 0, 0 },
+{ 2, 0, 1, 0 },
+{ 1, 2, 0, 0 },
+{ 1, 1, 1, 0 },
+{ 1, 0, 0, 2 },
+{ 0, 2, 1, 0 },
+{ 0, 1, 2, 0 } };
+
+static const double goel2007_coef[22][3] =
+{
+{ 0.153, 0.692, 0.37 },
+{ -0.322, 0.477, -0.205 },
+{ 0.396, -0.687, 0.0307 },
+{ 0.424, -0.08, 0.108 },
+{ 0.0226, -0.065, 1.019 },
+{ 0.175, -0.167, -0.135 },
+{ 0.0185, -0.0129, 0.0141 },
+{ -0.251, -0.0634, 0.208 },
+{ 0.0134, -0.0521, 0.353 },
+{ -0.0701, 0.0796, 0.0998 },
+{ 0.179, -0.0257, -0.0301 },
+{ 0.0296, 0.00156, 0.0 },
+{ 0.015, 0.0877, -0.226 },
+{ 0.0752, 0.00198, -0.0497 },
+{ 0.0192, 0.0184, -0.423 },
+{ 0.0, 0.0, 0.202 },
+{ 0.0, 0.0, -0.281 },
+{ 0.0, 0.0, -0.342 },
+{ 0.0, 0.0, -0.281 },
+{ 0.0, 0.0, -0.184 },
+{ 0.0, 0.0, -0.245 },
+{ 0.0, 0.0, 0.281 } };
+
+static const double goel2007_bounds[2][4] =
+{
+{ 0.0, 0.0, 0.0, 0.0 },
+{ 1.0, 1.0, 1.0, 1.0 } };
+
+/* Liao2008: x0 = t1, x1 = t2, x2 = t3, x3 = t4, x4 = t5 */
+static const unsigned char liao2008_power[17][5] =
+{
+{ 0, 0, 0, 0, 0 },
+{ 1, 0, 0, 0, 0 },
+{ 0, 1, 0, 0, 0 },
+{ 0, 0, 1, 0, 0 },
+{ 0, 0, 0, 1, 0 },
+{ 0, 0, 0, 0, 1 },
+{ 2, 0, 0, 0, 0 },
+{ 1, 1, 0, 0, 0 },
+{ 1, 0, 0, 1, 0 },
+{ 1, 0, 0, 0, 1 },
+{ 0, 2, 0, 0, 0 },
+{ 0, 1, 1, 0, 0 },
+{ 0, 1, 0, 1, 0 },
+{ 0, 0, 2, 0, 0 },
+{ 0, 0, 1, 1, 0 },
+{ 0, 0, 1, 0, 1 },
+{ 0, 0, 0, 2, 0 } };
+
+static const double liao2008_coef[17][3] =
+{
+{ 1640.2823, 6.5856, -0.0551 },
+{ 2.3573285, 1.15, 0.0181 },
+{ 2.3220035, -1.0427, 0.1024 },
+{ 4.5688768, 0.9738, 0.0421 },
+{ 7.7213633, 0.8364, 0.0 },
+{ 4.4559504, 0.0, 0.0 },
+{ 0.0, -0.1106, 0.0 },
+{ 0.0, 0.0, -0.0073 },
+{ 0.0, -0.3695, 0.0 },
+{ 0.0, 0.0861, 0.0 },
+{ 0.0, 0.0, -0.0241 },
+{ 0.0, 0.0, 0.024 },
+{ 0.0, 0.3628, -0.0118 },
+{ 0.0, -0.3437, 0.0 },
+{ 0.0, 0.0, -0.0204 },
+{ 0.0, 0.0, -0.008 },
+{ 0.0, 0.1764, 0.0109 } };
+
+static const double liao2008_bounds[2][5] =
+{
+{ 1.0, 1.0, 1.0, 1.0, 1.0 },
+{ 3.0, 3.0, 3.0, 3.0, 3.0 } };
+
+/* Ganesan2013: x0 = O2CH4, x1 = GV, x2 = T */
+static const unsigned char ganesan2013_power[10][3] =
+{
+{ 0, 0, 0 },
+{ 1, 0, 0 },
+{ 0, 1, 0 },
+{ 0, 0, 1 },
+{ 2, 0, 0 },
+{ 1, 1, 0 },
+{ 0, 1, 1 },
+{ 0, 0, 2 },
+{ 1, 2, 0 },
+{ 0, 1, 2 } };
+
+static const double ganesan2013_coef[10][3] =
+{
+{ 0.0007693838, -45.69999991508208, 0.180000000570825 },
+{ 0.000129502, 1.286896e-08, 0.0 },
+{ -2.71422e-05, -5.1648e-09, 0.0 },
+{ 0.0001669334, 2.810512e-08, -1.99125e-10 },
+{ -6.12917e-05, -8.3928e-09, 4.82325e-11 },
+{ 2.78518e-05, 5.38e-09, -4.956e-11 },
+{ 0.0, 3.52928e-09, -6.2835e-11 },
+{ -0.0001180597, -2.18428e-08, 1.792125e-10 },
+{ 0.0, -7.94088e-09, 0.0 },
+{ 0.0, 0.0, 7.38975e-11 } };
+
+static const double ganesan2013_bounds[2][3] =
+{
+{ 0.25, 10000.0, 600.0 },
+{ 0.55, 20000.0, 1100.0 } };
+
+/* Padhi2016: x0 = x1, x1 = x2, x2 = x3, x3 = x4, x4 = x5 */
+static const unsigned char padhi2016_power[20][5] =
+{
+{ 0, 0, 0, 0, 0 },
+{ 1, 0, 0, 0, 0 },
+{ 0, 1, 0, 0, 0 },
+{ 0, 0, 1, 0, 0 },
+{ 0, 0, 0, 1, 0 },
+{ 0, 0, 0, 0, 1 },
+{ 2, 0, 0, 0, 0 },
+{ 1, 1, 0, 0, 0 },
+{ 1, 0, 1, 0, 0 },
+{ 1, 0, 0, 1, 0 },
+{ 1, 0, 0, 0, 1 },
+{ 0, 2, 0, 0, 0 },
+{ 0, 1, 1, 0, 0 },
+{ 0, 1, 0, 1, 0 },
+{ 0, 1, 0, 0, 1 },
+{ 0, 0, 1, 1, 0 },
+{ 0, 0, 1, 0, 1 },
+{ 0, 0, 0, 2, 0 },
+{ 0, 0, 0, 1, 1 },
+{ 0, 0, 0, 0, 2 } };
+
+static const double padhi2016_coef[20][3] =
+{
+{ -1.74, 2.19, 0.095 },
+{ -0.42, 0.26, 0.013 },
+{ 0.27, -0.088, -0.008625 },
+{ -0.087, 0.037, -0.005458 },
+{ 0.19, -0.16, -0.012 },
+{ -0.18, 0.069, 0.0 },
+{ -0.11, 0.036, 0.001462 },
+{ -0.044, 0.0, -0.011 },
+{ 0.0, 0.11, -0.006188 },
+{ -0.034, -0.077, 0.008937 },
+{ -0.17, 0.0, -0.004563 },
+{ 0.0, 0.0, -0.0006635 },
+{ 0.0, -0.075, -0.012 },
+{ 0.028, 0.054, -0.001063 },
+{ 0.0, 0.0, 0.002438 },
+{ -0.093, 0.0, -0.001937 },
+{ 0.0, 0.09, -0.001188 },
+{ -0.036, 0.0, -0.001788 },
+{ 0.033, 0.041, -0.003312 },
+{ 0.025, 0.0, 0.0 } };
+
+static const double padhi2016_bounds[2][5] =
+{
+{ 1.0, 10.0, 850.0, 20.0, 4.0 },
+{ 1.4, 26.0, 1650.0, 40.0, 8.0 } };
+
+/* Gao2020: x0 = A, x1 = B, x2 = C, x3 = D, x4 = E, x5 = F, x6 = G, x7 = H,
+		x8 = J */
+static const unsigned char gao2020_power[55][9] =
+{
+{ 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+{ 1, 0, 0, 0, 0, 0, 0, 0, 0 },
+{ 0, 1, 0, 0, 0, 0, 0, 0, 0 },
+{ 0, 0, 1, 0, 0, 0, 0, 0, 0 },
+{ 0, 0, 0, 1, 0, 0, 0, 0, 0 },
+{ 0, 0, 0, 0, 1, 0, 0, 0, 0 },
+{ 0, 0, 0, 0, 0, 1, 0, 0, 0 },
+{ 0, 0, 0, 0, 0, 0, 1, 0, 0 },
+{ 0, 0, 0, 0, 0, 0, 0, 1, 0 },
+{ 0, 0, 0, 0, 0, 0, 0, 0, 1 },
+{ 2, 0, 0, 0, 0, 0, 0, 0, 0 },
+{ 1, 1, 0, 0, 0, 0, 0, 0, 0 },
+{ 1, 0, 1, 0, 0, 0, 0, 0, 0 },
+{ 1, 0, 0, 1, 0, 0, 0, 0, 0 },
+{ 1, 0, 0, 0, 1, 0, 0, 0, 0 },
+{ 1, 0, 0, 0, 0, 1, 0, 0, 0 },
+{ 1, 0, 0, 0, 0, 0, 1, 0, 0 },
+{ 1, 0, 0, 0, 0, 0, 0, 1, 0 },
+{ 1, 0, 0, 0, 0, 0, 0, 0, 1 },
+{ 0, 2, 0, 0, 0, 0, 0, 0, 0 },
+{ 0, 1, 1, 0, 0, 0, 0, 0, 0 },
+{ 0, 1, 0, 1, 0, 0, 0, 0, 0 },
+{ 0, 1, 0, 0, 1, 0, 0, 0, 0 },
+{ 0, 1, 0, 0, 0, 1, 0, 0, 0 },
+{ 0, 1, 0, 0, 0, 0, 1, 0, 0 },
+{ 0, 1, 0, 0, 0, 0, 0, 1, 0 },
+{ 0, 1, 0, 0, 0, 0, 0, 0, 1 },
+{ 0, 0, 2, 0, 0, 0, 0, 0, 0 },
+{ 0, 0, 1, 1, 0, 0, 0, 0, 0 },
+{ 0, 0, 1, 0, 1, 0, 0, 0, 0 },
+{ 0, 0, 1, 0, 0, 1, 0, 0, 0 },
+{ 0, 0, 1, 0, 0, 0, 1, 0, 0 },
+{ 0, 0, 1, 0, 0, 0, 0, 1, 0 },
+{ 0, 0, 1, 0, 0, 0, 0, 0, 1 },
+{ 0, 0, 0, 2, 0, 0, 0, 0, 0 },
+{ 0, 0, 0, 1, 1, 0, 0, 0, 0 },
+{ 0, 0, 0, 1, 0, 1, 0, 0, 0 },
+{ 0, 0, 0, 1, 0, 0, 1, 0, 0 },
+{ 0, 0, 0, 1, 0, 0, 0, 1, 0 },
+{ 0, 0, 0, 1, 0, 0, 0, 0, 1 },
+{ 0, 0, 0, 0, 2, 0, 0, 0, 0 },
+{ 0, 0, 0, 0, 1, 1, 0, 0, 0 },
+{ 0, 0, 0, 0, 1, 0, 1, 0, 0 },
+{ 0, 0, 0, 0, 1, 0, 0, 1, 0 },
+{ 0, 0, 0, 0, 1, 0, 0, 0, 1 },
+{ 0, 0, 0, 0, 0, 2, 0, 0, 0 },
+{ 0, 0, 0, 0, 0, 1, 1, 0, 0 },
+{ 0, 0, 0, 0, 0, 1, 0, 1, 0 },
+{ 0, 0, 0, 0, 0, 1, 0, 0, 1 },
+{ 0, 0, 0, 0, 0, 0, 2, 0, 0 },
+{ 0, 0, 0, 0, 0, 0, 1, 1, 0 },
+{ 0, 0, 0, 0, 0, 0, 1, 0, 1 },
+{ 0, 0, 0, 0, 0, 0, 0, 2, 0 },
+{ 0, 0, 0, 0, 0, 0, 0, 1, 1 },
+{ 0, 0, 0, 0, 0, 0, 0, 0, 2 } };
+
+static const double gao2020_coef[55][3] =
+{
+{ 171.33, -577.73, -0.81 },
+{ 23.25, 1.22, 0.0926 },
+{ -8.61, 19.56, -0.014 },
+{ -59.85, -102.05, 0.029 },
+{ -66.12, 1.83, 0.00769 },
+{ -15.29, -27.28, -0.0405 },
+{ -83.32, -2.52, -0.029 },
+{ 37.72, -5.43, -0.075 },
+{ 12.67, -37.48, 0.012 },
+{ 0.46, -0.45, 0.0104 },
+{ 3.64, -0.55, 0.00932 },
+{ -0.47, -2.94, 0.0263 },
+{ -0.3, 2.96, -0.00134 },
+{ -6.22, -0.66, 0.0148 },
+{ -0.62, -0.09, 0.00704 },
+{ -42.48, 0.43, -0.013 },
+{ 3.11, -0.12, -0.00655 },
+{ 4.45, 0.43, 0.0971 },
+{ -0.22, 0.7, -0.0108 },
+{ -0.99, 4.97, 0.00761 },
+{ 7.46, -8.05, -0.0254 },
+{ 3.28, -0.53, 0.00483 },
+{ 1.28, -4.43, -0.00963 },
+{ 1.02, 0.6, -0.0121 },
+{ -4.02, 0.46, 0.0702 },
+{ -2.29, 4.97, 0.0121 },
+{ -0.16, -0.046, -0.000194 },
+{ 30.5, 0.47, -0.016 },
+{ 19.25, -0.42, 0.0115 },
+{ -14.83, -6.03, -0.036 },
+{ 5.07, -0.21, -0.056 },
+{ -37.61, -2.63, 0.026 },
+{ -9.11, -0.17, 0.0401 },
+{ -0.32, 0.43, -0.0135 },
+{ 21.63, 0.91, -0.0124 },
+{ 8.53, -6.34, 0.0693 },
+{ 18.46, -6.36, 0.0316 },
+{ -14.28, -0.19, 0.00238 },
+{ -7.05, 0.22, -0.00732 },
+{ -0.24, -0.39, -0.00469 },
+{ 1.72, 2.08, -0.00961 },
+{ 2.05, 7.09, -0.0818 },
+{ 15.73, -3.06, 0.0574 },
+{ -0.77, 0.15, -0.00144 },
+{ -0.29, -0.68, 0.000995 },
+{ 72.42, 1.43, 0.024 },
+{ -4.77, 0.2, 0.0209 },
+{ 2.07, -0.14, 0.065 },
+{ 0.64, -0.88, 0.0199 },
+{ 11.2, -0.43, 0.0863 },
+{ 3.41, -0.45, -0.0495 },
+{ 1.76, 0.014, -0.0087 },
+{ 1.86, -1.06, 0.0019 },
+{ 0.48, -0.99, -0.00455 },
+{ -0.79, -0.98, 0.00756 } };
+
+static const double gao2020_bounds[2][9] =
+{
+{ 40.0, 0.35, 333.0, 20.0, 3000.0, 0.1, 308.0, 150.0, 0.1 },
+{ 100.0, 0.5, 363.0, 40.0, 4000.0, 3.0, 328.0, 200.0, 2.0 } };
+
+/* Xu2020: x0 = vc, x1 = fz, x2 = ap, x3 = ae */
+static const unsigned char xu2020_power[16][4] =
+{
+{ 0, 0, 0, 0 },
+{ 1, 0, 0, 0 },
+{ 0, 1, 0, 0 },
+{ 0, 0, 1, 0 },
+{ 0, 0, 0, 1 },
+{ 2, 0, 0, 0 },
+{ 1, 1, 0, 0 },
+{ 1, 0, 1, 0 },
+{ 1, 0, 0, 1 },
+{ 0, 2, 0, 0 },
+{ 0, 1, 1, 0 },
+{ 0, 1, 0, 1 },
+{ 0, 0, 2, 0 },
+{ 0, 0, 1, 1 },
+{ 0, 0, 0, 2 },
+{ 1, 1, 1, 1 } };
+
+static const double xu2020_coef[16][3] =
+{
+{ -54.3, 0.227, 0.0 },
+{ -1.18, -0.0072, 0.0 },
+{ -2429.0, 1.89, 0.0 },
+{ 104.2, -0.0203, 0.0 },
+{ 129.0, 0.3075, 0.0 },
+{ 0.066, 0.000355, 0.0 },
+{ -18.9, -0.198, 0.0 },
+{ -0.209, -0.000955, 0.0 },
+{ -0.673, -0.00656, 0.0 },
+{ 32117.0, 35.0, 0.0 },
+{ 265.0, 0.209, 0.0 },
+{ 1209.0, 0.783, 0.0 },
+{ -16.98, 0.00037, 0.0 },
+{ 22.76, 0.02275, 0.0 },
+{ -47.6, -0.0791, 0.0 },
+{ 0.0, 0.0, -127.32395447351627 } };
+
+static const double xu2020_bounds[2][4] =
+{
+{ 12.56, 0.02, 1.0, 0.5 },
+{ 25.12, 0.06, 5.0, 2.0 } };
+
+/* Vaidyanathan2004: x0 = a, x1 = DHA, x2 = DOA, x3 = OPTT */
+static const unsigned char vaidyanathan2004_power[22][4] =
+{
+{ 0, 0, 0, 0 },
+{ 1, 0, 0, 0 },
+{ 0, 1, 0, 0 },
+{ 0, 0, 1, 0 },
+{ 0, 0, 0, 1 },
+{ 2, 0, 0, 0 },
+{ 1, 1, 0, 0 },
+{ 1, 0, 1, 0 },
+{ 1, 0, 0, 1 },
+{ 0, 2, 0, 0 },
+{ 0, 1, 1, 0 },
+{ 0, 1, 0, 1 },
+{ 0, 0, 2, 0 },
+{ 0, 0, 1, 1 },
+{ 0, 0, 0, 2 },
+{ 2, 1, 0, 0 },
+{ 2, 0, 1, 0 },
+{ 1, 2, 0, 0 },
+{ 1, 1, 1, 0 },
+{ 1, 0, 0, 2 },
+{ 0, 2, 1, 0 },
+{ 0, 1, 2, 0 } };
+
+static const double vaidyanathan2004_coef[22][4] =
+{
+{ 0.692, 0.758, 0.37, 0.153 },
+{ 0.477, 0.358, -0.205, -0.322 },
+{ -0.687, -0.807, 0.0307, 0.396 },
+{ -0.08, 0.0925, 0.108, 0.424 },
+{ -0.065, -0.0468, 1.019, 0.0226 },
+{ -0.167, -0.172, -0.135, 0.175 },
+{ -0.0129, 0.0106, 0.0141, 0.0185 },
+{ -0.0634, -0.146, 0.208, -0.251 },
+{ -0.0521, -0.0694, 0.353, 0.0134 },
+{ 0.0796, 0.0697, 0.0998, -0.0701 },
+{ -0.0257, -0.0416, -0.0301, 0.179 },
+{ 0.00156, -0.00503, 0.0, 0.0296 },
+{ 0.0877, 0.102, -0.226, 0.015 },
+{ 0.00198, 0.0151, -0.0497, 0.0752 },
+{ 0.0184, 0.0173, -0.423, 0.0192 },
+{ 0.0, 0.0, 0.202, 0.0 },
+{ 0.0, 0.0, -0.281, 0.0 },
+{ 0.0, 0.0, -0.342, 0.0 },
+{ 0.0, 0.0, -0.281, 0.0 },
+{ 0.0, 0.0, -0.184, 0.0 },
+{ 0.0, 0.0, -0.245, 0.0 },
+{ 0.0, 0.0, 0.281, 0.0 } };
+
+static const double vaidyanathan2004_bounds[2][4] =
+{
+{ 0.0, 0.0, 0.0, 0.0 },
+{ 1.0, 1.0, 1.0, 1.0 } };
+
+/* Chen2015: x0 = l1, x1 = w1, x2 = l2, x3 = w2, x4 = a1, x5 = b1 */
+static const unsigned char chen2015_power[21][6] =
+{
+{ 0, 0, 0, 0, 0, 0 },
+{ 1, 0, 0, 0, 0, 0 },
+{ 0, 1, 0, 0, 0, 0 },
+{ 0, 0, 1, 0, 0, 0 },
+{ 0, 0, 0, 1, 0, 0 },
+{ 0, 0, 0, 0, 1, 0 },
+{ 0, 0, 0, 0, 0, 1 },
+{ 1, 1, 0, 0, 0, 0 },
+{ 1, 0, 1, 0, 0, 0 },
+{ 0, 1, 0, 1, 0, 0 },
+{ 0, 1, 0, 0, 1, 0 },
+{ 0, 0, 0, 0, 1, 1 },
+{ 1, 1, 1, 1, 0, 0 },
+{ 1, 1, 1, 0, 1, 0 },
+{ 0, 1, 0, 1, 1, 1 },
+{ 2, 1, 1, 0, 1, 0 },
+{ 1, 2, 1, 1, 0, 0 },
+{ 1, 1, 1, 1, 1, 0 },
+{ 1, 1, 1, 1, 0, 1 },
+{ 1, 1, 1, 0, 2, 0 },
+{ 2, 2, 2, 1, 1, 0 } };
+
+static const double chen2015_coef[21][5] =
+{
+{ -12656.02, 8391.99, 3591.8, -12.73, 25.41 },
+{ 17.232, -18.388, 0.0, 0.568, -0.048 },
+{ 780.82, -220.8, 85.5, 0.48, -0.52 },
+{ 0.0, 0.0, 0.0, -0.38, 0.0 },
+{ 2895.2, 0.0, 0.0, 0.0, 0.0 },
+{ 993.4, 1411.31, -442.66, 0.0, -1.04 },
+{ -624.9, 0.0, -964.86, 0.0, 0.0 },
+{ 0.0, 0.0, 0.0, -0.024, 0.0 },
+{ 0.0, 0.0, 0.0, 0.016, 0.0 },
+{ -144.76, 0.0, 0.0, 0.0, 0.0 },
+{ -78.88, -94.46, 0.0, 0.0, 0.0 },
+{ 114.9, 0.0, 70.18, 0.0, 0.0 },
+{ 31.67, -2007.34, -239.12, -0.02, -0.82 },
+{ 0.0, 0.0, 0.0, 0.36, -2.04 },
+{ 0.0, 0.0, 0.0, 0.06, 0.0 },
+{ 0.0, 0.0, 0.0, -0.016, 0.0 },
+{ 0.0, 81.22, 0.0, 0.0, 0.0 },
+{ 0.0, 50.62, 0.0, 0.0, 0.0 },
+{ 0.0, 0.0, 45.82, 0.0, 0.0 },
+{ 0.0, 0.0, 0.0, 0.0, 0.16 },
+{ 0.0, 0.0, 0.0, 0.0, 0.14 } };
+
+static const double chen2015_bounds[2][6] =
+{
+{ 17.5, 17.5, 2.0, 2.0, 5.0, 5.0 },
+{ 22.5, 22.5, 3.0, 3.0, 7.0, 6.0 } };
+
+/* Ahmad2017: x0 = X1, x1 = X2, x2 = X3 */
+static const unsigned char ahmad2017_power[10][3] =
+{
+{ 0, 0, 0 },
+{ 1, 0, 0 },
+{ 0, 1, 0 },
+{ 0, 0, 1 },
+{ 2, 0, 0 },
+{ 1, 1, 0 },
+{ 1, 0, 1 },
+{ 0, 2, 0 },
+{ 0, 1, 1 },
+{ 0, 0, 2 } };
+
+static const double ahmad2017_coef[10][7] =
+{
+{ 1346.37, 4260.47, -1353.47, 2415.46, 9.56, 6458.62, 1986.67 },
+{ -1.99, -4.27, 32.32, 1.556, 0.02, -14.246, -3.55 },
+{ -0.33, -1.5, 24.56, -0.77, -0.03, -5.0, -73.65 },
+{ -17.12, -52.3, 10.48, -31.14, -0.03, 4.3, -10.8 },
+{ 0.02, 0.04, 0.06, -0.03, 0.0, 0.22, 0.0 },
+{ 0.0, 0.04, 0.0, 0.0, -0.001, 0.0, 0.0 },
+{ 0.0, 0.0, -0.24, 0.0, 0.0, 0.0, 0.0 },
+{ 0.0, 0.0, 0.1, 0.0, 0.0009, 0.33, -0.2 },
+{ 0.0, 0.0, -0.19, 0.0, 0.0, 0.0, 0.56 },
+{ 0.05, 0.16, 0.0, 0.1, 0.0, 0.0, 0.0 } };
+
+static const double ahmad2017_bounds[2][3] =
+{
+{ 10.0, 10.0, 150.0 },
+{ 50.0, 50.0, 170.0 } };
+
+static const struct gmf_poly rwa_poly[10] =
+{
+{ "Subasi2016", 5, 2, 17, 2, &subasi2016_power[0][0],
+		&subasi2016_coef[0][0], &subasi2016_bounds[0][0],
+		&subasi2016_bounds[1][0], NULL, NULL },
+{ "Goel2007", 4, 3, 22, 3, &goel2007_power[0][0],
+		&goel2007_coef[0][0], &goel2007_bounds[0][0],
+		&goel2007_bounds[1][0], NULL, NULL },
+{ "Liao2008", 5, 3, 17, 2, &liao2008_power[0][0],
+		&liao2008_coef[0][0], &liao2008_bounds[0][0],
+		&liao2008_bounds[1][0], NULL, NULL },
+{ "Ganesan2013", 3, 3, 10, 3, &ganesan2013_power[0][0],
+		&ganesan2013_coef[0][0], &ganesan2013_bounds[0][0],
+		&ganesan2013_bounds[1][0], NULL, NULL },
+{ "Padhi2016", 5, 3, 20, 2, &padhi2016_power[0][0],
+		&padhi2016_coef[0][0], &padhi2016_bounds[0][0],
+		&padhi2016_bounds[1][0], NULL, NULL },
+{ "Gao2020", 9, 3, 55, 2, &gao2020_power[0][0],
+		&gao2020_coef[0][0], &gao2020_bounds[0][0],
+		&gao2020_bounds[1][0], NULL, NULL },
+{ "Xu2020", 4, 3, 16, 4, &xu2020_power[0][0],
+		&xu2020_coef[0][0], &xu2020_bounds[0][0],
+		&xu2020_bounds[1][0], NULL, NULL },
+{ "Vaidyanathan2004", 4, 4, 22, 3, &vaidyanathan2004_power[0][0],
+		&vaidyanathan2004_coef[0][0], &vaidyanathan2004_bounds[0][0],
+		&vaidyanathan2004_bounds[1][0], NULL, NULL },
+{ "Chen2015", 6, 5, 21, 8, &chen2015_power[0][0],
+		&chen2015_coef[0][0], &chen2015_bounds[0][0],
+		&chen2015_bounds[1][0], NULL, NULL },
+{ "Ahmad2017", 3, 7, 10, 2, &ahmad2017_power[0][0],
+		&ahmad2017_coef[0][0], &ahmad2017_bounds[0][0],
+		&ahmad2017_bounds[1][0], NULL, NULL } };
+
+/**
+ * Table of problem `function` (see gmf_rwa_index), NULL if unknown
+ */
+const struct gmf_poly *gmf_poly_get(int function)
+{
+	if (function < 0 || function >= 10)
+	{
+		return NULL;
+	}
+	return &rwa_poly[function];
+}
+
+/**
+ * Evaluates n points (rows of X) into the rows of F, monomial by monomial
+ */
+void gmf_poly_evaluate(const struct gmf_poly *poly, size_t n, const double *X,
+		size_t ldx, double *F, size_t ldf)
+{
+	size_t i, t, j, k;
+	const unsigned char *power;
+	const double *x;
+	double *f, m, u;
+	unsigned char e;
+
+	for (i = 0; i < n; ++i)
+	{
+		x = X + i * ldx;
+		f = F + i * ldf;
+		memset(f, 0, sizeof(double) * poly->nobjs);
+		for (t = 0; t < poly->nterms; ++t)
+		{
+			power = poly->power + t * poly->nvars;
+			m = 1.0;
+			for (j = 0; j < poly->nvars; ++j)
+			{
+				u = poly->scale == NULL ? x[j] : poly->shift[j]
+						+ poly->scale[j] * x[j];
+				for (e = 0; e < power[j]; ++e)
+				{
+					m *= u;
+				}
+			}
+			for (k = 0; k < poly->nobjs; ++k)
+			{
+				f[k] += poly->coef[t * poly->nobjs + k] * m;
+			}
+		}
+	}
+	return;
+}
+
+/** **************************************************************************
+ ** Normalized tables
+ **
+ ** With x_j = xmin_j + w_j u_j (w_j = xmax_j - xmin_j), a monomial expands
+ ** binomially into monomials of u:
+ **
+ **   prod_j x_j^e_j = sum_{s <= e} prod_j C(e_j, s_j) xmin_j^(e_j - s_j)
+ **                    w_j^s_j u_j^s_j
+ **
+ ** so the table in u has the same degree and at most prod_j (e_j + 1) terms
+ ** per original term. An affine map of objective k, (f_k - a_k) / b_k,
+ ** scales its coefficients and shifts its constant term.
+ ** **************************************************************************/
+#define GMF_POLY_MAXEXPAND 16
+
+/**
+ * Whether exponent vector a comes before b: lower degree first, then
+ * higher powers of the first variables, the order of the tables above
+ */
+static int gmf_poly_before(const unsigned char *a, const unsigned char *b,
+		size_t nvars)
+{
+	size_t da = 0, db = 0, j;
+
+	for (j = 0; j < nvars; ++j)
+	{
+		da += a[j];
+		db += b[j];
+	}
+	if (da != db)
+	{
+		return da < db;
+	}
+	for (j = 0; j < nvars && a[j] == b[j]; ++j)
+	{
+	}
+	return j < nvars && a[j] > b[j];
+}
+
+/**
+ * Row of exponent vector e in the first *nterms rows of the table, inserted
+ * in order with zero coefficients if missing
+ */
+static size_t gmf_poly_row(unsigned char *power, double *coef, size_t nvars,
+		size_t nobjs, size_t *nterms, const unsigned char *e)
+{
+	size_t r;
+
+	for (r = 0; r < *nterms; ++r)
+	{
+		if (memcmp(power + r * nvars, e, nvars) == 0)
+		{
+			return r;
+		}
+		if (gmf_poly_before(e, power + r * nvars, nvars))
+		{
+			break;
+		}
+	}
+	memmove(power + (r + 1) * nvars, power + r * nvars,
+			(*nterms - r) * nvars);
+	memmove(coef + (r + 1) * nobjs, coef + r * nobjs,
+			(*nterms - r) * nobjs * sizeof(double));
+	memcpy(power + r * nvars, e, nvars);
+	memset(coef + r * nobjs, 0, nobjs * sizeof(double));
+	++*nterms;
+	return r;
+}
+
+/**
+ * Table of the same problem over the unit box: the variables are u in
+ * [0, 1]^nvars with x = xmin + (xmax - xmin) u folded into the
+ * coefficients. If ideal and nadir are given (e.g. fmin and fmax of the
+ * reference set, gmf_pof_open_mop), objective k becomes
+ * (f_k - ideal_k) / (nadir_k - ideal_k), so that its front spans [0, 1].
+ * NULL if out of memory or nadir_k == ideal_k. Release with
+ * gmf_poly_destroy, after any plan built on it.
+ *
+ * The input map is folded when the expansion adds at most nvars
+ * multiply-adds per point to the contraction (one per added monomial and
+ * objective), the cost of applying the map to the variables; otherwise the
+ * table keeps the original monomials and sets shift and scale. Over the
+ * unit box the result agrees with the original table to 3e-15 of the
+ * magnitude of each objective, 3e-14 for Ahmad2017 (bench/bench_unit).
+ */
+struct gmf_poly *gmf_poly_normalize(const struct gmf_poly *poly,
+		const double *ideal, const double *nadir)
+{
+	const size_t nvars = poly->nvars, nobjs = poly->nobjs;
+	unsigned char s[GMF_POLY_MAXEXPAND], *power;
+	const unsigned char *e;
+	struct gmf_poly *unit;
+	double *coef, *bounds, factor, w;
+	size_t cap = 1, size, nterms = 0, t, j, k, r, i;
+
+	for (t = 0; t < poly->nterms; ++t)
+	{
+		size = 1;
+		for (j = 0; j < nvars; ++j)
+		{
+			size *= poly->power[t * nvars + j] + 1;
+		}
+		cap += size;
+	}
+	if (nvars > GMF_POLY_MAXEXPAND)
+	{
+		return NULL;
+	}
+	size = sizeof(struct gmf_poly) + sizeof(double) * (cap * nobjs + 4 * nvars)
+			+ cap * nvars;
+	unit = malloc(size);
+	if (unit == NULL)
+	{
+		return NULL;
+	}
+	coef = (double*) (unit + 1);
+	bounds = coef + cap * nobjs;
+	power = (unsigned char*) (bounds + 4 * nvars);
+	for (j = 0; j < nvars; ++j)
+	{
+		bounds[j] = 0.0;
+		bounds[nvars + j] = 1.0;
+		bounds[2 * nvars + j] = poly->xmin[j];
+		bounds[3 * nvars + j] = poly->xmax[j] - poly->xmin[j];
+	}
+
+	/* every s <= e of every term, in odometer order */
+	for (t = 0; t < poly->nterms; ++t)
+	{
+		e = poly->power + t * nvars;
+		memset(s, 0, nvars);
+		do
+		{
+			factor = 1.0;
+			for (j = 0; j < nvars; ++j)
+			{
+				w = poly->xmax[j] - poly->xmin[j];
+				for (i = 0; i < s[j]; ++i)
+				{
+					factor *= w * (e[j] - i) / (i + 1);
+				}
+				for (i = s[j]; i < e[j]; ++i)
+				{
+					factor *= poly->xmin[j];
+				}
+			}
+			r = gmf_poly_row(power, coef, nvars, nobjs, &nterms, s);
+			for (k = 0; k < nobjs; ++k)
+			{
+				coef[r * nobjs + k] += factor * poly->coef[t * nobjs + k];
+			}
+			for (j = 0; j < nvars && s[j] == e[j]; ++j)
+			{
+				s[j] = 0;
+			}
+			if (j < nvars)
+			{
+				++s[j];
+			}
+		} while (j < nvars);
+	}
+
+	unit->shift = NULL;
+	unit->scale = NULL;
+	if ((nterms - poly->nterms) * nobjs > nvars)
+	{
+		nterms = poly->nterms;
+		memcpy(power, poly->power, nterms * nvars);
+		memcpy(coef, poly->coef, nterms * nobjs * sizeof(double));
+		unit->shift = bounds + 2 * nvars;
+		unit->scale = bounds + 3 * nvars;
+	}
+
+	if (ideal != NULL && nadir != NULL)
+	{
+		memset(s, 0, nvars);
+		r = gmf_poly_row(power, coef, nvars, nobjs, &nterms, s);
+		for (k = 0; k < nobjs; ++k)
+		{
+			if (!(nadir[k] != ideal[k]))
+			{
+				free(unit);
+				return NULL;
+			}
+			coef[r * nobjs + k] -= ideal[k];
+			for (t = 0; t < nterms; ++t)
+			{
+				coef[t * nobjs + k] /= nadir[k] - ideal[k];
+			}
+		}
+	}
+	unit->name = poly->name;
+	unit->nvars = nvars;
+	unit->nobjs = nobjs;
+	unit->nterms = nterms;
+	unit->degree = poly->degree;
+	unit->power = power;
+	unit->coef = coef;
+	unit->xmin = bounds;
+	unit->xmax = bounds + nvars;
+	return unit;
+}
+
+void gmf_poly_destroy(struct gmf_poly *poly)
+{
+	free(poly);
+	return;
+}
+
+/** **************************************************************************
+ ** Blocked evaluation
+ **
+ ** F = Phi(X) C + c0, Phi being the n x terms matrix of the monomials of the
+ ** points and C the terms x nobjs coefficients. Phi is never stored whole:
+ ** the points go by register blocks of `lanes`, for which a block of rows of
+ ** lanes values, one row per monomial, is built in L1. The variable rows are
+ ** the columns of a column-major X as they are (a row-major block is
+ ** transposed), every further row is an earlier row times a variable row,
+ ** and the rows are then contracted with C by a micro-kernel that keeps the
+ ** nobjs x lanes accumulators in registers and loads each row once for all
+ ** the objectives. Rows that are only factors of other rows (x1^3 for x1^4
+ ** in Chen2015) are built but left out of the contraction.
+ ** **************************************************************************/
+#define GMF_POLY_LANES 32 /* widest register block */
+#define GMF_POLY_MAXVARS 16
+#define GMF_POLY_MAXOBJS 8
+#define GMF_POLY_MAXROWS 256
+
+#ifdef __GNUC__
+#define GMF_POLY_KERNEL static inline __attribute__((always_inline))
+#else
+#define GMF_POLY_KERNEL static inline
+#endif
+
+struct gmf_poly_plan
+{
+	const struct gmf_poly *poly;
+	size_t rows; /* variables, monomials of the table, factors */
+	size_t terms; /* rows contracted with coef */
+	unsigned short left[GMF_POLY_MAXROWS]; /* row r = row left[r] * x_var[r] */
+	unsigned char var[GMF_POLY_MAXROWS];
+	unsigned short sequence[GMF_POLY_MAXROWS]; /* product rows by degree */
+	double constant[GMF_POLY_MAXOBJS];
+	double *coef; /* terms x nobjs */
+	void (*tile)(const struct gmf_poly_plan *plan, size_t count,
+			const double *X, size_t ldx, double *F, size_t ldf, int order,
+			double *phi);
+};
+
+/**
+ * count points by blocks of `lanes`, phi holding rows x lanes; m objectives
+ */
+GMF_POLY_KERNEL void gmf_poly_tile(const struct gmf_poly_plan *plan,
+		size_t m, size_t lanes, size_t count, const double *X, size_t ldx,
+		double *F, size_t ldf, int order, double *restrict phi)
+{
+	const size_t nvars = plan->poly->nvars;
+	const double *shift = plan->poly->shift, *scale = plan->poly->scale;
+	const double *row[GMF_POLY_MAXROWS];
+	const double *restrict a;
+	const double *restrict b;
+	const double *restrict c;
+	double *restrict product;
+	double acc[GMF_POLY_MAXOBJS][GMF_POLY_LANES], c0[GMF_POLY_MAXOBJS];
+	size_t i, j, k, o, p, r, last;
+
+	for (o = 0; o < m; ++o)
+	{
+		c0[o] = plan->constant[o];
+	}
+	for (i = 0; i < count; i += lanes)
+	{
+		/* variables; the lanes past count repeat the last point */
+		last = count - 1 - i;
+		for (j = 0; j < nvars; ++j)
+		{
+			row[j] = phi + j * lanes;
+		}
+		if (order == gmf_col_major && last >= lanes - 1 && shift == NULL)
+		{
+			for (j = 0; j < nvars; ++j)
+			{
+				row[j] = X + j * ldx + i;
+			}
+		}
+		else if (order == gmf_col_major)
+		{
+			for (j = 0; j < nvars; ++j)
+			{
+				for (p = 0; p < lanes; ++p)
+				{
+					phi[j * lanes + p] = X[j * ldx + i + (p < last ? p : last)];
+				}
+			}
+		}
+		else
+		{
+			for (p = 0; p < lanes; ++p)
+			{
+				a = X + (i + (p < last ? p : last)) * ldx;
+				for (j = 0; j < nvars; ++j)
+				{
+					phi[j * lanes + p] = a[j];
+				}
+			}
+		}
+		for (j = 0; shift != NULL && j < nvars; ++j)
+		{
+			for (p = 0; p < lanes; ++p)
+			{
+				phi[j * lanes + p] = shift[j] + scale[j] * phi[j * lanes + p];
+			}
+		}
+		for (k = nvars; k < plan->rows; ++k)
+		{
+			r = plan->sequence[k];
+			product = phi + r * lanes;
+			a = row[plan->left[r]];
+			b = row[plan->var[r]];
+			for (p = 0; p < lanes; ++p)
+			{
+				product[p] = a[p] * b[p];
+			}
+			row[r] = product;
+		}
+
+		/* contraction */
+		for (o = 0; o < m; ++o)
+		{
+			for (p = 0; p < lanes; ++p)
+			{
+				acc[o][p] = c0[o];
+			}
+		}
+		for (k = 0; k < plan->terms; ++k)
+		{
+			a = row[k];
+			c = plan->coef + k * m;
+			for (o = 0; o < m; ++o)
+			{
+				for (p = 0; p < lanes; ++p)
+				{
+					acc[o][p] += c[o] * a[p];
+				}
+			}
+		}
+		if (order == gmf_col_major)
+		{
+			for (o = 0; o < m; ++o)
+			{
+				for (p = 0; p < lanes && p <= last; ++p)
+				{
+					F[o * ldf + i + p] = acc[o][p];
+				}
+			}
+			continue;
+		}
+		for (p = 0; p < lanes && p <= last; ++p)
+		{
+			for (o = 0; o < m; ++o)
+			{
+				F[(i + p) * ldf + o] = acc[o][p];
+			}
+		}
+	}
+	return;
+}
+
+/*
+ * The tile is compiled for every number of objectives, so that the
+ * accumulators are a fixed set of registers (as many points per block as
+ * the vector registers allow), and for every instruction set. Unlike the
+ * SIMD kernels of gmf_dv_rwa.c, FMA contraction is allowed: the expanded
+ * sums round differently from the published formulas anyway.
+ */
+#if defined(__GNUC__) && !defined(__clang__) \
+		&& (defined(__x86_64__) || defined(__i386__))
+#define GMF_POLY_SIMD
+#define GMF_POLY_AVX2 __attribute__((target("avx2,fma"), \
+		optimize("tree-vectorize", "unroll-loops")))
+#define GMF_POLY_AVX512 __attribute__((target("avx512f,fma,prefer-vector-width=512"), \
+		optimize("tree-vectorize", "unroll-loops")))
+#define GMF_POLY_GENERIC __attribute__((optimize("tree-vectorize", \
+		"unroll-loops")))
+#else
+#define GMF_POLY_GENERIC
+#endif
+
+#define GMF_POLY_TILE(m, isa, attr, lanes) \
+static attr void gmf_poly_tile##m##_##isa(const struct gmf_poly_plan *plan, \
+		size_t count, const double *X, size_t ldx, double *F, size_t ldf, \
+		int order, double *phi) \
+{ \
+	gmf_poly_tile(plan, m, lanes, count, X, ldx, F, ldf, order, phi); \
+	return; \
+}
+#ifdef GMF_POLY_SIMD
+#define GMF_POLY_TILE_ALL(m) \
+	GMF_POLY_TILE(m, generic, GMF_POLY_GENERIC, 4) \
+	GMF_POLY_TILE(m, avx2, GMF_POLY_AVX2, (m <= 3 ? 16 : 8)) \
+	GMF_POLY_TILE(m, avx512, GMF_POLY_AVX512, (m <= 6 ? 32 : 16))
+#else
+#define GMF_POLY_TILE_ALL(m) \
+	GMF_POLY_TILE(m, generic, GMF_POLY_GENERIC, 4)
+#endif
+
+GMF_POLY_TILE_ALL(1)
+GMF_POLY_TILE_ALL(2)
+GMF_POLY_TILE_ALL(3)
+GMF_POLY_TILE_ALL(4)
+GMF_POLY_TILE_ALL(5)
+GMF_POLY_TILE_ALL(6)
+GMF_POLY_TILE_ALL(7)
+GMF_POLY_TILE_ALL(8)
+
+static void (*poly_tile[3][GMF_POLY_MAXOBJS])(const struct gmf_poly_plan *plan,
+		size_t count, const double *X, size_t ldx, double *F, size_t ldf,
+		int order, double *phi) =
+{
+{	gmf_poly_tile1_generic,
+	gmf_poly_tile2_generic,
+	gmf_poly_tile3_generic,
+	gmf_poly_tile4_generic,
+	gmf_poly_tile5_generic,
+	gmf_poly_tile6_generic,
+	gmf_poly_tile7_generic,
+	gmf_poly_tile8_generic },
+#ifdef GMF_POLY_SIMD
+{	gmf_poly_tile1_avx2,
+	gmf_poly_tile2_avx2,
+	gmf_poly_tile3_avx2,
+	gmf_poly_tile4_avx2,
+	gmf_poly_tile5_avx2,
+	gmf_poly_tile6_avx2,
+	gmf_poly_tile7_avx2,
+	gmf_poly_tile8_avx2 },
+{	gmf_poly_tile1_avx512,
+	gmf_poly_tile2_avx512,
+	gmf_poly_tile3_avx512,
+	gmf_poly_tile4_avx512,
+	gmf_poly_tile5_avx512,
+	gmf_poly_tile6_avx512,
+	gmf_poly_tile7_avx512,
+	gmf_poly_tile8_avx512 }
+#endif
+};
+
+static int gmf_poly_add(struct gmf_poly_plan *plan,
+		unsigned char (*power)[GMF_POLY_MAXVARS], const unsigned char *e);
+
+static int gmf_poly_find(const struct gmf_poly_plan *plan,
+		unsigned char (*power)[GMF_POLY_MAXVARS], const unsigned char *e)
+{
+	size_t r;
+	for (r = 0; r < plan->rows; ++r)
+	{
+		if (memcmp(power[r], e, plan->poly->nvars) == 0)
+		{
+			return (int) r;
+		}
+	}
+	return -1;
+}
+
+/**
+ * Factors of product row r: an existing row times a variable if there is
+ * one, else a new row
+ */
+static int gmf_poly_factor(struct gmf_poly_plan *plan,
+		unsigned char (*power)[GMF_POLY_MAXVARS], size_t r)
+{
+	unsigned char sub[GMF_POLY_MAXVARS];
+	size_t j, nvars = plan->poly->nvars;
+	int left;
+
+	for (j = 0; j < nvars; ++j)
+	{
+		if (power[r][j] == 0)
+		{
+			continue;
+		}
+		memcpy(sub, power[r], nvars);
+		sub[j]--;
+		if ((left = gmf_poly_find(plan, power, sub)) >= 0)
+		{
+			plan->left[r] = (unsigned short) left;
+			plan->var[r] = (unsigned char) j;
+			return 1;
+		}
+	}
+	for (j = 0; power[r][j] == 0; ++j)
+	{
+	}
+	memcpy(sub, power[r], nvars);
+	sub[j]--;
+	if ((left = gmf_poly_add(plan, power, sub)) < 0)
+	{
+		return 0;
+	}
+	plan->left[r] = (unsigned short) left;
+	plan->var[r] = (unsigned char) j;
+	return 1;
+}
+
+static int gmf_poly_add(struct gmf_poly_plan *plan,
+		unsigned char (*power)[GMF_POLY_MAXVARS], const unsigned char *e)
+{
+	int r = gmf_poly_find(plan, power, e);
+	if (r >= 0)
+	{
+		return r;
+	}
+	if (plan->rows == GMF_POLY_MAXROWS)
+	{
+		return -1;
+	}
+	r = (int) plan->rows++;
+	memcpy(power[r], e, plan->poly->nvars);
+	return gmf_poly_factor(plan, power, r) ? r : -1;
+}
+
+static size_t gmf_poly_degree(const unsigned char *e, size_t nvars)
+{
+	size_t j, degree = 0;
+	for (j = 0; j < nvars; ++j)
+	{
+		degree += e[j];
+	}
+	return degree;
+}
+
+/**
+ * Plan of the blocked evaluation of a table, with the tiles compiled for
+ * the given SIMD level (gmf_simd_scalar, gmf_simd_avx2 or gmf_simd_avx512,
+ * clamped to what the CPU supports). NULL if the table is too large (more
+ * than 16 variables, 8 objectives or 256 monomials and factors) or out of
+ * memory. A plan is read-only once built and may be shared by threads.
+ */
+gmf_poly_plan *gmf_poly_plan_create(const struct gmf_poly *poly, int simd)
+{
+	unsigned char (*power)[GMF_POLY_MAXVARS];
+	const size_t nvars = poly->nvars, m = poly->nobjs;
+	const unsigned char *e;
+	gmf_poly_plan *plan;
+	size_t t, k, r, degree, products, level = gmf_simd_scalar;
+
+	if (nvars > GMF_POLY_MAXVARS || m == 0 || m > GMF_POLY_MAXOBJS)
+	{
+		return NULL;
+	}
+	plan = calloc(1, sizeof(gmf_poly_plan));
+	power = calloc(GMF_POLY_MAXROWS, GMF_POLY_MAXVARS);
+	if (plan == NULL || power == NULL)
+	{
+		free(plan);
+		free(power);
+		return NULL;
+	}
+	plan->poly = poly;
+	for (r = 0; r < nvars; ++r)
+	{
+		power[r][r] = 1;
+	}
+	plan->rows = nvars;
+
+	/* the monomials of degree >= 2, then the factors they lack */
+	for (t = 0; t < poly->nterms && plan->rows < GMF_POLY_MAXROWS; ++t)
+	{
+		e = poly->power + t * nvars;
+		if (gmf_poly_degree(e, nvars) >= 2)
+		{
+			memcpy(power[plan->rows++], e, nvars);
+		}
+	}
+	plan->terms = plan->rows;
+	plan->coef = calloc(plan->terms * m, sizeof(double));
+	if (plan->coef == NULL || t < poly->nterms)
+	{
+		gmf_poly_plan_destroy(plan);
+		free(power);
+		return NULL;
+	}
+	for (r = nvars; r < plan->terms; ++r)
+	{
+		if (!gmf_poly_factor(plan, power, r))
+		{
+			gmf_poly_plan_destroy(plan);
+			free(power);
+			return NULL;
+		}
+	}
+	for (t = 0; t < poly->nterms; ++t)
+	{
+		e = poly->power + t * nvars;
+		r = gmf_poly_degree(e, nvars) == 0 ? 0 : gmf_poly_find(plan, power, e);
+		for (k = 0; k < m; ++k)
+		{
+			if (gmf_poly_degree(e, nvars) == 0)
+			{
+				plan->constant[k] += poly->coef[t * m + k];
+			}
+			else
+			{
+				plan->coef[r * m + k] += poly->coef[t * m + k];
+			}
+		}
+	}
+
+	/* products by degree, so that factors come first */
+	products = 0;
+	for (degree = 2; products < plan->rows - nvars; ++degree)
+	{
+		for (r = nvars; r < plan->rows; ++r)
+		{
+			if (gmf_poly_degree(power[r], nvars) == degree)
+			{
+				plan->sequence[nvars + products++] = (unsigned short) r;
+			}
+		}
+	}
+	free(power);
+
+#ifdef GMF_POLY_SIMD
+	__builtin_cpu_init();
+	if (simd >= gmf_simd_avx512 && __builtin_cpu_supports("avx512f"))
+	{
+		level = gmf_simd_avx512;
+	}
+	else if (simd >= gmf_simd_avx2 && __builtin_cpu_supports("avx2")
+			&& __builtin_cpu_supports("fma"))
+	{
+		level = gmf_simd_avx2;
+	}
+#endif
+	plan->tile = poly_tile[level][m - 1];
+	return plan;
+}
+
+void gmf_poly_plan_destroy(gmf_poly_plan *plan)
+{
+	if (plan == NULL)
+	{
+		return;
+	}
+	free(plan->coef);
+	free(plan);
+	return;
+}
+
+/**
+ * Flops per point of the blocked evaluation: one product per row beyond
+ * the variables and one multiply-add per contracted row and objective
+ */
+size_t gmf_poly_plan_flops(const gmf_poly_plan *plan)
+{
+	return plan->rows - plan->poly->nvars
+			+ 2 * plan->terms * plan->poly->nobjs;
+}
+
+/**
+ * Evaluates n points into F, both stored in the given order (see
+ * gmf_rwa_evaluate); column-major batches skip the transposition. Returns 0
+ * if the storage order is unknown or the block cannot be allocated.
+ */
+int gmf_poly_plan_evaluate(const gmf_poly_plan *plan, size_t n,
+		const double *X, size_t ldx, double *F, size_t ldf, int order)
+{
+	double *phi;
+
+	if (order != gmf_row_major && order != gmf_col_major)
+	{
+		return 0;
+	}
+	phi = aligned_alloc(64, sizeof(double) * plan->rows * GMF_POLY_LANES);
+	if (phi == NULL)
+	{
+		return 0;
+	}
+	plan->tile(plan, n, X, ldx, F, ldf, order, phi);
+	free(phi);
+	return 1;
+}
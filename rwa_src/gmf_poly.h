@@ -0,0 +1,77 @@
+/*
+ * gmf_poly.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+#ifndef GMF_POLY_H_
+#define GMF_POLY_H_
+
+#include <stddef.h>
+
+/*
+ * Every RWA objective is a polynomial in the decision variables, so each
+ * problem is also described by a sparse table of monomials: row t of power
+ * holds the exponent of every variable in monomial t, row t of coef its
+ * coefficient in every objective (0 where an objective lacks it); xmin and
+ * xmax repeat the box of the problem. The coefficients are those of F, with
+ * the maximized objectives negated, and were expanded exactly from the
+ * published formulas (Ganesan2013's outer factors and Chen2015's scaled
+ * variables and products multiplied out, Xu2020's MRR a single monomial).
+ *
+ * The tables are the source of the generated kernels (tools/gmf_polygen
+ * writes gmf_poly_kernels.h, selected with gmf_rwa_set_kernels). Expanded
+ * forms round differently from the published expressions: over the box,
+ * both agree to within 2e-15 of the magnitude of each objective, 5e-14 for
+ * Ahmad2017 whose large constant terms cancel.
+ *
+ * gmf_poly_evaluate evaluates a table term by term (row-major points, as
+ * gmf_rwa_evaluate) and serves as the reference for the generated code.
+ */
+struct gmf_poly
+{
+	const char *name;
+	size_t nvars;
+	size_t nobjs;
+	size_t nterms;
+	size_t degree;
+	const unsigned char *power; /* nterms x nvars */
+	const double *coef; /* nterms x nobjs */
+	const double *xmin; /* box of the problem, as in its descriptor */
+	const double *xmax;
+	const double *shift; /* NULL, or x = shift + scale * u is taken from the */
+	const double *scale; /* given points u before the monomials */
+};
+
+const struct gmf_poly *gmf_poly_get(int function);
+void gmf_poly_evaluate(const struct gmf_poly *poly, size_t n, const double *X,
+		size_t ldx, double *F, size_t ldf);
+
+/*
+ * Normalized inputs and outputs: gmf_poly_normalize builds the table of a
+ * problem over the unit box, optionally with its objectives mapped from
+ * [ideal, nadir] onto [0, 1], so that a plan built on it evaluates points
+ * of [0, 1]^nvars straight into normalized objectives in one pass. The maps
+ * are folded into the coefficients, except the input map of tables that
+ * its expansion would grow (Xu2020, Chen2015), which the plan applies to
+ * the variables instead (shift and scale).
+ */
+struct gmf_poly *gmf_poly_normalize(const struct gmf_poly *poly,
+		const double *ideal, const double *nadir);
+void gmf_poly_destroy(struct gmf_poly *poly);
+
+/*
+ * Blocked evaluation: a batch is the product of the matrix of its monomials
+ * by the coefficients, built and contracted block by block in L1 (see
+ * gmf_poly.c), and agrees with gmf_poly_evaluate to rounding. It is the
+ * fastest path for row-major batches; on column-major batches the SIMD
+ * kernels of gmf_rwa_evaluate take fewer flops (bench/bench_gemm).
+ */
+typedef struct gmf_poly_plan gmf_poly_plan;
+
+gmf_poly_plan *gmf_poly_plan_create(const struct gmf_poly *poly, int simd);
+void gmf_poly_plan_destroy(gmf_poly_plan *plan);
+size_t gmf_poly_plan_flops(const gmf_poly_plan *plan);
+int gmf_poly_plan_evaluate(const gmf_poly_plan *plan, size_t n,
+		const double *X, size_t ldx, double *F, size_t ldf, int order);
+
+#endif /* GMF_POLY_H_ */
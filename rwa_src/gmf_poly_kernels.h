@@ -0,0 +1,1194 @@
+/*
+ * gmf_poly_kernels.h
+ *
+ * Generated by tools/gmf_polygen from the tables of gmf_poly.c, do not edit.
+ * Included by gmf_dv_rwa.c, which defines GMF_KERNEL.
+ */
+#ifndef GMF_POLY_KERNELS_H_
+#define GMF_POLY_KERNELS_H_
+
+/* Subasi2016: 17 monomials, Horner form, 48 flops (term by term 62) */
+GMF_KERNEL void Subasi2016_poly_eval(double *F, size_t incf, const double *xr,
+		size_t incx)
+{
+	double x0 = xr[0];
+	double x1 = xr[incx];
+	double x2 = xr[2 * incx];
+	double x3 = xr[3 * incx];
+	double x4 = xr[4 * incx];
+
+	F[0] = -89.027 + x0 * (-0.3 - 0.0464 * x1 + 0.0244 * x2 - 0.0159 * x3
+			- 0.0004151 * x4) + x2 * (1.124 - 0.1111 * x1 + 0.0004121 * x4)
+			+ x3 * (0.968 - 0.0004192 * x4) + 0.096 * x1 - 0.04148 * x4;
+	F[incf] = 0.4753 + x0 * (-0.0181 + 0.006777 * x0 - 0.008851 * x2
+			+ 0.008702 * x3) + x1 * (0.042 + 0.01536 * x3 - 2.761e-05 * x4)
+			+ x2 * (0.05481 - 0.0044 * x3 + 9.714e-06 * x4) - 0.0191 * x3
+			- 3.416e-05 * x4;
+	return;
+}
+
+GMF_KERNEL void Subasi2016_poly_evalf(float *F, size_t incf, const float *xr,
+		size_t incx)
+{
+	float x0 = xr[0];
+	float x1 = xr[incx];
+	float x2 = xr[2 * incx];
+	float x3 = xr[3 * incx];
+	float x4 = xr[4 * incx];
+
+	F[0] = -89.027f + x0 * (-0.3f - 0.0464f * x1 + 0.0244f * x2 - 0.0159f * x3
+			- 0.0004151f * x4) + x2 * (1.124f - 0.1111f * x1 + 0.0004121f * x4)
+			+ x3 * (0.968f - 0.0004192f * x4) + 0.096f * x1 - 0.04148f * x4;
+	F[incf] = 0.4753f + x0 * (-0.0181f + 0.006777f * x0 - 0.008851f * x2
+			+ 0.008702f * x3) + x1 * (0.042f + 0.01536f * x3 - 2.761e-05f * x4)
+			+ x2 * (0.05481f - 0.0044f * x3 + 9.714e-06f * x4) - 0.0191f * x3
+			- 3.416e-05f * x4;
+	return;
+}
+
+/* Subasi2016: objectives and Jacobian, 113 flops */
+GMF_KERNEL void Subasi2016_poly_jac(double *F, double *J, const double *xr)
+{
+	double x0 = xr[0];
+	double x1 = xr[1];
+	double x2 = xr[2];
+	double x3 = xr[3];
+	double x4 = xr[4];
+	double m0 = x1 * x0;
+	double m1 = x2 * x0;
+	double m2 = x3 * x0;
+	double m3 = x4 * x0;
+	double m4 = x2 * x1;
+	double m5 = x4 * x2;
+	double m6 = x4 * x3;
+	double m7 = x0 * x0;
+	double m8 = x3 * x1;
+	double m9 = x4 * x1;
+	double m10 = x3 * x2;
+
+	F[0] = -89.027 - 0.3 * x0 + 0.096 * x1 + 1.124 * x2 + 0.968 * x3
+			- 0.04148 * x4 - 0.0464 * m0 + 0.0244 * m1 - 0.0159 * m2
+			- 0.0004151 * m3 - 0.1111 * m4 + 0.0004121 * m5 - 0.0004192 * m6;
+	F[1] = 0.4753 - 0.0181 * x0 + 0.042 * x1 + 0.05481 * x2 - 0.0191 * x3
+			- 3.416e-05 * x4 + 0.006777 * m7 - 0.008851 * m1 + 0.008702 * m2
+			+ 0.01536 * m8 - 2.761e-05 * m9 - 0.0044 * m10 + 9.714e-06 * m5;
+	J[0] = -0.3 - 0.0464 * x1 + 0.0244 * x2 - 0.0159 * x3 - 0.0004151 * x4;
+	J[1] = 0.096 - 0.0464 * x0 - 0.1111 * x2;
+	J[2] = 1.124 + 0.0244 * x0 - 0.1111 * x1 + 0.0004121 * x4;
+	J[3] = 0.968 - 0.0159 * x0 - 0.0004192 * x4;
+	J[4] = -0.04148 - 0.0004151 * x0 + 0.0004121 * x2 - 0.0004192 * x3;
+	J[5] = -0.0181 + 0.013554 * x0 - 0.008851 * x2 + 0.008702 * x3;
+	J[6] = 0.042 + 0.01536 * x3 - 2.761e-05 * x4;
+	J[7] = 0.05481 - 0.008851 * x0 - 0.0044 * x3 + 9.714e-06 * x4;
+	J[8] = -0.0191 + 0.008702 * x0 + 0.01536 * x1 - 0.0044 * x2;
+	J[9] = -3.416e-05 - 2.761e-05 * x1 + 9.714e-06 * x2;
+	return;
+}
+
+/* Goel2007: 22 monomials, Horner form, 96 flops (term by term 139) */
+GMF_KERNEL void Goel2007_poly_eval(double *F, size_t incf, const double *xr,
+		size_t incx)
+{
+	double x0 = xr[0];
+	double x1 = xr[incx];
+	double x2 = xr[2 * incx];
+	double x3 = xr[3 * incx];
+
+	F[0] = 0.153 + x0 * (-0.322 + 0.175 * x0 + 0.0185 * x1 - 0.251 * x2
+			+ 0.0134 * x3) + x1 * (0.396 - 0.0701 * x1 + 0.179 * x2
+			+ 0.0296 * x3) + x2 * (0.424 + 0.015 * x2 + 0.0752 * x3)
+			+ x3 * (0.0226 + 0.0192 * x3);
+	F[incf] = 0.692 + x0 * (0.477 - 0.167 * x0 - 0.0129 * x1 - 0.0634 * x2
+			- 0.0521 * x3) + x1 * (-0.687 + 0.0796 * x1 - 0.0257 * x2
+			+ 0.00156 * x3) + x2 * (-0.08 + 0.0877 * x2 + 0.00198 * x3)
+			+ x3 * (-0.065 + 0.0184 * x3);
+	F[2 * incf] = 0.37 + x0 * (-0.205 + x1 * (0.0141 + 0.202 * x0 - 0.342 * x1
+			- 0.281 * x2) + x0 * (-0.135 - 0.281 * x2) + x3 * (0.353
+			- 0.184 * x3) + 0.208 * x2) + x2 * (0.108 + x1 * (-0.0301
+			- 0.245 * x1 + 0.281 * x2) - 0.226 * x2 - 0.0497 * x3)
+			+ x1 * (0.0307 + 0.0998 * x1) + x3 * (1.019 - 0.423 * x3);
+	return;
+}
+
+GMF_KERNEL void Goel2007_poly_evalf(float *F, size_t incf, const float *xr,
+		size_t incx)
+{
+	float x0 = xr[0];
+	float x1 = xr[incx];
+	float x2 = xr[2 * incx];
+	float x3 = xr[3 * incx];
+
+	F[0] = 0.153f + x0 * (-0.322f + 0.175f * x0 + 0.0185f * x1 - 0.251f * x2
+			+ 0.0134f * x3) + x1 * (0.396f - 0.0701f * x1 + 0.179f * x2
+			+ 0.0296f * x3) + x2 * (0.424f + 0.015f * x2 + 0.0752f * x3)
+			+ x3 * (0.0226f + 0.0192f * x3);
+	F[incf] = 0.692f + x0 * (0.477f - 0.167f * x0 - 0.0129f * x1 - 0.0634f * x2
+			- 0.0521f * x3) + x1 * (-0.687f + 0.0796f * x1 - 0.0257f * x2
+			+ 0.00156f * x3) + x2 * (-0.08f + 0.0877f * x2 + 0.00198f * x3)
+			+ x3 * (-0.065f + 0.0184f * x3);
+	F[2 * incf] = 0.37f + x0 * (-0.205f + x1 * (0.0141f + 0.202f * x0
+			- 0.342f * x1 - 0.281f * x2) + x0 * (-0.135f - 0.281f * x2)
+			+ x3 * (0.353f - 0.184f * x3) + 0.208f * x2) + x2 * (0.108f
+			+ x1 * (-0.0301f - 0.245f * x1 + 0.281f * x2) - 0.226f * x2
+			- 0.0497f * x3) + x1 * (0.0307f + 0.0998f * x1) + x3 * (1.019f
+			- 0.423f * x3);
+	return;
+}
+
+/* Goel2007: objectives and Jacobian, 235 flops */
+GMF_KERNEL void Goel2007_poly_jac(double *F, double *J, const double *xr)
+{
+	double x0 = xr[0];
+	double x1 = xr[1];
+	double x2 = xr[2];
+	double x3 = xr[3];
+	double m0 = x0 * x0;
+	double m1 = x1 * x0;
+	double m2 = x2 * x0;
+	double m3 = x3 * x0;
+	double m4 = x1 * x1;
+	double m5 = x2 * x1;
+	double m6 = x3 * x1;
+	double m7 = x2 * x2;
+	double m8 = x3 * x2;
+	double m9 = x3 * x3;
+	double m10 = m1 * x0;
+	double m11 = m2 * x0;
+	double m12 = m4 * x0;
+	double m13 = m5 * x0;
+	double m14 = m9 * x0;
+	double m15 = m5 * x1;
+	double m16 = m7 * x1;
+
+	F[0] = 0.153 - 0.322 * x0 + 0.396 * x1 + 0.424 * x2 + 0.0226 * x3
+			+ 0.175 * m0 + 0.0185 * m1 - 0.251 * m2 + 0.0134 * m3 - 0.0701 * m4
+			+ 0.179 * m5 + 0.0296 * m6 + 0.015 * m7 + 0.0752 * m8 + 0.0192 * m9;
+	F[1] = 0.692 + 0.477 * x0 - 0.687 * x1 - 0.08 * x2 - 0.065 * x3 - 0.167 * m0
+			- 0.0129 * m1 - 0.0634 * m2 - 0.0521 * m3 + 0.0796 * m4
+			- 0.0257 * m5 + 0.00156 * m6 + 0.0877 * m7 + 0.00198 * m8
+			+ 0.0184 * m9;
+	F[2] = 0.37 - 0.205 * x0 + 0.0307 * x1 + 0.108 * x2 + 1.019 * x3
+			- 0.135 * m0 + 0.0141 * m1 + 0.208 * m2 + 0.353 * m3 + 0.0998 * m4
+			- 0.0301 * m5 - 0.226 * m7 - 0.0497 * m8 - 0.423 * m9 + 0.202 * m10
+			- 0.281 * m11 - 0.342 * m12 - 0.281 * m13 - 0.184 * m14
+			- 0.245 * m15 + 0.281 * m16;
+	J[0] = -0.322 + 0.35 * x0 + 0.0185 * x1 - 0.251 * x2 + 0.0134 * x3;
+	J[1] = 0.396 + 0.0185 * x0 - 0.1402 * x1 + 0.179 * x2 + 0.0296 * x3;
+	J[2] = 0.424 - 0.251 * x0 + 0.179 * x1 + 0.03 * x2 + 0.0752 * x3;
+	J[3] = 0.0226 + 0.0134 * x0 + 0.0296 * x1 + 0.0752 * x2 + 0.0384 * x3;
+	J[4] = 0.477 - 0.334 * x0 - 0.0129 * x1 - 0.0634 * x2 - 0.0521 * x3;
+	J[5] = -0.687 - 0.0129 * x0 + 0.1592 * x1 - 0.0257 * x2 + 0.00156 * x3;
+	J[6] = -0.08 - 0.0634 * x0 - 0.0257 * x1 + 0.1754 * x2 + 0.00198 * x3;
+	J[7] = -0.065 - 0.0521 * x0 + 0.00156 * x1 + 0.00198 * x2 + 0.0368 * x3;
+	J[8] = -0.205 - 0.27 * x0 + 0.0141 * x1 + 0.208 * x2 + 0.353 * x3
+			+ 0.404 * m1 - 0.562 * m2 - 0.342 * m4 - 0.281 * m5 - 0.184 * m9;
+	J[9] = 0.0307 + 0.0141 * x0 + 0.1996 * x1 - 0.0301 * x2 + 0.202 * m0
+			- 0.684 * m1 - 0.281 * m2 - 0.49 * m5 + 0.281 * m7;
+	J[10] = 0.108 + 0.208 * x0 - 0.0301 * x1 - 0.452 * x2 - 0.0497 * x3
+			- 0.281 * m0 - 0.281 * m1 - 0.245 * m4 + 0.562 * m5;
+	J[11] = 1.019 + 0.353 * x0 - 0.0497 * x2 - 0.846 * x3 - 0.368 * m3;
+	return;
+}
+
+/* Liao2008: 17 monomials, Horner form, 51 flops (term by term 63) */
+GMF_KERNEL void Liao2008_poly_eval(double *F, size_t incf, const double *xr,
+		size_t incx)
+{
+	double x0 = xr[0];
+	double x1 = xr[incx];
+	double x2 = xr[2 * incx];
+	double x3 = xr[3 * incx];
+	double x4 = xr[4 * incx];
+
+	F[0] = 1640.2823 + 2.3573285 * x0 + 2.3220035 * x1 + 4.5688768 * x2
+			+ 7.7213633 * x3 + 4.4559504 * x4;
+	F[incf] = 6.5856 + x0 * (1.15 - 0.1106 * x0 - 0.3695 * x3 + 0.0861 * x4)
+			+ x3 * (0.8364 + 0.3628 * x1 + 0.1764 * x3) + x2 * (0.9738
+			- 0.3437 * x2) - 1.0427 * x1;
+	F[2 * incf] = -0.0551 + x1 * (0.1024 - 0.0073 * x0 - 0.0241 * x1
+			+ 0.024 * x2 - 0.0118 * x3) + x2 * (0.0421 - 0.0204 * x3
+			- 0.008 * x4) + 0.0181 * x0 + 0.0109 * x3 * x3;
+	return;
+}
+
+GMF_KERNEL void Liao2008_poly_evalf(float *F, size_t incf, const float *xr,
+		size_t incx)
+{
+	float x0 = xr[0];
+	float x1 = xr[incx];
+	float x2 = xr[2 * incx];
+	float x3 = xr[3 * incx];
+	float x4 = xr[4 * incx];
+
+	F[0] = 1640.2823f + 2.3573285f * x0 + 2.3220035f * x1 + 4.5688768f * x2
+			+ 7.721363f * x3 + 4.4559504f * x4;
+	F[incf] = 6.5856f + x0 * (1.15f - 0.1106f * x0 - 0.3695f * x3
+			+ 0.0861f * x4) + x3 * (0.8364f + 0.3628f * x1 + 0.1764f * x3)
+			+ x2 * (0.9738f - 0.3437f * x2) - 1.0427f * x1;
+	F[2 * incf] = -0.0551f + x1 * (0.1024f - 0.0073f * x0 - 0.0241f * x1
+			+ 0.024f * x2 - 0.0118f * x3) + x2 * (0.0421f - 0.0204f * x3
+			- 0.008f * x4) + 0.0181f * x0 + 0.0109f * x3 * x3;
+	return;
+}
+
+/* Liao2008: objectives and Jacobian, 100 flops */
+GMF_KERNEL void Liao2008_poly_jac(double *F, double *J, const double *xr)
+{
+	double x0 = xr[0];
+	double x1 = xr[1];
+	double x2 = xr[2];
+	double x3 = xr[3];
+	double x4 = xr[4];
+	double m0 = x0 * x0;
+	double m1 = x3 * x0;
+	double m2 = x4 * x0;
+	double m3 = x3 * x1;
+	double m4 = x2 * x2;
+	double m5 = x3 * x3;
+	double m6 = x1 * x0;
+	double m7 = x1 * x1;
+	double m8 = x2 * x1;
+	double m9 = x3 * x2;
+	double m10 = x4 * x2;
+
+	F[0] = 1640.2823 + 2.3573285 * x0 + 2.3220035 * x1 + 4.5688768 * x2
+			+ 7.7213633 * x3 + 4.4559504 * x4;
+	F[1] = 6.5856 + 1.15 * x0 - 1.0427 * x1 + 0.9738 * x2 + 0.8364 * x3
+			- 0.1106 * m0 - 0.3695 * m1 + 0.0861 * m2 + 0.3628 * m3
+			- 0.3437 * m4 + 0.1764 * m5;
+	F[2] = -0.0551 + 0.0181 * x0 + 0.1024 * x1 + 0.0421 * x2 - 0.0073 * m6
+			- 0.0241 * m7 + 0.024 * m8 - 0.0118 * m3 - 0.0204 * m9 - 0.008 * m10
+			+ 0.0109 * m5;
+	J[0] = 2.3573285;
+	J[1] = 2.3220035;
+	J[2] = 4.5688768;
+	J[3] = 7.7213633;
+	J[4] = 4.4559504;
+	J[5] = 1.15 - 0.2212 * x0 - 0.3695 * x3 + 0.0861 * x4;
+	J[6] = -1.0427 + 0.3628 * x3;
+	J[7] = 0.9738 - 0.6874 * x2;
+	J[8] = 0.8364 - 0.3695 * x0 + 0.3628 * x1 + 0.3528 * x3;
+	J[9] = 0.0861 * x0;
+	J[10] = 0.0181 - 0.0073 * x1;
+	J[11] = 0.1024 - 0.0073 * x0 - 0.0482 * x1 + 0.024 * x2 - 0.0118 * x3;
+	J[12] = 0.0421 + 0.024 * x1 - 0.0204 * x3 - 0.008 * x4;
+	J[13] = -0.0118 * x1 - 0.0204 * x2 + 0.0218 * x3;
+	J[14] = -0.008 * x2;
+	return;
+}
+
+/* Ganesan2013: 10 monomials, Horner form, 41 flops (term by term 55) */
+GMF_KERNEL void Ganesan2013_poly_eval(double *F, size_t incf, const double *xr,
+		size_t incx)
+{
+	double x0 = xr[0];
+	double x1 = xr[incx];
+	double x2 = xr[2 * incx];
+
+	F[0] = 0.0007693838 + x0 * (0.000129502 - 6.12917e-05 * x0
+			+ 2.78518e-05 * x1) + x2 * (0.0001669334 - 0.0001180597 * x2)
+			- 2.71422e-05 * x1;
+	F[incf] = -45.69999991508208 + x0 * (1.286896e-08 + x1 * (5.38e-09
+			- 7.94088e-09 * x1) - 8.3928e-09 * x0) + x2 * (2.810512e-08
+			+ 3.52928e-09 * x1 - 2.18428e-08 * x2) - 5.1648e-09 * x1;
+	F[2 * incf] = 0.180000000570825 + x2 * (-1.99125e-10 + x1 * (-6.2835e-11
+			+ 7.38975e-11 * x2) + 1.792125e-10 * x2) + x0 * (4.82325e-11 * x0
+			- 4.956e-11 * x1);
+	return;
+}
+
+GMF_KERNEL void Ganesan2013_poly_evalf(float *F, size_t incf, const float *xr,
+		size_t incx)
+{
+	float x0 = xr[0];
+	float x1 = xr[incx];
+	float x2 = xr[2 * incx];
+
+	F[0] = 0.0007693838f + x0 * (0.000129502f - 6.12917e-05f * x0
+			+ 2.78518e-05f * x1) + x2 * (0.0001669334f - 0.0001180597f * x2)
+			- 2.71422e-05f * x1;
+	F[incf] = -45.7f + x0 * (1.286896e-08f + x1 * (5.38e-09f
+			- 7.94088e-09f * x1) - 8.3928e-09f * x0) + x2 * (2.810512e-08f
+			+ 3.52928e-09f * x1 - 2.18428e-08f * x2) - 5.1648e-09f * x1;
+	F[2 * incf] = 0.18f + x2 * (-1.99125e-10f + x1 * (-6.2835e-11f
+			+ 7.38975e-11f * x2) + 1.792125e-10f * x2) + x0 * (4.82325e-11f * x0
+			- 4.956e-11f * x1);
+	return;
+}
+
+/* Ganesan2013: objectives and Jacobian, 85 flops */
+GMF_KERNEL void Ganesan2013_poly_jac(double *F, double *J, const double *xr)
+{
+	double x0 = xr[0];
+	double x1 = xr[1];
+	double x2 = xr[2];
+	double m0 = x0 * x0;
+	double m1 = x1 * x0;
+	double m2 = x2 * x2;
+	double m3 = x2 * x1;
+	double m4 = m1 * x1;
+	double m5 = x1 * x1;
+	double m6 = m2 * x1;
+
+	F[0] = 0.0007693838 + 0.000129502 * x0 - 2.71422e-05 * x1
+			+ 0.0001669334 * x2 - 6.12917e-05 * m0 + 2.78518e-05 * m1
+			- 0.0001180597 * m2;
+	F[1] = -45.69999991508208 + 1.286896e-08 * x0 - 5.1648e-09 * x1
+			+ 2.810512e-08 * x2 - 8.3928e-09 * m0 + 5.38e-09 * m1
+			+ 3.52928e-09 * m3 - 2.18428e-08 * m2 - 7.94088e-09 * m4;
+	F[2] = 0.180000000570825 - 1.99125e-10 * x2 + 4.82325e-11 * m0
+			- 4.956e-11 * m1 - 6.2835e-11 * m3 + 1.792125e-10 * m2
+			+ 7.38975e-11 * m6;
+	J[0] = 0.000129502 - 0.0001225834 * x0 + 2.78518e-05 * x1;
+	J[1] = -2.71422e-05 + 2.78518e-05 * x0;
+	J[2] = 0.0001669334 - 0.0002361194 * x2;
+	J[3] = 1.286896e-08 - 1.67856e-08 * x0 + 5.38e-09 * x1 - 7.94088e-09 * m5;
+	J[4] = -5.1648e-09 + 5.38e-09 * x0 + 3.52928e-09 * x2 - 1.588176e-08 * m1;
+	J[5] = 2.810512e-08 + 3.52928e-09 * x1 - 4.36856e-08 * x2;
+	J[6] = 9.6465e-11 * x0 - 4.956e-11 * x1;
+	J[7] = -4.956e-11 * x0 - 6.2835e-11 * x2 + 7.38975e-11 * m2;
+	J[8] = -1.99125e-10 - 6.2835e-11 * x1 + 3.58425e-10 * x2 + 1.47795e-10 * m3;
+	return;
+}
+
+/* Padhi2016: 20 monomials, Horner form, 86 flops (term by term 115) */
+GMF_KERNEL void Padhi2016_poly_eval(double *F, size_t incf, const double *xr,
+		size_t incx)
+{
+	double x0 = xr[0];
+	double x1 = xr[incx];
+	double x2 = xr[2 * incx];
+	double x3 = xr[3 * incx];
+	double x4 = xr[4 * incx];
+
+	F[0] = -1.74 + x3 * (0.19 - 0.034 * x0 + 0.028 * x1 - 0.093 * x2
+			- 0.036 * x3 + 0.033 * x4) + x0 * (-0.42 - 0.11 * x0 - 0.044 * x1
+			- 0.17 * x4) + x4 * (-0.18 + 0.025 * x4) + 0.27 * x1 - 0.087 * x2;
+	F[incf] = 2.19 + x0 * (0.26 + 0.036 * x0 + 0.11 * x2 - 0.077 * x3)
+			+ x1 * (-0.088 - 0.075 * x2 + 0.054 * x3) + x4 * (0.069 + 0.09 * x2
+			+ 0.041 * x3) + 0.037 * x2 - 0.16 * x3;
+	F[2 * incf] = 0.095 + x0 * (0.013 + 0.001462 * x0 - 0.011 * x1
+			- 0.006188 * x2 + 0.008937 * x3 - 0.004563 * x4) + x1 * (-0.008625
+			- 0.0006635 * x1 - 0.012 * x2 - 0.001063 * x3 + 0.002438 * x4)
+			+ x3 * (-0.012 - 0.001937 * x2 - 0.001788 * x3 - 0.003312 * x4)
+			+ x2 * (-0.005458 - 0.001188 * x4);
+	return;
+}
+
+GMF_KERNEL void Padhi2016_poly_evalf(float *F, size_t incf, const float *xr,
+		size_t incx)
+{
+	float x0 = xr[0];
+	float x1 = xr[incx];
+	float x2 = xr[2 * incx];
+	float x3 = xr[3 * incx];
+	float x4 = xr[4 * incx];
+
+	F[0] = -1.74f + x3 * (0.19f - 0.034f * x0 + 0.028f * x1 - 0.093f * x2
+			- 0.036f * x3 + 0.033f * x4) + x0 * (-0.42f - 0.11f * x0
+			- 0.044f * x1 - 0.17f * x4) + x4 * (-0.18f + 0.025f * x4)
+			+ 0.27f * x1 - 0.087f * x2;
+	F[incf] = 2.19f + x0 * (0.26f + 0.036f * x0 + 0.11f * x2 - 0.077f * x3)
+			+ x1 * (-0.088f - 0.075f * x2 + 0.054f * x3) + x4 * (0.069f
+			+ 0.09f * x2 + 0.041f * x3) + 0.037f * x2 - 0.16f * x3;
+	F[2 * incf] = 0.095f + x0 * (0.013f + 0.001462f * x0 - 0.011f * x1
+			- 0.006188f * x2 + 0.008937f * x3 - 0.004563f * x4)
+			+ x1 * (-0.008625f - 0.0006635f * x1 - 0.012f * x2 - 0.001063f * x3
+			+ 0.002438f * x4) + x3 * (-0.012f - 0.001937f * x2 - 0.001788f * x3
+			- 0.003312f * x4) + x2 * (-0.005458f - 0.001188f * x4);
+	return;
+}
+
+/* Padhi2016: objectives and Jacobian, 201 flops */
+GMF_KERNEL void Padhi2016_poly_jac(double *F, double *J, const double *xr)
+{
+	double x0 = xr[0];
+	double x1 = xr[1];
+	double x2 = xr[2];
+	double x3 = xr[3];
+	double x4 = xr[4];
+	double m0 = x0 * x0;
+	double m1 = x1 * x0;
+	double m2 = x3 * x0;
+	double m3 = x4 * x0;
+	double m4 = x3 * x1;
+	double m5 = x3 * x2;
+	double m6 = x3 * x3;
+	double m7 = x4 * x3;
+	double m8 = x4 * x4;
+	double m9 = x2 * x0;
+	double m10 = x2 * x1;
+	double m11 = x4 * x2;
+	double m12 = x1 * x1;
+	double m13 = x4 * x1;
+
+	F[0] = -1.74 - 0.42 * x0 + 0.27 * x1 - 0.087 * x2 + 0.19 * x3 - 0.18 * x4
+			- 0.11 * m0 - 0.044 * m1 - 0.034 * m2 - 0.17 * m3 + 0.028 * m4
+			- 0.093 * m5 - 0.036 * m6 + 0.033 * m7 + 0.025 * m8;
+	F[1] = 2.19 + 0.26 * x0 - 0.088 * x1 + 0.037 * x2 - 0.16 * x3 + 0.069 * x4
+			+ 0.036 * m0 + 0.11 * m9 - 0.077 * m2 - 0.075 * m10 + 0.054 * m4
+			+ 0.09 * m11 + 0.041 * m7;
+	F[2] = 0.095 + 0.013 * x0 - 0.008625 * x1 - 0.005458 * x2 - 0.012 * x3
+			+ 0.001462 * m0 - 0.011 * m1 - 0.006188 * m9 + 0.008937 * m2
+			- 0.004563 * m3 - 0.0006635 * m12 - 0.012 * m10 - 0.001063 * m4
+			+ 0.002438 * m13 - 0.001937 * m5 - 0.001188 * m11 - 0.001788 * m6
+			- 0.003312 * m7;
+	J[0] = -0.42 - 0.22 * x0 - 0.044 * x1 - 0.034 * x3 - 0.17 * x4;
+	J[1] = 0.27 - 0.044 * x0 + 0.028 * x3;
+	J[2] = -0.087 - 0.093 * x3;
+	J[3] = 0.19 - 0.034 * x0 + 0.028 * x1 - 0.093 * x2 - 0.072 * x3
+			+ 0.033 * x4;
+	J[4] = -0.18 - 0.17 * x0 + 0.033 * x3 + 0.05 * x4;
+	J[5] = 0.26 + 0.072 * x0 + 0.11 * x2 - 0.077 * x3;
+	J[6] = -0.088 - 0.075 * x2 + 0.054 * x3;
+	J[7] = 0.037 + 0.11 * x0 - 0.075 * x1 + 0.09 * x4;
+	J[8] = -0.16 - 0.077 * x0 + 0.054 * x1 + 0.041 * x4;
+	J[9] = 0.069 + 0.09 * x2 + 0.041 * x3;
+	J[10] = 0.013 + 0.002924 * x0 - 0.011 * x1 - 0.006188 * x2 + 0.008937 * x3
+			- 0.004563 * x4;
+	J[11] = -0.008625 - 0.011 * x0 - 0.001327 * x1 - 0.012 * x2 - 0.001063 * x3
+			+ 0.002438 * x4;
+	J[12] = -0.005458 - 0.006188 * x0 - 0.012 * x1 - 0.001937 * x3
+			- 0.001188 * x4;
+	J[13] = -0.012 + 0.008937 * x0 - 0.001063 * x1 - 0.001937 * x2
+			- 0.003576 * x3 - 0.003312 * x4;
+	J[14] = -0.004563 * x0 + 0.002438 * x1 - 0.001188 * x2 - 0.003312 * x3;
+	return;
+}
+
+/* Gao2020: 55 monomials, Horner form, 324 flops (term by term 459) */
+GMF_KERNEL void Gao2020_poly_eval(double *F, size_t incf, const double *xr,
+		size_t incx)
+{
+	double x0 = xr[0];
+	double x1 = xr[incx];
+	double x2 = xr[2 * incx];
+	double x3 = xr[3 * incx];
+	double x4 = xr[4 * incx];
+	double x5 = xr[5 * incx];
+	double x6 = xr[6 * incx];
+	double x7 = xr[7 * incx];
+	double x8 = xr[8 * incx];
+
+	F[0] = 171.33 + x0 * (23.25 + 3.64 * x0 - 0.47 * x1 - 0.3 * x2 - 6.22 * x3
+			- 0.62 * x4 - 42.48 * x5 + 3.11 * x6 + 4.45 * x7 - 0.22 * x8)
+			+ x1 * (-8.61 - 0.99 * x1 + 7.46 * x2 + 3.28 * x3 + 1.28 * x4
+			+ 1.02 * x5 - 4.02 * x6 - 2.29 * x7 - 0.16 * x8) + x2 * (-59.85
+			+ 30.5 * x2 + 19.25 * x3 - 14.83 * x4 + 5.07 * x5 - 37.61 * x6
+			- 9.11 * x7 - 0.32 * x8) + x3 * (-66.12 + 21.63 * x3 + 8.53 * x4
+			+ 18.46 * x5 - 14.28 * x6 - 7.05 * x7 - 0.24 * x8) + x4 * (-15.29
+			+ 1.72 * x4 + 2.05 * x5 + 15.73 * x6 - 0.77 * x7 - 0.29 * x8)
+			+ x5 * (-83.32 + 72.42 * x5 - 4.77 * x6 + 2.07 * x7 + 0.64 * x8)
+			+ x6 * (37.72 + 11.2 * x6 + 3.41 * x7 + 1.76 * x8) + x7 * (12.67
+			+ 1.86 * x7 + 0.48 * x8) + x8 * (0.46 - 0.79 * x8);
+	F[incf] = -577.73 + x0 * (1.22 - 0.55 * x0 - 2.94 * x1 + 2.96 * x2
+			- 0.66 * x3 - 0.09 * x4 + 0.43 * x5 - 0.12 * x6 + 0.43 * x7
+			+ 0.7 * x8) + x1 * (19.56 + 4.97 * x1 - 8.05 * x2 - 0.53 * x3
+			- 4.43 * x4 + 0.6 * x5 + 0.46 * x6 + 4.97 * x7 - 0.046 * x8)
+			+ x2 * (-102.05 + 0.47 * x2 - 0.42 * x3 - 6.03 * x4 - 0.21 * x5
+			- 2.63 * x6 - 0.17 * x7 + 0.43 * x8) + x3 * (1.83 + 0.91 * x3
+			- 6.34 * x4 - 6.36 * x5 - 0.19 * x6 + 0.22 * x7 - 0.39 * x8)
+			+ x4 * (-27.28 + 2.08 * x4 + 7.09 * x5 - 3.06 * x6 + 0.15 * x7
+			- 0.68 * x8) + x5 * (-2.52 + 1.43 * x5 + 0.2 * x6 - 0.14 * x7
+			- 0.88 * x8) + x6 * (-5.43 - 0.43 * x6 - 0.45 * x7 + 0.014 * x8)
+			+ x7 * (-37.48 - 1.06 * x7 - 0.99 * x8) + x8 * (-0.45 - 0.98 * x8);
+	F[2 * incf] = -0.81 + x0 * (0.0926 + 0.00932 * x0 + 0.0263 * x1
+			- 0.00134 * x2 + 0.0148 * x3 + 0.00704 * x4 - 0.013 * x5
+			- 0.00655 * x6 + 0.0971 * x7 - 0.0108 * x8) + x1 * (-0.014
+			+ 0.00761 * x1 - 0.0254 * x2 + 0.00483 * x3 - 0.00963 * x4
+			- 0.0121 * x5 + 0.0702 * x6 + 0.0121 * x7 - 0.000194 * x8)
+			+ x2 * (0.029 - 0.016 * x2 + 0.0115 * x3 - 0.036 * x4 - 0.056 * x5
+			+ 0.026 * x6 + 0.0401 * x7 - 0.0135 * x8) + x3 * (0.00769
+			- 0.0124 * x3 + 0.0693 * x4 + 0.0316 * x5 + 0.00238 * x6
+			- 0.00732 * x7 - 0.00469 * x8) + x4 * (-0.0405 - 0.00961 * x4
+			- 0.0818 * x5 + 0.0574 * x6 - 0.00144 * x7 + 0.000995 * x8)
+			+ x5 * (-0.029 + 0.024 * x5 + 0.0209 * x6 + 0.065 * x7
+			+ 0.0199 * x8) + x6 * (-0.075 + 0.0863 * x6 - 0.0495 * x7
+			- 0.0087 * x8) + x7 * (0.012 + 0.0019 * x7 - 0.00455 * x8)
+			+ x8 * (0.0104 + 0.00756 * x8);
+	return;
+}
+
+GMF_KERNEL void Gao2020_poly_evalf(float *F, size_t incf, const float *xr,
+		size_t incx)
+{
+	float x0 = xr[0];
+	float x1 = xr[incx];
+	float x2 = xr[2 * incx];
+	float x3 = xr[3 * incx];
+	float x4 = xr[4 * incx];
+	float x5 = xr[5 * incx];
+	float x6 = xr[6 * incx];
+	float x7 = xr[7 * incx];
+	float x8 = xr[8 * incx];
+
+	F[0] = 171.33f + x0 * (23.25f + 3.64f * x0 - 0.47f * x1 - 0.3f * x2
+			- 6.22f * x3 - 0.62f * x4 - 42.48f * x5 + 3.11f * x6 + 4.45f * x7
+			- 0.22f * x8) + x1 * (-8.61f - 0.99f * x1 + 7.46f * x2 + 3.28f * x3
+			+ 1.28f * x4 + 1.02f * x5 - 4.02f * x6 - 2.29f * x7 - 0.16f * x8)
+			+ x2 * (-59.85f + 30.5f * x2 + 19.25f * x3 - 14.83f * x4
+			+ 5.07f * x5 - 37.61f * x6 - 9.11f * x7 - 0.32f * x8)
+			+ x3 * (-66.12f + 21.63f * x3 + 8.53f * x4 + 18.46f * x5
+			- 14.28f * x6 - 7.05f * x7 - 0.24f * x8) + x4 * (-15.29f
+			+ 1.72f * x4 + 2.05f * x5 + 15.73f * x6 - 0.77f * x7 - 0.29f * x8)
+			+ x5 * (-83.32f + 72.42f * x5 - 4.77f * x6 + 2.07f * x7
+			+ 0.64f * x8) + x6 * (37.72f + 11.2f * x6 + 3.41f * x7 + 1.76f * x8)
+			+ x7 * (12.67f + 1.86f * x7 + 0.48f * x8) + x8 * (0.46f
+			- 0.79f * x8);
+	F[incf] = -577.73f + x0 * (1.22f - 0.55f * x0 - 2.94f * x1 + 2.96f * x2
+			- 0.66f * x3 - 0.09f * x4 + 0.43f * x5 - 0.12f * x6 + 0.43f * x7
+			+ 0.7f * x8) + x1 * (19.56f + 4.97f * x1 - 8.05f * x2 - 0.53f * x3
+			- 4.43f * x4 + 0.6f * x5 + 0.46f * x6 + 4.97f * x7 - 0.046f * x8)
+			+ x2 * (-102.05f + 0.47f * x2 - 0.42f * x3 - 6.03f * x4 - 0.21f * x5
+			- 2.63f * x6 - 0.17f * x7 + 0.43f * x8) + x3 * (1.83f + 0.91f * x3
+			- 6.34f * x4 - 6.36f * x5 - 0.19f * x6 + 0.22f * x7 - 0.39f * x8)
+			+ x4 * (-27.28f + 2.08f * x4 + 7.09f * x5 - 3.06f * x6 + 0.15f * x7
+			- 0.68f * x8) + x5 * (-2.52f + 1.43f * x5 + 0.2f * x6 - 0.14f * x7
+			- 0.88f * x8) + x6 * (-5.43f - 0.43f * x6 - 0.45f * x7
+			+ 0.014f * x8) + x7 * (-37.48f - 1.06f * x7 - 0.99f * x8)
+			+ x8 * (-0.45f - 0.98f * x8);
+	F[2 * incf] = -0.81f + x0 * (0.0926f + 0.00932f * x0 + 0.0263f * x1
+			- 0.00134f * x2 + 0.0148f * x3 + 0.00704f * x4 - 0.013f * x5
+			- 0.00655f * x6 + 0.0971f * x7 - 0.0108f * x8) + x1 * (-0.014f
+			+ 0.00761f * x1 - 0.0254f * x2 + 0.00483f * x3 - 0.00963f * x4
+			- 0.0121f * x5 + 0.0702f * x6 + 0.0121f * x7 - 0.000194f * x8)
+			+ x2 * (0.029f - 0.016f * x2 + 0.0115f * x3 - 0.036f * x4
+			- 0.056f * x5 + 0.026f * x6 + 0.0401f * x7 - 0.0135f * x8)
+			+ x3 * (0.00769f - 0.0124f * x3 + 0.0693f * x4 + 0.0316f * x5
+			+ 0.00238f * x6 - 0.00732f * x7 - 0.00469f * x8) + x4 * (-0.0405f
+			- 0.00961f * x4 - 0.0818f * x5 + 0.0574f * x6 - 0.00144f * x7
+			+ 0.000995f * x8) + x5 * (-0.029f + 0.024f * x5 + 0.0209f * x6
+			+ 0.065f * x7 + 0.0199f * x8) + x6 * (-0.075f + 0.0863f * x6
+			- 0.0495f * x7 - 0.0087f * x8) + x7 * (0.012f + 0.0019f * x7
+			- 0.00455f * x8) + x8 * (0.0104f + 0.00756f * x8);
+	return;
+}
+
+/* Gao2020: objectives and Jacobian, 855 flops */
+GMF_KERNEL void Gao2020_poly_jac(double *F, double *J, const double *xr)
+{
+	double x0 = xr[0];
+	double x1 = xr[1];
+	double x2 = xr[2];
+	double x3 = xr[3];
+	double x4 = xr[4];
+	double x5 = xr[5];
+	double x6 = xr[6];
+	double x7 = xr[7];
+	double x8 = xr[8];
+	double m0 = x0 * x0;
+	double m1 = x1 * x0;
+	double m2 = x2 * x0;
+	double m3 = x3 * x0;
+	double m4 = x4 * x0;
+	double m5 = x5 * x0;
+	double m6 = x6 * x0;
+	double m7 = x7 * x0;
+	double m8 = x8 * x0;
+	double m9 = x1 * x1;
+	double m10 = x2 * x1;
+	double m11 = x3 * x1;
+	double m12 = x4 * x1;
+	double m13 = x5 * x1;
+	double m14 = x6 * x1;
+	double m15 = x7 * x1;
+	double m16 = x8 * x1;
+	double m17 = x2 * x2;
+	double m18 = x3 * x2;
+	double m19 = x4 * x2;
+	double m20 = x5 * x2;
+	double m21 = x6 * x2;
+	double m22 = x7 * x2;
+	double m23 = x8 * x2;
+	double m24 = x3 * x3;
+	double m25 = x4 * x3;
+	double m26 = x5 * x3;
+	double m27 = x6 * x3;
+	double m28 = x7 * x3;
+	double m29 = x8 * x3;
+	double m30 = x4 * x4;
+	double m31 = x5 * x4;
+	double m32 = x6 * x4;
+	double m33 = x7 * x4;
+	double m34 = x8 * x4;
+	double m35 = x5 * x5;
+	double m36 = x6 * x5;
+	double m37 = x7 * x5;
+	double m38 = x8 * x5;
+	double m39 = x6 * x6;
+	double m40 = x7 * x6;
+	double m41 = x8 * x6;
+	double m42 = x7 * x7;
+	double m43 = x8 * x7;
+	double m44 = x8 * x8;
+
+	F[0] = 171.33 + 23.25 * x0 - 8.61 * x1 - 59.85 * x2 - 66.12 * x3
+			- 15.29 * x4 - 83.32 * x5 + 37.72 * x6 + 12.67 * x7 + 0.46 * x8
+			+ 3.64 * m0 - 0.47 * m1 - 0.3 * m2 - 6.22 * m3 - 0.62 * m4
+			- 42.48 * m5 + 3.11 * m6 + 4.45 * m7 - 0.22 * m8 - 0.99 * m9
+			+ 7.46 * m10 + 3.28 * m11 + 1.28 * m12 + 1.02 * m13 - 4.02 * m14
+			- 2.29 * m15 - 0.16 * m16 + 30.5 * m17 + 19.25 * m18 - 14.83 * m19
+			+ 5.07 * m20 - 37.61 * m21 - 9.11 * m22 - 0.32 * m23 + 21.63 * m24
+			+ 8.53 * m25 + 18.46 * m26 - 14.28 * m27 - 7.05 * m28 - 0.24 * m29
+			+ 1.72 * m30 + 2.05 * m31 + 15.73 * m32 - 0.77 * m33 - 0.29 * m34
+			+ 72.42 * m35 - 4.77 * m36 + 2.07 * m37 + 0.64 * m38 + 11.2 * m39
+			+ 3.41 * m40 + 1.76 * m41 + 1.86 * m42 + 0.48 * m43 - 0.79 * m44;
+	F[1] = -577.73 + 1.22 * x0 + 19.56 * x1 - 102.05 * x2 + 1.83 * x3
+			- 27.28 * x4 - 2.52 * x5 - 5.43 * x6 - 37.48 * x7 - 0.45 * x8
+			- 0.55 * m0 - 2.94 * m1 + 2.96 * m2 - 0.66 * m3 - 0.09 * m4
+			+ 0.43 * m5 - 0.12 * m6 + 0.43 * m7 + 0.7 * m8 + 4.97 * m9
+			- 8.05 * m10 - 0.53 * m11 - 4.43 * m12 + 0.6 * m13 + 0.46 * m14
+			+ 4.97 * m15 - 0.046 * m16 + 0.47 * m17 - 0.42 * m18 - 6.03 * m19
+			- 0.21 * m20 - 2.63 * m21 - 0.17 * m22 + 0.43 * m23 + 0.91 * m24
+			- 6.34 * m25 - 6.36 * m26 - 0.19 * m27 + 0.22 * m28 - 0.39 * m29
+			+ 2.08 * m30 + 7.09 * m31 - 3.06 * m32 + 0.15 * m33 - 0.68 * m34
+			+ 1.43 * m35 + 0.2 * m36 - 0.14 * m37 - 0.88 * m38 - 0.43 * m39
+			- 0.45 * m40 + 0.014 * m41 - 1.06 * m42 - 0.99 * m43 - 0.98 * m44;
+	F[2] = -0.81 + 0.0926 * x0 - 0.014 * x1 + 0.029 * x2 + 0.00769 * x3
+			- 0.0405 * x4 - 0.029 * x5 - 0.075 * x6 + 0.012 * x7 + 0.0104 * x8
+			+ 0.00932 * m0 + 0.0263 * m1 - 0.00134 * m2 + 0.0148 * m3
+			+ 0.00704 * m4 - 0.013 * m5 - 0.00655 * m6 + 0.0971 * m7
+			- 0.0108 * m8 + 0.00761 * m9 - 0.0254 * m10 + 0.00483 * m11
+			- 0.00963 * m12 - 0.0121 * m13 + 0.0702 * m14 + 0.0121 * m15
+			- 0.000194 * m16 - 0.016 * m17 + 0.0115 * m18 - 0.036 * m19
+			- 0.056 * m20 + 0.026 * m21 + 0.0401 * m22 - 0.0135 * m23
+			- 0.0124 * m24 + 0.0693 * m25 + 0.0316 * m26 + 0.00238 * m27
+			- 0.00732 * m28 - 0.00469 * m29 - 0.00961 * m30 - 0.0818 * m31
+			+ 0.0574 * m32 - 0.00144 * m33 + 0.000995 * m34 + 0.024 * m35
+			+ 0.0209 * m36 + 0.065 * m37 + 0.0199 * m38 + 0.0863 * m39
+			- 0.0495 * m40 - 0.0087 * m41 + 0.0019 * m42 - 0.00455 * m43
+			+ 0.00756 * m44;
+	J[0] = 23.25 + 7.28 * x0 - 0.47 * x1 - 0.3 * x2 - 6.22 * x3 - 0.62 * x4
+			- 42.48 * x5 + 3.11 * x6 + 4.45 * x7 - 0.22 * x8;
+	J[1] = -8.61 - 0.47 * x0 - 1.98 * x1 + 7.46 * x2 + 3.28 * x3 + 1.28 * x4
+			+ 1.02 * x5 - 4.02 * x6 - 2.29 * x7 - 0.16 * x8;
+	J[2] = -59.85 - 0.3 * x0 + 7.46 * x1 + 61.0 * x2 + 19.25 * x3 - 14.83 * x4
+			+ 5.07 * x5 - 37.61 * x6 - 9.11 * x7 - 0.32 * x8;
+	J[3] = -66.12 - 6.22 * x0 + 3.28 * x1 + 19.25 * x2 + 43.26 * x3 + 8.53 * x4
+			+ 18.46 * x5 - 14.28 * x6 - 7.05 * x7 - 0.24 * x8;
+	J[4] = -15.29 - 0.62 * x0 + 1.28 * x1 - 14.83 * x2 + 8.53 * x3 + 3.44 * x4
+			+ 2.05 * x5 + 15.73 * x6 - 0.77 * x7 - 0.29 * x8;
+	J[5] = -83.32 - 42.48 * x0 + 1.02 * x1 + 5.07 * x2 + 18.46 * x3 + 2.05 * x4
+			+ 144.84 * x5 - 4.77 * x6 + 2.07 * x7 + 0.64 * x8;
+	J[6] = 37.72 + 3.11 * x0 - 4.02 * x1 - 37.61 * x2 - 14.28 * x3 + 15.73 * x4
+			- 4.77 * x5 + 22.4 * x6 + 3.41 * x7 + 1.76 * x8;
+	J[7] = 12.67 + 4.45 * x0 - 2.29 * x1 - 9.11 * x2 - 7.05 * x3 - 0.77 * x4
+			+ 2.07 * x5 + 3.41 * x6 + 3.72 * x7 + 0.48 * x8;
+	J[8] = 0.46 - 0.22 * x0 - 0.16 * x1 - 0.32 * x2 - 0.24 * x3 - 0.29 * x4
+			+ 0.64 * x5 + 1.76 * x6 + 0.48 * x7 - 1.58 * x8;
+	J[9] = 1.22 - 1.1 * x0 - 2.94 * x1 + 2.96 * x2 - 0.66 * x3 - 0.09 * x4
+			+ 0.43 * x5 - 0.12 * x6 + 0.43 * x7 + 0.7 * x8;
+	J[10] = 19.56 - 2.94 * x0 + 9.94 * x1 - 8.05 * x2 - 0.53 * x3 - 4.43 * x4
+			+ 0.6 * x5 + 0.46 * x6 + 4.97 * x7 - 0.046 * x8;
+	J[11] = -102.05 + 2.96 * x0 - 8.05 * x1 + 0.94 * x2 - 0.42 * x3 - 6.03 * x4
+			- 0.21 * x5 - 2.63 * x6 - 0.17 * x7 + 0.43 * x8;
+	J[12] = 1.83 - 0.66 * x0 - 0.53 * x1 - 0.42 * x2 + 1.82 * x3 - 6.34 * x4
+			- 6.36 * x5 - 0.19 * x6 + 0.22 * x7 - 0.39 * x8;
+	J[13] = -27.28 - 0.09 * x0 - 4.43 * x1 - 6.03 * x2 - 6.34 * x3 + 4.16 * x4
+			+ 7.09 * x5 - 3.06 * x6 + 0.15 * x7 - 0.68 * x8;
+	J[14] = -2.52 + 0.43 * x0 + 0.6 * x1 - 0.21 * x2 - 6.36 * x3 + 7.09 * x4
+			+ 2.86 * x5 + 0.2 * x6 - 0.14 * x7 - 0.88 * x8;
+	J[15] = -5.43 - 0.12 * x0 + 0.46 * x1 - 2.63 * x2 - 0.19 * x3 - 3.06 * x4
+			+ 0.2 * x5 - 0.86 * x6 - 0.45 * x7 + 0.014 * x8;
+	J[16] = -37.48 + 0.43 * x0 + 4.97 * x1 - 0.17 * x2 + 0.22 * x3 + 0.15 * x4
+			- 0.14 * x5 - 0.45 * x6 - 2.12 * x7 - 0.99 * x8;
+	J[17] = -0.45 + 0.7 * x0 - 0.046 * x1 + 0.43 * x2 - 0.39 * x3 - 0.68 * x4
+			- 0.88 * x5 + 0.014 * x6 - 0.99 * x7 - 1.96 * x8;
+	J[18] = 0.0926 + 0.01864 * x0 + 0.0263 * x1 - 0.00134 * x2 + 0.0148 * x3
+			+ 0.00704 * x4 - 0.013 * x5 - 0.00655 * x6 + 0.0971 * x7
+			- 0.0108 * x8;
+	J[19] = -0.014 + 0.0263 * x0 + 0.01522 * x1 - 0.0254 * x2 + 0.00483 * x3
+			- 0.00963 * x4 - 0.0121 * x5 + 0.0702 * x6 + 0.0121 * x7
+			- 0.000194 * x8;
+	J[20] = 0.029 - 0.00134 * x0 - 0.0254 * x1 - 0.032 * x2 + 0.0115 * x3
+			- 0.036 * x4 - 0.056 * x5 + 0.026 * x6 + 0.0401 * x7 - 0.0135 * x8;
+	J[21] = 0.00769 + 0.0148 * x0 + 0.00483 * x1 + 0.0115 * x2 - 0.0248 * x3
+			+ 0.0693 * x4 + 0.0316 * x5 + 0.00238 * x6 - 0.00732 * x7
+			- 0.00469 * x8;
+	J[22] = -0.0405 + 0.00704 * x0 - 0.00963 * x1 - 0.036 * x2 + 0.0693 * x3
+			- 0.01922 * x4 - 0.0818 * x5 + 0.0574 * x6 - 0.00144 * x7
+			+ 0.000995 * x8;
+	J[23] = -0.029 - 0.013 * x0 - 0.0121 * x1 - 0.056 * x2 + 0.0316 * x3
+			- 0.0818 * x4 + 0.048 * x5 + 0.0209 * x6 + 0.065 * x7 + 0.0199 * x8;
+	J[24] = -0.075 - 0.00655 * x0 + 0.0702 * x1 + 0.026 * x2 + 0.00238 * x3
+			+ 0.0574 * x4 + 0.0209 * x5 + 0.1726 * x6 - 0.0495 * x7
+			- 0.0087 * x8;
+	J[25] = 0.012 + 0.0971 * x0 + 0.0121 * x1 + 0.0401 * x2 - 0.00732 * x3
+			- 0.00144 * x4 + 0.065 * x5 - 0.0495 * x6 + 0.0038 * x7
+			- 0.00455 * x8;
+	J[26] = 0.0104 - 0.0108 * x0 - 0.000194 * x1 - 0.0135 * x2 - 0.00469 * x3
+			+ 0.000995 * x4 + 0.0199 * x5 - 0.0087 * x6 - 0.00455 * x7
+			+ 0.01512 * x8;
+	return;
+}
+
+/* Xu2020: 16 monomials, Horner form, 60 flops (term by term 80) */
+GMF_KERNEL void Xu2020_poly_eval(double *F, size_t incf, const double *xr,
+		size_t incx)
+{
+	double x0 = xr[0];
+	double x1 = xr[incx];
+	double x2 = xr[2 * incx];
+	double x3 = xr[3 * incx];
+
+	F[0] = -54.3 + x0 * (-1.18 + 0.066 * x0 - 18.9 * x1 - 0.209 * x2
+			- 0.673 * x3) + x1 * (-2429.0 + 32117.0 * x1 + 265.0 * x2
+			+ 1209.0 * x3) + x2 * (104.2 - 16.98 * x2 + 22.76 * x3)
+			+ x3 * (129.0 - 47.6 * x3);
+	F[incf] = 0.227 + x0 * (-0.0072 + 0.000355 * x0 - 0.198 * x1 - 0.000955 * x2
+			- 0.00656 * x3) + x1 * (1.89 + 35.0 * x1 + 0.209 * x2 + 0.783 * x3)
+			+ x2 * (-0.0203 + 0.00037 * x2 + 0.02275 * x3) + x3 * (0.3075
+			- 0.0791 * x3);
+	F[2 * incf] = -127.32395447351627 * x3 * x2 * x1 * x0;
+	return;
+}
+
+GMF_KERNEL void Xu2020_poly_evalf(float *F, size_t incf, const float *xr,
+		size_t incx)
+{
+	float x0 = xr[0];
+	float x1 = xr[incx];
+	float x2 = xr[2 * incx];
+	float x3 = xr[3 * incx];
+
+	F[0] = -54.3f + x0 * (-1.18f + 0.066f * x0 - 18.9f * x1 - 0.209f * x2
+			- 0.673f * x3) + x1 * (-2429.0f + 32117.0f * x1 + 265.0f * x2
+			+ 1209.0f * x3) + x2 * (104.2f - 16.98f * x2 + 22.76f * x3)
+			+ x3 * (129.0f - 47.6f * x3);
+	F[incf] = 0.227f + x0 * (-0.0072f + 0.000355f * x0 - 0.198f * x1
+			- 0.000955f * x2 - 0.00656f * x3) + x1 * (1.89f + 35.0f * x1
+			+ 0.209f * x2 + 0.783f * x3) + x2 * (-0.0203f + 0.00037f * x2
+			+ 0.02275f * x3) + x3 * (0.3075f - 0.0791f * x3);
+	F[2 * incf] = -127.32395f * x3 * x2 * x1 * x0;
+	return;
+}
+
+/* Xu2020: objectives and Jacobian, 140 flops */
+GMF_KERNEL void Xu2020_poly_jac(double *F, double *J, const double *xr)
+{
+	double x0 = xr[0];
+	double x1 = xr[1];
+	double x2 = xr[2];
+	double x3 = xr[3];
+	double m0 = x0 * x0;
+	double m1 = x1 * x0;
+	double m2 = x2 * x0;
+	double m3 = x3 * x0;
+	double m4 = x1 * x1;
+	double m5 = x2 * x1;
+	double m6 = x3 * x1;
+	double m7 = x2 * x2;
+	double m8 = x3 * x2;
+	double m9 = x3 * x3;
+	double m10 = m8 * x1;
+	double m11 = m10 * x0;
+	double m12 = m8 * x0;
+	double m13 = m6 * x0;
+	double m14 = m5 * x0;
+
+	F[0] = -54.3 - 1.18 * x0 - 2429.0 * x1 + 104.2 * x2 + 129.0 * x3
+			+ 0.066 * m0 - 18.9 * m1 - 0.209 * m2 - 0.673 * m3 + 32117.0 * m4
+			+ 265.0 * m5 + 1209.0 * m6 - 16.98 * m7 + 22.76 * m8 - 47.6 * m9;
+	F[1] = 0.227 - 0.0072 * x0 + 1.89 * x1 - 0.0203 * x2 + 0.3075 * x3
+			+ 0.000355 * m0 - 0.198 * m1 - 0.000955 * m2 - 0.00656 * m3
+			+ 35.0 * m4 + 0.209 * m5 + 0.783 * m6 + 0.00037 * m7 + 0.02275 * m8
+			- 0.0791 * m9;
+	F[2] = -127.32395447351627 * m11;
+	J[0] = -1.18 + 0.132 * x0 - 18.9 * x1 - 0.209 * x2 - 0.673 * x3;
+	J[1] = -2429.0 - 18.9 * x0 + 64234.0 * x1 + 265.0 * x2 + 1209.0 * x3;
+	J[2] = 104.2 - 0.209 * x0 + 265.0 * x1 - 33.96 * x2 + 22.76 * x3;
+	J[3] = 129.0 - 0.673 * x0 + 1209.0 * x1 + 22.76 * x2 - 95.2 * x3;
+	J[4] = -0.0072 + 0.00071 * x0 - 0.198 * x1 - 0.000955 * x2 - 0.00656 * x3;
+	J[5] = 1.89 - 0.198 * x0 + 7e+01 * x1 + 0.209 * x2 + 0.783 * x3;
+	J[6] = -0.0203 - 0.000955 * x0 + 0.209 * x1 + 0.00074 * x2 + 0.02275 * x3;
+	J[7] = 0.3075 - 0.00656 * x0 + 0.783 * x1 + 0.02275 * x2 - 0.1582 * x3;
+	J[8] = -127.32395447351627 * m10;
+	J[9] = -127.32395447351627 * m12;
+	J[10] = -127.32395447351627 * m13;
+	J[11] = -127.32395447351627 * m14;
+	return;
+}
+
+/* Vaidyanathan2004: 22 monomials, Horner form, 124 flops (term by term 177) */
+GMF_KERNEL void Vaidyanathan2004_poly_eval(double *F, size_t incf, const double *xr,
+		size_t incx)
+{
+	double x0 = xr[0];
+	double x1 = xr[incx];
+	double x2 = xr[2 * incx];
+	double x3 = xr[3 * incx];
+
+	F[0] = 0.692 + x0 * (0.477 - 0.167 * x0 - 0.0129 * x1 - 0.0634 * x2
+			- 0.0521 * x3) + x1 * (-0.687 + 0.0796 * x1 - 0.0257 * x2
+			+ 0.00156 * x3) + x2 * (-0.08 + 0.0877 * x2 + 0.00198 * x3)
+			+ x3 * (-0.065 + 0.0184 * x3);
+	F[incf] = 0.758 + x0 * (0.358 - 0.172 * x0 + 0.0106 * x1 - 0.146 * x2
+			- 0.0694 * x3) + x1 * (-0.807 + 0.0697 * x1 - 0.0416 * x2
+			- 0.00503 * x3) + x2 * (0.0925 + 0.102 * x2 + 0.0151 * x3)
+			+ x3 * (-0.0468 + 0.0173 * x3);
+	F[2 * incf] = 0.37 + x0 * (-0.205 + x1 * (0.0141 + 0.202 * x0 - 0.342 * x1
+			- 0.281 * x2) + x0 * (-0.135 - 0.281 * x2) + x3 * (0.353
+			- 0.184 * x3) + 0.208 * x2) + x2 * (0.108 + x1 * (-0.0301
+			- 0.245 * x1 + 0.281 * x2) - 0.226 * x2 - 0.0497 * x3)
+			+ x1 * (0.0307 + 0.0998 * x1) + x3 * (1.019 - 0.423 * x3);
+	F[3 * incf] = 0.153 + x0 * (-0.322 + 0.175 * x0 + 0.0185 * x1 - 0.251 * x2
+			+ 0.0134 * x3) + x1 * (0.396 - 0.0701 * x1 + 0.179 * x2
+			+ 0.0296 * x3) + x2 * (0.424 + 0.015 * x2 + 0.0752 * x3)
+			+ x3 * (0.0226 + 0.0192 * x3);
+	return;
+}
+
+GMF_KERNEL void Vaidyanathan2004_poly_evalf(float *F, size_t incf, const float *xr,
+		size_t incx)
+{
+	float x0 = xr[0];
+	float x1 = xr[incx];
+	float x2 = xr[2 * incx];
+	float x3 = xr[3 * incx];
+
+	F[0] = 0.692f + x0 * (0.477f - 0.167f * x0 - 0.0129f * x1 - 0.0634f * x2
+			- 0.0521f * x3) + x1 * (-0.687f + 0.0796f * x1 - 0.0257f * x2
+			+ 0.00156f * x3) + x2 * (-0.08f + 0.0877f * x2 + 0.00198f * x3)
+			+ x3 * (-0.065f + 0.0184f * x3);
+	F[incf] = 0.758f + x0 * (0.358f - 0.172f * x0 + 0.0106f * x1 - 0.146f * x2
+			- 0.0694f * x3) + x1 * (-0.807f + 0.0697f * x1 - 0.0416f * x2
+			- 0.00503f * x3) + x2 * (0.0925f + 0.102f * x2 + 0.0151f * x3)
+			+ x3 * (-0.0468f + 0.0173f * x3);
+	F[2 * incf] = 0.37f + x0 * (-0.205f + x1 * (0.0141f + 0.202f * x0
+			- 0.342f * x1 - 0.281f * x2) + x0 * (-0.135f - 0.281f * x2)
+			+ x3 * (0.353f - 0.184f * x3) + 0.208f * x2) + x2 * (0.108f
+			+ x1 * (-0.0301f - 0.245f * x1 + 0.281f * x2) - 0.226f * x2
+			- 0.0497f * x3) + x1 * (0.0307f + 0.0998f * x1) + x3 * (1.019f
+			- 0.423f * x3);
+	F[3 * incf] = 0.153f + x0 * (-0.322f + 0.175f * x0 + 0.0185f * x1
+			- 0.251f * x2 + 0.0134f * x3) + x1 * (0.396f - 0.0701f * x1
+			+ 0.179f * x2 + 0.0296f * x3) + x2 * (0.424f + 0.015f * x2
+			+ 0.0752f * x3) + x3 * (0.0226f + 0.0192f * x3);
+	return;
+}
+
+/* Vaidyanathan2004: objectives and Jacobian, 295 flops */
+GMF_KERNEL void Vaidyanathan2004_poly_jac(double *F, double *J, const double *xr)
+{
+	double x0 = xr[0];
+	double x1 = xr[1];
+	double x2 = xr[2];
+	double x3 = xr[3];
+	double m0 = x0 * x0;
+	double m1 = x1 * x0;
+	double m2 = x2 * x0;
+	double m3 = x3 * x0;
+	double m4 = x1 * x1;
+	double m5 = x2 * x1;
+	double m6 = x3 * x1;
+	double m7 = x2 * x2;
+	double m8 = x3 * x2;
+	double m9 = x3 * x3;
+	double m10 = m1 * x0;
+	double m11 = m2 * x0;
+	double m12 = m4 * x0;
+	double m13 = m5 * x0;
+	double m14 = m9 * x0;
+	double m15 = m5 * x1;
+	double m16 = m7 * x1;
+
+	F[0] = 0.692 + 0.477 * x0 - 0.687 * x1 - 0.08 * x2 - 0.065 * x3 - 0.167 * m0
+			- 0.0129 * m1 - 0.0634 * m2 - 0.0521 * m3 + 0.0796 * m4
+			- 0.0257 * m5 + 0.00156 * m6 + 0.0877 * m7 + 0.00198 * m8
+			+ 0.0184 * m9;
+	F[1] = 0.758 + 0.358 * x0 - 0.807 * x1 + 0.0925 * x2 - 0.0468 * x3
+			- 0.172 * m0 + 0.0106 * m1 - 0.146 * m2 - 0.0694 * m3 + 0.0697 * m4
+			- 0.0416 * m5 - 0.00503 * m6 + 0.102 * m7 + 0.0151 * m8
+			+ 0.0173 * m9;
+	F[2] = 0.37 - 0.205 * x0 + 0.0307 * x1 + 0.108 * x2 + 1.019 * x3
+			- 0.135 * m0 + 0.0141 * m1 + 0.208 * m2 + 0.353 * m3 + 0.0998 * m4
+			- 0.0301 * m5 - 0.226 * m7 - 0.0497 * m8 - 0.423 * m9 + 0.202 * m10
+			- 0.281 * m11 - 0.342 * m12 - 0.281 * m13 - 0.184 * m14
+			- 0.245 * m15 + 0.281 * m16;
+	F[3] = 0.153 - 0.322 * x0 + 0.396 * x1 + 0.424 * x2 + 0.0226 * x3
+			+ 0.175 * m0 + 0.0185 * m1 - 0.251 * m2 + 0.0134 * m3 - 0.0701 * m4
+			+ 0.179 * m5 + 0.0296 * m6 + 0.015 * m7 + 0.0752 * m8 + 0.0192 * m9;
+	J[0] = 0.477 - 0.334 * x0 - 0.0129 * x1 - 0.0634 * x2 - 0.0521 * x3;
+	J[1] = -0.687 - 0.0129 * x0 + 0.1592 * x1 - 0.0257 * x2 + 0.00156 * x3;
+	J[2] = -0.08 - 0.0634 * x0 - 0.0257 * x1 + 0.1754 * x2 + 0.00198 * x3;
+	J[3] = -0.065 - 0.0521 * x0 + 0.00156 * x1 + 0.00198 * x2 + 0.0368 * x3;
+	J[4] = 0.358 - 0.344 * x0 + 0.0106 * x1 - 0.146 * x2 - 0.0694 * x3;
+	J[5] = -0.807 + 0.0106 * x0 + 0.1394 * x1 - 0.0416 * x2 - 0.00503 * x3;
+	J[6] = 0.0925 - 0.146 * x0 - 0.0416 * x1 + 0.204 * x2 + 0.0151 * x3;
+	J[7] = -0.0468 - 0.0694 * x0 - 0.00503 * x1 + 0.0151 * x2 + 0.0346 * x3;
+	J[8] = -0.205 - 0.27 * x0 + 0.0141 * x1 + 0.208 * x2 + 0.353 * x3
+			+ 0.404 * m1 - 0.562 * m2 - 0.342 * m4 - 0.281 * m5 - 0.184 * m9;
+	J[9] = 0.0307 + 0.0141 * x0 + 0.1996 * x1 - 0.0301 * x2 + 0.202 * m0
+			- 0.684 * m1 - 0.281 * m2 - 0.49 * m5 + 0.281 * m7;
+	J[10] = 0.108 + 0.208 * x0 - 0.0301 * x1 - 0.452 * x2 - 0.0497 * x3
+			- 0.281 * m0 - 0.281 * m1 - 0.245 * m4 + 0.562 * m5;
+	J[11] = 1.019 + 0.353 * x0 - 0.0497 * x2 - 0.846 * x3 - 0.368 * m3;
+	J[12] = -0.322 + 0.35 * x0 + 0.0185 * x1 - 0.251 * x2 + 0.0134 * x3;
+	J[13] = 0.396 + 0.0185 * x0 - 0.1402 * x1 + 0.179 * x2 + 0.0296 * x3;
+	J[14] = 0.424 - 0.251 * x0 + 0.179 * x1 + 0.03 * x2 + 0.0752 * x3;
+	J[15] = 0.0226 + 0.0134 * x0 + 0.0296 * x1 + 0.0752 * x2 + 0.0384 * x3;
+	return;
+}
+
+/* Chen2015: 21 monomials, Horner form, 89 flops (term by term 134) */
+GMF_KERNEL void Chen2015_poly_eval(double *F, size_t incf, const double *xr,
+		size_t incx)
+{
+	double x0 = xr[0];
+	double x1 = xr[incx];
+	double x2 = xr[2 * incx];
+	double x3 = xr[3 * incx];
+	double x4 = xr[4 * incx];
+	double x5 = xr[5 * incx];
+
+	F[0] = -12656.02 + x1 * (780.82 + x3 * (-144.76 + 31.67 * x2 * x0)
+			- 78.88 * x4) + x4 * (993.4 + 114.9 * x5) + 17.232 * x0
+			+ 2895.2 * x3 - 624.9 * x5;
+	F[incf] = 8391.99 + x1 * (-220.8 + x3 * (-2007.34 + 81.22 * x1
+			+ 50.62 * x4) * x2 * x0 - 94.46 * x4) - 18.388 * x0 + 1411.31 * x4;
+	F[2 * incf] = 3591.8 + x1 * (85.5 + x3 * (-239.12 + 45.82 * x5) * x2 * x0)
+			+ x4 * (-442.66 + 70.18 * x5) - 964.86 * x5;
+	F[3 * incf] = -12.73 + x0 * (0.568 + x1 * (-0.024 + x2 * (x4 * (0.36
+			- 0.016 * x0) - 0.02 * x3)) + 0.016 * x2) + x1 * (0.48
+			+ 0.06 * x5 * x4 * x3) - 0.38 * x2;
+	F[4 * incf] = 25.41 + x0 * (-0.048 + x2 * (x4 * (-2.04
+			+ 0.14 * x3 * x2 * x1 * x0 + 0.16 * x4) - 0.82 * x3) * x1)
+			- 0.52 * x1 - 1.04 * x4;
+	return;
+}
+
+GMF_KERNEL void Chen2015_poly_evalf(float *F, size_t incf, const float *xr,
+		size_t incx)
+{
+	float x0 = xr[0];
+	float x1 = xr[incx];
+	float x2 = xr[2 * incx];
+	float x3 = xr[3 * incx];
+	float x4 = xr[4 * incx];
+	float x5 = xr[5 * incx];
+
+	F[0] = -12656.02f + x1 * (780.82f + x3 * (-144.76f + 31.67f * x2 * x0)
+			- 78.88f * x4) + x4 * (993.4f + 114.9f * x5) + 17.232f * x0
+			+ 2895.2f * x3 - 624.9f * x5;
+	F[incf] = 8391.99f + x1 * (-220.8f + x3 * (-2007.34f + 81.22f * x1
+			+ 50.62f * x4) * x2 * x0 - 94.46f * x4) - 18.388f * x0
+			+ 1411.31f * x4;
+	F[2 * incf] = 3591.8f + x1 * (85.5f + x3 * (-239.12f
+			+ 45.82f * x5) * x2 * x0) + x4 * (-442.66f + 70.18f * x5)
+			- 964.86f * x5;
+	F[3 * incf] = -12.73f + x0 * (0.568f + x1 * (-0.024f + x2 * (x4 * (0.36f
+			- 0.016f * x0) - 0.02f * x3)) + 0.016f * x2) + x1 * (0.48f
+			+ 0.06f * x5 * x4 * x3) - 0.38f * x2;
+	F[4 * incf] = 25.41f + x0 * (-0.048f + x2 * (x4 * (-2.04f
+			+ 0.14f * x3 * x2 * x1 * x0 + 0.16f * x4) - 0.82f * x3) * x1)
+			- 0.52f * x1 - 1.04f * x4;
+	return;
+}
+
+/* Chen2015: objectives and Jacobian, 267 flops */
+GMF_KERNEL void Chen2015_poly_jac(double *F, double *J, const double *xr)
+{
+	double x0 = xr[0];
+	double x1 = xr[1];
+	double x2 = xr[2];
+	double x3 = xr[3];
+	double x4 = xr[4];
+	double x5 = xr[5];
+	double m0 = x3 * x1;
+	double m1 = x4 * x1;
+	double m2 = x5 * x4;
+	double m3 = m0 * x2;
+	double m4 = m3 * x0;
+	double m5 = x3 * x2;
+	double m6 = m5 * x0;
+	double m7 = m0 * x0;
+	double m8 = x2 * x1;
+	double m9 = m8 * x0;
+	double m10 = m4 * x1;
+	double m11 = m4 * x4;
+	double m12 = m3 * x1;
+	double m13 = m3 * x4;
+	double m14 = m6 * x4;
+	double m15 = m7 * x1;
+	double m16 = m7 * x4;
+	double m17 = m9 * x1;
+	double m18 = m9 * x4;
+	double m19 = m4 * x5;
+	double m20 = m3 * x5;
+	double m21 = m6 * x5;
+	double m22 = m7 * x5;
+	double m23 = m9 * x5;
+	double m24 = x1 * x0;
+	double m25 = x2 * x0;
+	double m26 = m2 * x3;
+	double m27 = m26 * x1;
+	double m28 = m18 * x0;
+	double m29 = m1 * x2;
+	double m30 = m25 * x4;
+	double m31 = m30 * x0;
+	double m32 = m1 * x0;
+	double m33 = m32 * x0;
+	double m34 = m2 * x1;
+	double m35 = m0 * x5;
+	double m36 = m9 * x0;
+	double m37 = m1 * x3;
+	double m38 = m18 * x4;
+	double m39 = m13 * x2;
+	double m40 = m39 * x1;
+	double m41 = m40 * x0;
+	double m42 = m41 * x0;
+	double m43 = m29 * x4;
+	double m44 = m30 * x4;
+	double m45 = m39 * x0;
+	double m46 = m45 * x0;
+	double m47 = m32 * x4;
+	double m48 = m11 * x1;
+	double m49 = m48 * x0;
+	double m50 = m29 * x2;
+	double m51 = m50 * x1;
+	double m52 = m51 * x0;
+	double m53 = m52 * x0;
+	double m54 = m10 * x2;
+	double m55 = m54 * x0;
+
+	F[0] = -12656.02 + 17.232 * x0 + 780.82 * x1 + 2895.2 * x3 + 993.4 * x4
+			- 624.9 * x5 - 144.76 * m0 - 78.88 * m1 + 114.9 * m2 + 31.67 * m4;
+	F[1] = 8391.99 - 18.388 * x0 - 220.8 * x1 + 1411.31 * x4 - 94.46 * m1
+			- 2007.34 * m4 + 81.22 * m10 + 50.62 * m11;
+	F[2] = 3591.8 + 85.5 * x1 - 442.66 * x4 - 964.86 * x5 + 70.18 * m2
+			- 239.12 * m4 + 45.82 * m19;
+	F[3] = -12.73 + 0.568 * x0 + 0.48 * x1 - 0.38 * x2 - 0.024 * m24
+			+ 0.016 * m25 - 0.02 * m4 + 0.36 * m18 + 0.06 * m27 - 0.016 * m28;
+	F[4] = 25.41 - 0.048 * x0 - 0.52 * x1 - 1.04 * x4 - 0.82 * m4 - 2.04 * m18
+			+ 0.16 * m38 + 0.14 * m42;
+	J[0] = 17.232 + 31.67 * m3;
+	J[1] = 780.82 - 144.76 * x3 - 78.88 * x4 + 31.67 * m6;
+	J[2] = 31.67 * m7;
+	J[3] = 2895.2 - 144.76 * x1 + 31.67 * m9;
+	J[4] = 993.4 - 78.88 * x1 + 114.9 * x5;
+	J[5] = -624.9 + 114.9 * x4;
+	J[6] = -18.388 - 2007.34 * m3 + 81.22 * m12 + 50.62 * m13;
+	J[7] = -220.8 - 94.46 * x4 - 2007.34 * m6 + 162.44 * m4 + 50.62 * m14;
+	J[8] = -2007.34 * m7 + 81.22 * m15 + 50.62 * m16;
+	J[9] = -2007.34 * m9 + 81.22 * m17 + 50.62 * m18;
+	J[10] = 1411.31 - 94.46 * x1 + 50.62 * m4;
+	J[11] = 0.0;
+	J[12] = -239.12 * m3 + 45.82 * m20;
+	J[13] = 85.5 - 239.12 * m6 + 45.82 * m21;
+	J[14] = -239.12 * m7 + 45.82 * m22;
+	J[15] = -239.12 * m9 + 45.82 * m23;
+	J[16] = -442.66 + 70.18 * x5;
+	J[17] = -964.86 + 70.18 * x4 + 45.82 * m4;
+	J[18] = 0.568 - 0.024 * x1 + 0.016 * x2 - 0.02 * m3 + 0.36 * m29
+			- 0.032 * m18;
+	J[19] = 0.48 - 0.024 * x0 - 0.02 * m6 + 0.36 * m30 + 0.06 * m26
+			- 0.016 * m31;
+	J[20] = -0.38 + 0.016 * x0 - 0.02 * m7 + 0.36 * m32 - 0.016 * m33;
+	J[21] = -0.02 * m9 + 0.06 * m34;
+	J[22] = 0.36 * m9 + 0.06 * m35 - 0.016 * m36;
+	J[23] = 0.06 * m37;
+	J[24] = -0.048 - 0.82 * m3 - 2.04 * m29 + 0.16 * m43 + 0.28 * m41;
+	J[25] = -0.52 - 0.82 * m6 - 2.04 * m30 + 0.16 * m44 + 0.28 * m46;
+	J[26] = -0.82 * m7 - 2.04 * m32 + 0.16 * m47 + 0.28 * m49;
+	J[27] = -0.82 * m9 + 0.14 * m53;
+	J[28] = -1.04 - 2.04 * m9 + 0.32 * m18 + 0.14 * m55;
+	J[29] = 0.0;
+	return;
+}
+
+/* Ahmad2017: 10 monomials, Horner form, 76 flops (term by term 93) */
+GMF_KERNEL void Ahmad2017_poly_eval(double *F, size_t incf, const double *xr,
+		size_t incx)
+{
+	double x0 = xr[0];
+	double x1 = xr[incx];
+	double x2 = xr[2 * incx];
+
+	F[0] = 1346.37 + x0 * (-1.99 + 0.02 * x0) + x2 * (-17.12 + 0.05 * x2)
+			- 0.33 * x1;
+	F[incf] = 4260.47 + x0 * (-4.27 + 0.04 * x0 + 0.04 * x1) + x2 * (-52.3
+			+ 0.16 * x2) - 1.5 * x1;
+	F[2 * incf] = -1353.47 + x0 * (32.32 + 0.06 * x0 - 0.24 * x2) + x1 * (24.56
+			+ 0.1 * x1 - 0.19 * x2) + 10.48 * x2;
+	F[3 * incf] = 2415.46 + x0 * (1.556 - 0.03 * x0) + x2 * (-31.14 + 0.1 * x2)
+			- 0.77 * x1;
+	F[4 * incf] = 9.56 + x1 * (-0.03 - 0.001 * x0 + 0.0009 * x1) + 0.02 * x0
+			- 0.03 * x2;
+	F[5 * incf] = 6458.62 + x0 * (-14.246 + 0.22 * x0) + x1 * (-5.0 + 0.33 * x1)
+			+ 4.3 * x2;
+	F[6 * incf] = 1986.67 + x1 * (-73.65 - 0.2 * x1 + 0.56 * x2) - 3.55 * x0
+			- 10.8 * x2;
+	return;
+}
+
+GMF_KERNEL void Ahmad2017_poly_evalf(float *F, size_t incf, const float *xr,
+		size_t incx)
+{
+	float x0 = xr[0];
+	float x1 = xr[incx];
+	float x2 = xr[2 * incx];
+
+	F[0] = 1346.37f + x0 * (-1.99f + 0.02f * x0) + x2 * (-17.12f + 0.05f * x2)
+			- 0.33f * x1;
+	F[incf] = 4260.47f + x0 * (-4.27f + 0.04f * x0 + 0.04f * x1) + x2 * (-52.3f
+			+ 0.16f * x2) - 1.5f * x1;
+	F[2 * incf] = -1353.47f + x0 * (32.32f + 0.06f * x0 - 0.24f * x2)
+			+ x1 * (24.56f + 0.1f * x1 - 0.19f * x2) + 10.48f * x2;
+	F[3 * incf] = 2415.46f + x0 * (1.556f - 0.03f * x0) + x2 * (-31.14f
+			+ 0.1f * x2) - 0.77f * x1;
+	F[4 * incf] = 9.56f + x1 * (-0.03f - 0.001f * x0 + 0.0009f * x1)
+			+ 0.02f * x0 - 0.03f * x2;
+	F[5 * incf] = 6458.62f + x0 * (-14.246f + 0.22f * x0) + x1 * (-5.0f
+			+ 0.33f * x1) + 4.3f * x2;
+	F[6 * incf] = 1986.67f + x1 * (-73.65f - 0.2f * x1 + 0.56f * x2)
+			- 3.55f * x0 - 10.8f * x2;
+	return;
+}
+
+/* Ahmad2017: objectives and Jacobian, 126 flops */
+GMF_KERNEL void Ahmad2017_poly_jac(double *F, double *J, const double *xr)
+{
+	double x0 = xr[0];
+	double x1 = xr[1];
+	double x2 = xr[2];
+	double m0 = x0 * x0;
+	double m1 = x2 * x2;
+	double m2 = x1 * x0;
+	double m3 = x2 * x0;
+	double m4 = x1 * x1;
+	double m5 = x2 * x1;
+
+	F[0] = 1346.37 - 1.99 * x0 - 0.33 * x1 - 17.12 * x2 + 0.02 * m0 + 0.05 * m1;
+	F[1] = 4260.47 - 4.27 * x0 - 1.5 * x1 - 52.3 * x2 + 0.04 * m0 + 0.04 * m2
+			+ 0.16 * m1;
+	F[2] = -1353.47 + 32.32 * x0 + 24.56 * x1 + 10.48 * x2 + 0.06 * m0
+			- 0.24 * m3 + 0.1 * m4 - 0.19 * m5;
+	F[3] = 2415.46 + 1.556 * x0 - 0.77 * x1 - 31.14 * x2 - 0.03 * m0 + 0.1 * m1;
+	F[4] = 9.56 + 0.02 * x0 - 0.03 * x1 - 0.03 * x2 - 0.001 * m2 + 0.0009 * m4;
+	F[5] = 6458.62 - 14.246 * x0 - 5.0 * x1 + 4.3 * x2 + 0.22 * m0 + 0.33 * m4;
+	F[6] = 1986.67 - 3.55 * x0 - 73.65 * x1 - 10.8 * x2 - 0.2 * m4 + 0.56 * m5;
+	J[0] = -1.99 + 0.04 * x0;
+	J[1] = -0.33;
+	J[2] = -17.12 + 0.1 * x2;
+	J[3] = -4.27 + 0.08 * x0 + 0.04 * x1;
+	J[4] = -1.5 + 0.04 * x0;
+	J[5] = -52.3 + 0.32 * x2;
+	J[6] = 32.32 + 0.12 * x0 - 0.24 * x2;
+	J[7] = 24.56 + 0.2 * x1 - 0.19 * x2;
+	J[8] = 10.48 - 0.24 * x0 - 0.19 * x1;
+	J[9] = 1.556 - 0.06 * x0;
+	J[10] = -0.77;
+	J[11] = -31.14 + 0.2 * x2;
+	J[12] = 0.02 - 0.001 * x1;
+	J[13] = -0.03 - 0.001 * x0 + 0.0018 * x1;
+	J[14] = -0.03;
+	J[15] = -14.246 + 0.44 * x0;
+	J[16] = -5.0 + 0.66 * x1;
+	J[17] = 4.3;
+	J[18] = -3.55;
+	J[19] = -73.65 - 0.4 * x1 + 0.56 * x2;
+	J[20] = -10.8 + 0.56 * x1;
+	return;
+}
+
+#endif /* GMF_POLY_KERNELS_H_ */
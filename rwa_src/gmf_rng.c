@@ -0,0 +1,200 @@
+/*
+ * gmf_rng.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+#include <assert.h>
+#include "gmf_rng.h"
+
+#define PHILOX_M0 0xD2511F53u
+#define PHILOX_M1 0xCD9E8D57u
+#define PHILOX_W0 0x9E3779B9u
+#define PHILOX_W1 0xBB67AE85u
+
+/* Lanes per batch step; plain loops over them vectorize */
+#define GMF_RNG_LANES 8
+
+/**
+ * Philox4x32-10 on one 128-bit counter
+ */
+static void gmf_philox(const uint32_t key[2], uint32_t c[4])
+{
+	uint32_t k0 = key[0], k1 = key[1];
+	uint64_t p0, p1;
+	int r;
+	for (r = 0; r < 10; ++r)
+	{
+		p0 = (uint64_t) PHILOX_M0 * c[0];
+		p1 = (uint64_t) PHILOX_M1 * c[2];
+		c[0] = (uint32_t) (p1 >> 32) ^ c[1] ^ k0;
+		c[1] = (uint32_t) p1;
+		c[2] = (uint32_t) (p0 >> 32) ^ c[3] ^ k1;
+		c[3] = (uint32_t) p0;
+		k0 += PHILOX_W0;
+		k1 += PHILOX_W1;
+	}
+	return;
+}
+
+/**
+ * Philox4x32-10 on GMF_RNG_LANES consecutive blocks, structure-of-arrays
+ */
+static void gmf_philox_lanes(const uint32_t key[2], uint64_t stream,
+		uint64_t block, uint64_t *w)
+{
+	uint32_t c0[GMF_RNG_LANES], c1[GMF_RNG_LANES];
+	uint32_t c2[GMF_RNG_LANES], c3[GMF_RNG_LANES];
+	uint32_t k0 = key[0], k1 = key[1];
+	uint64_t p0, p1;
+	int r, l;
+	for (l = 0; l < GMF_RNG_LANES; ++l)
+	{
+		c0[l] = (uint32_t) (block + l);
+		c1[l] = (uint32_t) ((block + l) >> 32);
+		c2[l] = (uint32_t) stream;
+		c3[l] = (uint32_t) (stream >> 32);
+	}
+	for (r = 0; r < 10; ++r)
+	{
+		for (l = 0; l < GMF_RNG_LANES; ++l)
+		{
+			p0 = (uint64_t) PHILOX_M0 * c0[l];
+			p1 = (uint64_t) PHILOX_M1 * c2[l];
+			c0[l] = (uint32_t) (p1 >> 32) ^ c1[l] ^ k0;
+			c1[l] = (uint32_t) p1;
+			c2[l] = (uint32_t) (p0 >> 32) ^ c3[l] ^ k1;
+			c3[l] = (uint32_t) p0;
+		}
+		k0 += PHILOX_W0;
+		k1 += PHILOX_W1;
+	}
+	for (l = 0; l < GMF_RNG_LANES; ++l)
+	{
+		w[2 * l] = (uint64_t) c0[l] << 32 | c1[l];
+		w[2 * l + 1] = (uint64_t) c2[l] << 32 | c3[l];
+	}
+	return;
+}
+
+/**
+ * Word `position` of the stream. Each Philox block gives two words.
+ */
+static uint64_t gmf_rng_word(const gmf_rng *rng, uint64_t position)
+{
+	uint64_t block = position >> 1;
+	uint32_t c[4];
+	c[0] = (uint32_t) block;
+	c[1] = (uint32_t) (block >> 32);
+	c[2] = (uint32_t) rng->stream;
+	c[3] = (uint32_t) (rng->stream >> 32);
+	gmf_philox(rng->key, c);
+	return position & 1 ? (uint64_t) c[2] << 32 | c[3] :
+			(uint64_t) c[0] << 32 | c[1];
+}
+
+static double gmf_rng_to_unit(uint64_t w)
+{
+	return (double) (w >> 11) * 0x1.0p-53;
+}
+
+/**
+ * Starts stream `stream` of generator `seed` at word 0
+ */
+void gmf_rng_init(gmf_rng *rng, uint64_t seed, uint64_t stream)
+{
+	rng->key[0] = (uint32_t) seed;
+	rng->key[1] = (uint32_t) (seed >> 32);
+	rng->stream = stream;
+	rng->position = 0;
+	return;
+}
+
+/**
+ * Jumps nwords ahead (e.g. to split one stream into disjoint blocks)
+ */
+void gmf_rng_skip(gmf_rng *rng, uint64_t nwords)
+{
+	rng->position += nwords;
+	return;
+}
+
+uint64_t gmf_rng_next(gmf_rng *rng)
+{
+	return gmf_rng_word(rng, rng->position++);
+}
+
+/**
+ * Uniform double in [0, 1) with 53 random bits
+ */
+double gmf_rng_uniform(gmf_rng *rng)
+{
+	return gmf_rng_to_unit(gmf_rng_next(rng));
+}
+
+double gmf_rng_real(gmf_rng *rng, double lb, double ub)
+{
+	assert(lb <= ub);
+	return lb + gmf_rng_uniform(rng) * (ub - lb);
+}
+
+/**
+ * Unbiased integer in [0, n), n > 0
+ */
+size_t gmf_rng_index(gmf_rng *rng, size_t n)
+{
+	uint64_t w, threshold = (0 - (uint64_t) n) % n;
+	assert(n > 0);
+	do
+	{
+		w = gmf_rng_next(rng);
+	} while (w < threshold);
+	return (size_t) (w % n);
+}
+
+/**
+ * Fills w with the next n words, the same values as n calls to gmf_rng_next
+ */
+void gmf_rng_fill(gmf_rng *rng, size_t n, uint64_t *w)
+{
+	uint64_t lanes[2 * GMF_RNG_LANES];
+	size_t i = 0, k;
+
+	if (n > 0 && (rng->position & 1))
+	{
+		w[i++] = gmf_rng_next(rng);
+	}
+	for (; i + 2 * GMF_RNG_LANES <= n; i += 2 * GMF_RNG_LANES)
+	{
+		gmf_philox_lanes(rng->key, rng->stream, rng->position >> 1, w + i);
+		rng->position += 2 * GMF_RNG_LANES;
+	}
+	if (i < n)
+	{
+		gmf_philox_lanes(rng->key, rng->stream, rng->position >> 1, lanes);
+		for (k = 0; i < n; ++i, ++k)
+		{
+			w[i] = lanes[k];
+		}
+		rng->position += k;
+	}
+	return;
+}
+
+/**
+ * Fills u with the next n uniform doubles in [0, 1)
+ */
+void gmf_rng_uniform_fill(gmf_rng *rng, size_t n, double *u)
+{
+	uint64_t w[2 * GMF_RNG_LANES];
+	size_t i, k, m;
+	for (i = 0; i < n; i += m)
+	{
+		m = n - i < 2 * GMF_RNG_LANES ? n - i : 2 * GMF_RNG_LANES;
+		gmf_rng_fill(rng, m, w);
+		for (k = 0; k < m; ++k)
+		{
+			u[i + k] = gmf_rng_to_unit(w[k]);
+		}
+	}
+	return;
+}
@@ -0,0 +1,38 @@
+/*
+ * gmf_rng.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+#ifndef GMF_RNG_H_
+#define GMF_RNG_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Counter-based random number generator (Philox4x32-10, Salmon et al.,
+ * "Parallel random numbers: as easy as 1, 2, 3", SC 2011).
+ *
+ * Word k of a stream is a pure function of (seed, stream, k), so a state is
+ * just those three values: streams with different ids never overlap, any
+ * position can be reached in O(1) (gmf_rng_skip) and the batch fills return
+ * exactly the values that repeated single draws would. A state must not be
+ * shared between threads; give each thread its own stream instead.
+ */
+typedef struct gmf_rng
+{
+	uint32_t key[2]; /* seed */
+	uint64_t stream;
+	uint64_t position; /* index of the next 64-bit word */
+} gmf_rng;
+
+void gmf_rng_init(gmf_rng *rng, uint64_t seed, uint64_t stream);
+void gmf_rng_skip(gmf_rng *rng, uint64_t nwords);
+uint64_t gmf_rng_next(gmf_rng *rng);
+double gmf_rng_uniform(gmf_rng *rng);
+double gmf_rng_real(gmf_rng *rng, double lb, double ub);
+size_t gmf_rng_index(gmf_rng *rng, size_t n);
+void gmf_rng_fill(gmf_rng *rng, size_t n, uint64_t *w);
+void gmf_rng_uniform_fill(gmf_rng *rng, size_t n, double *u);
+
+#endif /* GMF_RNG_H_ */
@@ -0,0 +1,335 @@
+/*
+ * gmf_rwa.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+#ifndef GMF_RWA_HPP_
+#define GMF_RWA_HPP_
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <variant>
+
+#include "gmf_global.h"
+
+/*
+ * Header-only C++20 layer over the RWA problems: one type per problem,
+ * Problem<Gao2020> and so on, with the dimensions, the box and the senses
+ * as constexpr members and an evaluate that the compiler inlines into the
+ * caller. Nothing is set up and nothing is allocated, so an optimizer
+ * written as a template over the problem type is compiled for its fixed
+ * dimensions and can unroll and vectorize its loops over them.
+ *
+ * evaluate computes the objectives of one point (F as in gmf_rwa_evaluate:
+ * minimized, the maximized objectives negated), and the batch overload a
+ * row- or column-major batch with the same layout as gmf_rwa_evaluate. The
+ * code is that of the generated kernels (gmf_poly_kernels.h, included here
+ * in namespace gmf::kernels), so the results are those of gmf_rwa_evaluate
+ * with gmf_kernels_generated, and agree with the published formulas to
+ * rounding (gmf_poly.h). The float overloads use the single-precision
+ * kernels (error bounds in gmf_rwa_float_error).
+ *
+ * AnyProblem is the variant of all ten types, for code that picks the
+ * problem at run time: make_problem builds it from a name or an index, and
+ * std::visit (or gmf::evaluate, which visits) reaches the inlined code
+ * once per call instead of through a function pointer per point.
+ *
+ *   gmf::Problem<gmf::Gao2020> gao;
+ *   std::array<double, gao.nobjs> f;
+ *   gao.evaluate(x, f);
+ *
+ *   auto problem = gmf::make_problem("Gao2020");
+ *   std::visit([&](auto p) { optimize(p); }, *problem);
+ */
+namespace gmf
+{
+
+namespace kernels
+{
+
+#ifndef GMF_KERNEL
+#define GMF_RWA_HPP_KERNEL /* ours, undefined after the kernels */
+#ifdef __GNUC__
+#define GMF_KERNEL inline __attribute__((always_inline))
+#else
+#define GMF_KERNEL inline
+#endif
+#endif
+
+using std::size_t;
+
+#include "gmf_poly_kernels.h"
+
+#ifdef GMF_RWA_HPP_KERNEL
+#undef GMF_KERNEL
+#undef GMF_RWA_HPP_KERNEL
+#endif
+
+} /* namespace kernels */
+
+/** **************************************************************************
+ ** Problem descriptions
+ ** **************************************************************************/
+#define GMF_RWA_KERNELS(name) \
+	static void eval(double *F, std::size_t incf, const double *x, \
+			std::size_t incx) \
+	{ \
+		kernels::name##_poly_eval(F, incf, x, incx); \
+	} \
+	static void evalf(float *F, std::size_t incf, const float *x, \
+			std::size_t incx) \
+	{ \
+		kernels::name##_poly_evalf(F, incf, x, incx); \
+	}
+
+struct Subasi2016
+{
+	static constexpr int function = 0;
+	static constexpr std::string_view name = "Subasi2016";
+	static constexpr std::array<double, 5> xmin = { 20.0, 6.0, 20.0, 0.0,
+			8000.0 };
+	static constexpr std::array<double, 5> xmax = { 60.0, 15.0, 40.0, 30.0,
+			25000.0 };
+	static constexpr std::array<int, 2> sense = { gmf_maximize,
+			gmf_minimize };
+	GMF_RWA_KERNELS(Subasi2016)
+};
+
+struct Goel2007
+{
+	static constexpr int function = 1;
+	static constexpr std::string_view name = "Goel2007";
+	static constexpr std::array<double, 4> xmin = { 0.0, 0.0, 0.0, 0.0 };
+	static constexpr std::array<double, 4> xmax = { 1.0, 1.0, 1.0, 1.0 };
+	static constexpr std::array<int, 3> sense = { gmf_minimize, gmf_minimize,
+			gmf_minimize };
+	GMF_RWA_KERNELS(Goel2007)
+};
+
+struct Liao2008
+{
+	static constexpr int function = 2;
+	static constexpr std::string_view name = "Liao2008";
+	static constexpr std::array<double, 5> xmin = { 1.0, 1.0, 1.0, 1.0, 1.0 };
+	static constexpr std::array<double, 5> xmax = { 3.0, 3.0, 3.0, 3.0, 3.0 };
+	static constexpr std::array<int, 3> sense = { gmf_minimize, gmf_minimize,
+			gmf_minimize };
+	GMF_RWA_KERNELS(Liao2008)
+};
+
+struct Ganesan2013
+{
+	static constexpr int function = 3;
+	static constexpr std::string_view name = "Ganesan2013";
+	static constexpr std::array<double, 3> xmin = { 0.25, 10000.0, 600.0 };
+	static constexpr std::array<double, 3> xmax = { 0.55, 20000.0, 1100.0 };
+	static constexpr std::array<int, 3> sense = { gmf_maximize, gmf_maximize,
+			gmf_minimize };
+	GMF_RWA_KERNELS(Ganesan2013)
+};
+
+struct Padhi2016
+{
+	static constexpr int function = 4;
+	static constexpr std::string_view name = "Padhi2016";
+	static constexpr std::array<double, 5> xmin = { 1.0, 10.0, 850.0, 20.0,
+			4.0 };
+	static constexpr std::array<double, 5> xmax = { 1.4, 26.0, 1650.0, 40.0,
+			8.0 };
+	static constexpr std::array<int, 3> sense = { gmf_maximize, gmf_minimize,
+			gmf_minimize };
+	GMF_RWA_KERNELS(Padhi2016)
+};
+
+struct Gao2020
+{
+	static constexpr int function = 5;
+	static constexpr std::string_view name = "Gao2020";
+	static constexpr std::array<double, 9> xmin = { 40.0, 0.35, 333.0, 20.0,
+			3000.0, 0.1, 308.0, 150.0, 0.1 };
+	static constexpr std::array<double, 9> xmax = { 100.0, 0.5, 363.0, 40.0,
+			4000.0, 3.0, 328.0, 200.0, 2.0 };
+	static constexpr std::array<int, 3> sense = { gmf_minimize, gmf_maximize,
+			gmf_maximize };
+	GMF_RWA_KERNELS(Gao2020)
+};
+
+struct Xu2020
+{
+	static constexpr int function = 6;
+	static constexpr std::string_view name = "Xu2020";
+	static constexpr std::array<double, 4> xmin = { 12.56, 0.02, 1.0, 0.5 };
+	static constexpr std::array<double, 4> xmax = { 25.12, 0.06, 5.0, 2.0 };
+	static constexpr std::array<int, 3> sense = { gmf_minimize, gmf_minimize,
+			gmf_maximize };
+	GMF_RWA_KERNELS(Xu2020)
+};
+
+struct Vaidyanathan2004
+{
+	static constexpr int function = 7;
+	static constexpr std::string_view name = "Vaidyanathan2004";
+	static constexpr std::array<double, 4> xmin = { 0.0, 0.0, 0.0, 0.0 };
+	static constexpr std::array<double, 4> xmax = { 1.0, 1.0, 1.0, 1.0 };
+	static constexpr std::array<int, 4> sense = { gmf_minimize, gmf_minimize,
+			gmf_minimize, gmf_minimize };
+	GMF_RWA_KERNELS(Vaidyanathan2004)
+};
+
+struct Chen2015
+{
+	static constexpr int function = 8;
+	static constexpr std::string_view name = "Chen2015";
+	static constexpr std::array<double, 6> xmin = { 17.5, 17.5, 2.0, 2.0, 5.0,
+			5.0 };
+	static constexpr std::array<double, 6> xmax = { 22.5, 22.5, 3.0, 3.0, 7.0,
+			6.0 };
+	static constexpr std::array<int, 5> sense = { gmf_minimize, gmf_maximize,
+			gmf_maximize, gmf_maximize, gmf_minimize };
+	GMF_RWA_KERNELS(Chen2015)
+};
+
+struct Ahmad2017
+{
+	static constexpr int function = 9;
+	static constexpr std::string_view name = "Ahmad2017";
+	static constexpr std::array<double, 3> xmin = { 10.0, 10.0, 150.0 };
+	static constexpr std::array<double, 3> xmax = { 50.0, 50.0, 170.0 };
+	static constexpr std::array<int, 7> sense = { gmf_maximize, gmf_maximize,
+			gmf_maximize, gmf_maximize, gmf_minimize, gmf_maximize,
+			gmf_maximize };
+	GMF_RWA_KERNELS(Ahmad2017)
+};
+
+#undef GMF_RWA_KERNELS
+
+/** **************************************************************************
+ ** Problems
+ ** **************************************************************************/
+template <class Tag>
+struct Problem
+{
+	using tag = Tag;
+	static constexpr int function = Tag::function;
+	static constexpr std::string_view name = Tag::name;
+	static constexpr std::size_t nreal = Tag::xmin.size();
+	static constexpr std::size_t nobjs = Tag::sense.size();
+	static constexpr std::array<double, nreal> xmin = Tag::xmin;
+	static constexpr std::array<double, nreal> xmax = Tag::xmax;
+	static constexpr std::array<int, nobjs> sense = Tag::sense;
+
+	/**
+	 * Objectives of x (nreal values) into f (nobjs values)
+	 */
+	static void evaluate(std::span<const double> x, std::span<double> f)
+	{
+		Tag::eval(f.data(), 1, x.data(), 1);
+		return;
+	}
+
+	static void evaluate(std::span<const float> x, std::span<float> f)
+	{
+		Tag::evalf(f.data(), 1, x.data(), 1);
+		return;
+	}
+
+	/**
+	 * A batch of n points, as gmf_rwa_evaluate
+	 */
+	static void evaluate(std::size_t n, const double *X, std::size_t ldx,
+			double *F, std::size_t ldf, int order)
+	{
+		std::size_t i;
+
+		if (order == gmf_col_major)
+		{
+			for (i = 0; i < n; ++i)
+			{
+				Tag::eval(F + i, ldf, X + i, ldx);
+			}
+			return;
+		}
+		for (i = 0; i < n; ++i)
+		{
+			Tag::eval(F + i * ldf, 1, X + i * ldx, 1);
+		}
+		return;
+	}
+};
+
+/** **************************************************************************
+ ** Static dispatch
+ ** **************************************************************************/
+using AnyProblem = std::variant<Problem<Subasi2016>, Problem<Goel2007>,
+		Problem<Liao2008>, Problem<Ganesan2013>, Problem<Padhi2016>,
+		Problem<Gao2020>, Problem<Xu2020>, Problem<Vaidyanathan2004>,
+		Problem<Chen2015>, Problem<Ahmad2017> >;
+
+namespace detail
+{
+
+template <std::size_t... I>
+inline std::optional<AnyProblem> make_problem(int function,
+		std::string_view name, std::index_sequence<I...>)
+{
+	std::optional<AnyProblem> problem;
+
+	((function == static_cast<int>(I)
+			|| name == std::variant_alternative_t<I, AnyProblem>::name
+			? (void) problem.emplace(std::in_place_index<I>) : (void) 0), ...);
+	return problem;
+}
+
+} /* namespace detail */
+
+/**
+ * The problem of index function (as gmf_rwa_index), none if unknown
+ */
+inline std::optional<AnyProblem> make_problem(int function)
+{
+	return detail::make_problem(function, std::string_view(),
+			std::make_index_sequence<std::variant_size_v<AnyProblem> >());
+}
+
+/**
+ * The problem of the given name, none if unknown
+ */
+inline std::optional<AnyProblem> make_problem(std::string_view name)
+{
+	return detail::make_problem(-1, name.empty() ? "?" : name,
+			std::make_index_sequence<std::variant_size_v<AnyProblem> >());
+}
+
+inline std::size_t nreal(const AnyProblem &problem)
+{
+	return std::visit([](auto p) { return p.nreal; }, problem);
+}
+
+inline std::size_t nobjs(const AnyProblem &problem)
+{
+	return std::visit([](auto p) { return p.nobjs; }, problem);
+}
+
+inline void evaluate(const AnyProblem &problem, std::span<const double> x,
+		std::span<double> f)
+{
+	std::visit([&](auto p) { p.evaluate(x, f); }, problem);
+	return;
+}
+
+inline void evaluate(const AnyProblem &problem, std::size_t n,
+		const double *X, std::size_t ldx, double *F, std::size_t ldf,
+		int order)
+{
+	std::visit([&](auto p) { p.evaluate(n, X, ldx, F, ldf, order); },
+			problem);
+	return;
+}
+
+} /* namespace gmf */
+
+#endif /* GMF_RWA_HPP_ */
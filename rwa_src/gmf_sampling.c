@@ -0,0 +1,341 @@
+/*
+ * gmf_sampling.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+#include <string.h>
+
+#include "gmf_global.h"
+#include "gmf_sampling.h"
+
+/**
+ * Sobol direction numbers (Joe & Kuo, "Constructing Sobol sequences with
+ * better two-dimensional projections", 2008) for dimensions 2..21:
+ * degree s of the primitive polynomial, its coefficients a and the initial
+ * numbers m_1..m_s. Dimension 1 uses the identity.
+ */
+static const unsigned sobol_poly[GMF_SAMPLER_MAXDIM - 1][2 + 7] =
+{
+{ 1, 0, 1 },
+{ 2, 1, 1, 3 },
+{ 3, 1, 1, 3, 1 },
+{ 3, 2, 1, 1, 1 },
+{ 4, 1, 1, 1, 3, 3 },
+{ 4, 4, 1, 3, 5, 13 },
+{ 5, 2, 1, 1, 5, 5, 17 },
+{ 5, 4, 1, 1, 5, 5, 5 },
+{ 5, 7, 1, 1, 7, 11, 19 },
+{ 5, 11, 1, 1, 5, 1, 1 },
+{ 5, 13, 1, 1, 1, 3, 11 },
+{ 5, 14, 1, 3, 5, 5, 31 },
+{ 6, 1, 1, 3, 3, 9, 7, 49 },
+{ 6, 13, 1, 1, 1, 15, 21, 21 },
+{ 6, 16, 1, 3, 1, 13, 27, 49 },
+{ 6, 19, 1, 1, 1, 15, 7, 5 },
+{ 6, 22, 1, 3, 1, 15, 13, 25 },
+{ 6, 25, 1, 1, 5, 5, 19, 61 },
+{ 7, 1, 1, 3, 7, 11, 23, 15, 103 },
+{ 7, 4, 1, 3, 7, 13, 13, 15, 69 } };
+
+static const unsigned halton_base[GMF_SAMPLER_MAXDIM] =
+{ 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61, 67, 71,
+		73 };
+
+static void gmf_sobol_init(gmf_sampler *sampler)
+{
+	size_t d;
+	unsigned k, l, s, a;
+	uint32_t *v;
+
+	for (k = 0; k < 32; ++k)
+	{
+		sampler->v[0][k] = (uint32_t) 1 << (31 - k);
+	}
+	for (d = 1; d < sampler->dim; ++d)
+	{
+		v = sampler->v[d];
+		s = sobol_poly[d - 1][0];
+		a = sobol_poly[d - 1][1];
+		for (k = 0; k < s; ++k)
+		{
+			v[k] = (uint32_t) sobol_poly[d - 1][2 + k] << (31 - k);
+		}
+		for (k = s; k < 32; ++k)
+		{
+			v[k] = v[k - s] ^ (v[k - s] >> s);
+			for (l = 1; l < s; ++l)
+			{
+				if ((a >> (s - 1 - l)) & 1)
+				{
+					v[k] ^= v[k - l];
+				}
+			}
+		}
+	}
+	for (d = 0; d < sampler->dim; ++d)
+	{
+		sampler->x[d] = 0;
+	}
+	return;
+}
+
+static void gmf_sobol_next(gmf_sampler *sampler, double *u)
+{
+	size_t d;
+	unsigned c = 0;
+	uint64_t i = sampler->index;
+
+	if (i > 0)
+	{
+		/* Gray code: point i differs from point i-1 in bit ctz(i) */
+		while (!((i >> c) & 1))
+		{
+			++c;
+		}
+		for (d = 0; d < sampler->dim; ++d)
+		{
+			sampler->x[d] ^= sampler->v[d][c];
+		}
+	}
+	for (d = 0; d < sampler->dim; ++d)
+	{
+		u[d] = (double) (sampler->x[d] ^ sampler->shift[d]) * 0x1.0p-32;
+	}
+	return;
+}
+
+static void gmf_halton_next(gmf_sampler *sampler, double *u)
+{
+	size_t d;
+	uint64_t i, b;
+	double f, r;
+
+	for (d = 0; d < sampler->dim; ++d)
+	{
+		b = halton_base[d];
+		i = sampler->index;
+		f = 1.0;
+		r = 0.0;
+		while (i > 0)
+		{
+			f /= b;
+			r += f * (i % b);
+			i /= b;
+		}
+		r += sampler->rotation[d];
+		u[d] = r >= 1.0 ? r - 1.0 : r;
+	}
+	return;
+}
+
+/**
+ * splitmix64 finalizer, the round function of the Feistel permutation
+ */
+static uint64_t gmf_mix(uint64_t z)
+{
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
+}
+
+/**
+ * Keyed bijection of [0, npoints): a 4-round Feistel network on
+ * 2 * half_bits bits, cycle-walking until the image falls in range.
+ */
+static uint64_t gmf_lhs_permute(const gmf_sampler *sampler, size_t d,
+		uint64_t i)
+{
+	uint64_t mask = ((uint64_t) 1 << sampler->half_bits) - 1;
+	uint64_t left, right, t;
+	int r;
+	do
+	{
+		left = i >> sampler->half_bits;
+		right = i & mask;
+		for (r = 0; r < 4; ++r)
+		{
+			t = right;
+			right = left ^ (gmf_mix(right ^ sampler->keys[d][r]) & mask);
+			left = t;
+		}
+		i = left << sampler->half_bits | right;
+	} while (i >= sampler->npoints);
+	return i;
+}
+
+static void gmf_lhs_next(gmf_sampler *sampler, double *u)
+{
+	size_t d;
+	double jitter;
+	for (d = 0; d < sampler->dim; ++d)
+	{
+		jitter = sampler->rng != NULL ? gmf_rng_uniform(sampler->rng) : 0.5;
+		u[d] = ((double) gmf_lhs_permute(sampler, d, sampler->index) + jitter)
+				/ (double) sampler->npoints;
+	}
+	return;
+}
+
+static void gmf_das_dennis_next(gmf_sampler *sampler, double *u)
+{
+	size_t d, k, last = sampler->dim - 1, t;
+
+	for (d = 0; d < sampler->dim; ++d)
+	{
+		u[d] = (double) sampler->counts[d] / (double) sampler->divisions;
+	}
+	/* next composition of `divisions` in reverse lexicographic order */
+	t = sampler->counts[last];
+	sampler->counts[last] = 0;
+	for (k = last; k-- > 0;)
+	{
+		if (sampler->counts[k] > 0)
+		{
+			sampler->counts[k]--;
+			sampler->counts[k + 1] = t + 1;
+			break;
+		}
+	}
+	return;
+}
+
+uint64_t gmf_das_dennis_count(size_t dim, size_t divisions)
+{
+	uint64_t count = 1;
+	size_t k;
+	/* C(divisions + dim - 1, dim - 1) */
+	for (k = 1; k < dim; ++k)
+	{
+		count = count * (divisions + k) / k;
+	}
+	return count;
+}
+
+/**
+ * Initializes a sampler of dim-dimensional points in [lb, ub] (unit box if
+ * lb or ub is NULL). npoints is the size of a Latin hypercube design and the
+ * number of divisions of a Das-Dennis lattice; Sobol and Halton take it as
+ * an optional limit (0: none). rng may be NULL; when given it must outlive
+ * the sampler. Returns 0 on bad arguments.
+ */
+int gmf_sampler_init(gmf_sampler *sampler, int kind, size_t dim,
+		const double *lb, const double *ub, uint64_t npoints, gmf_rng *rng)
+{
+	size_t d;
+	int r, bits;
+
+	if (dim == 0 || dim > GMF_SAMPLER_MAXDIM)
+	{
+		return 0;
+	}
+	memset(sampler, 0, sizeof(gmf_sampler));
+	sampler->kind = kind;
+	sampler->dim = dim;
+	sampler->rng = rng;
+	sampler->npoints = npoints;
+	for (d = 0; d < dim; ++d)
+	{
+		sampler->lb[d] = lb != NULL && ub != NULL ? lb[d] : 0.0;
+		sampler->width[d] = lb != NULL && ub != NULL ? ub[d] - lb[d] : 1.0;
+	}
+
+	switch (kind)
+	{
+	case gmf_sampling_sobol:
+		gmf_sobol_init(sampler);
+		if (npoints == 0 || npoints > (uint64_t) 1 << 32)
+		{
+			sampler->npoints = (uint64_t) 1 << 32;
+		}
+		for (d = 0; d < dim && rng != NULL; ++d)
+		{
+			sampler->shift[d] = (uint32_t) (gmf_rng_next(rng) >> 32);
+		}
+		break;
+	case gmf_sampling_halton:
+		for (d = 0; d < dim && rng != NULL; ++d)
+		{
+			sampler->rotation[d] = gmf_rng_uniform(rng);
+		}
+		break;
+	case gmf_sampling_lhs:
+		if (npoints == 0)
+		{
+			return 0;
+		}
+		for (bits = 1; bits < 64 && ((uint64_t) 1 << bits) < npoints; ++bits)
+			;
+		sampler->half_bits = (bits + 1) / 2;
+		for (d = 0; d < dim; ++d)
+		{
+			for (r = 0; r < 4; ++r)
+			{
+				sampler->keys[d][r] = rng != NULL ? gmf_rng_next(rng) :
+						gmf_mix(4 * d + r + 1);
+			}
+		}
+		break;
+	case gmf_sampling_das_dennis:
+		if (npoints == 0)
+		{
+			return 0;
+		}
+		sampler->divisions = npoints;
+		sampler->npoints = gmf_das_dennis_count(dim, npoints);
+		sampler->counts[0] = npoints;
+		break;
+	default:
+		return 0;
+	}
+	return 1;
+}
+
+/**
+ * Same as gmf_sampler_init, in the decision space of a problem
+ */
+int gmf_sampler_init_mop(gmf_sampler *sampler, int kind,
+		const struct gmf_mop_desc *mop, uint64_t npoints, gmf_rng *rng)
+{
+	return gmf_sampler_init(sampler, kind, mop->nreal, mop->xmin_real,
+			mop->xmax_real, npoints, rng);
+}
+
+/**
+ * Writes up to n next points, one per row of X (ldx >= dim). Returns the
+ * number of points written, less than n once a finite design is exhausted.
+ */
+size_t gmf_sampler_fill(gmf_sampler *sampler, size_t n, double *X, size_t ldx)
+{
+	size_t i, d;
+	double *x;
+
+	for (i = 0; i < n; ++i)
+	{
+		if (sampler->npoints > 0 && sampler->index >= sampler->npoints)
+		{
+			break;
+		}
+		x = X + i * ldx;
+		switch (sampler->kind)
+		{
+		case gmf_sampling_sobol:
+			gmf_sobol_next(sampler, x);
+			break;
+		case gmf_sampling_halton:
+			gmf_halton_next(sampler, x);
+			break;
+		case gmf_sampling_lhs:
+			gmf_lhs_next(sampler, x);
+			break;
+		default:
+			gmf_das_dennis_next(sampler, x);
+			break;
+		}
+		for (d = 0; d < sampler->dim; ++d)
+		{
+			x[d] = sampler->lb[d] + x[d] * sampler->width[d];
+		}
+		sampler->index++;
+	}
+	return i;
+}
@@ -0,0 +1,75 @@
+/*
+ * gmf_sampling.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+#ifndef GMF_SAMPLING_H_
+#define GMF_SAMPLING_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "gmf_rng.h"
+
+struct gmf_mop_desc;
+
+/* Largest dimension supported by the samplers (Sobol direction numbers) */
+#define GMF_SAMPLER_MAXDIM 21
+
+/* Sampler kinds */
+#define gmf_sampling_sobol 0
+#define gmf_sampling_halton 1
+#define gmf_sampling_lhs 2
+#define gmf_sampling_das_dennis 3
+
+/*
+ * Streaming sampler: every call of gmf_sampler_fill continues where the
+ * previous one stopped, so a population of any size can be produced in
+ * chunks that fit in memory. Points are mapped into [lb, ub].
+ *
+ *  - Sobol: Joe & Kuo (2008) direction numbers, Gray-code order. With a rng
+ *    the sequence gets a random digital shift.
+ *  - Halton: radical inverses in the first dim primes. With a rng the
+ *    sequence gets a random Cranley-Patterson rotation.
+ *  - Latin hypercube of exactly npoints points. Stratum of point i in
+ *    dimension j is a keyed pseudo-random permutation of i, so no
+ *    permutation table is stored. The rng draws the keys and the position
+ *    inside each stratum; without one the points are stratum centers and
+ *    fixed keys are used.
+ *  - Das & Dennis (1998) simplex lattice: all points with coordinates
+ *    k / divisions summing to one (weight vectors), in lexicographic order.
+ *    Mapped into [lb, ub] coordinate-wise.
+ *
+ * Finite designs (LHS, Das-Dennis) stop after their last point.
+ */
+typedef struct gmf_sampler
+{
+	int kind;
+	size_t dim;
+	uint64_t index; /* next point */
+	uint64_t npoints; /* 0: unbounded */
+	double lb[GMF_SAMPLER_MAXDIM];
+	double width[GMF_SAMPLER_MAXDIM];
+	gmf_rng *rng;
+
+	/* Sobol */
+	uint32_t v[GMF_SAMPLER_MAXDIM][32];
+	uint32_t x[GMF_SAMPLER_MAXDIM];
+	uint32_t shift[GMF_SAMPLER_MAXDIM];
+	/* Halton */
+	double rotation[GMF_SAMPLER_MAXDIM];
+	/* LHS */
+	uint64_t keys[GMF_SAMPLER_MAXDIM][4];
+	int half_bits;
+	/* Das-Dennis */
+	size_t divisions;
+	size_t counts[GMF_SAMPLER_MAXDIM];
+} gmf_sampler;
+
+int gmf_sampler_init(gmf_sampler *sampler, int kind, size_t dim,
+		const double *lb, const double *ub, uint64_t npoints, gmf_rng *rng);
+int gmf_sampler_init_mop(gmf_sampler *sampler, int kind,
+		const struct gmf_mop_desc *mop, uint64_t npoints, gmf_rng *rng);
+size_t gmf_sampler_fill(gmf_sampler *sampler, size_t n, double *X, size_t ldx);
+uint64_t gmf_das_dennis_count(size_t dim, size_t divisions);
+
+#endif /* GMF_SAMPLING_H_ */
@@ -0,0 +1,737 @@
+/*
+ * gmf_server.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#include "gmf_global.h"
+#include "gmf_dv_rwa.h"
+#include "gmf_server.h"
+
+#define GMF_SERVER_MAGIC 0x5257414d46474d53ULL
+#define GMF_SERVER_VERSION 1
+#define GMF_CLIENT_SPIN 64
+
+enum
+{
+	gmf_slot_free, gmf_slot_claimed, gmf_slot_submitted, gmf_slot_done
+};
+
+/**
+ * Control block of a slot, one cache line
+ */
+struct gmf_shm_slot
+{
+	_Alignas(64) atomic_uint state; /* futex word */
+	int function;
+	unsigned n;
+	int status;
+	atomic_int owner; /* pid, 0 while a client is taking the slot */
+};
+
+/**
+ * Cell of the submission queue (bounded MPMC queue with a sequence number
+ * per cell, D. Vyukov)
+ */
+struct gmf_shm_cell
+{
+	atomic_ullong sequence;
+	unsigned long long slot;
+};
+
+/**
+ * Header of the shared memory object, followed by the queue cells, the
+ * slot control blocks and the slot data (page aligned)
+ */
+struct gmf_shm
+{
+	unsigned long long magic;
+	unsigned version;
+	pid_t server;
+	size_t nslots;
+	size_t points;
+	size_t mask; /* queue cells - 1 */
+	size_t cells; /* offsets in bytes */
+	size_t slots;
+	size_t data;
+	size_t stride; /* bytes of data per slot */
+	size_t size;
+	atomic_uint running;
+	_Alignas(64) atomic_ullong head; /* next push */
+	_Alignas(64) atomic_ullong tail; /* next pop */
+	_Alignas(64) atomic_uint work; /* futex word: submissions */
+	atomic_uint idle; /* workers asleep on work */
+	_Alignas(64) atomic_uint freed; /* futex word: releases */
+	atomic_uint starved; /* clients asleep on freed */
+	_Alignas(64) atomic_ullong evaluations[10];
+};
+
+struct gmf_server
+{
+	struct gmf_shm *shm;
+	char name[255];
+	int nworkers;
+	pthread_t *workers;
+	atomic_int stop;
+};
+
+struct gmf_client
+{
+	struct gmf_shm *shm;
+	size_t hint; /* where the search for a free slot starts */
+	pid_t pid;
+};
+
+/** **************************************************************************
+ ** Shared memory
+ ** **************************************************************************/
+static void gmf_futex_wait(atomic_uint *word, unsigned value, long ns)
+{
+	struct timespec timeout = { 0, ns };
+	syscall(SYS_futex, word, FUTEX_WAIT, value, &timeout, NULL, 0);
+	return;
+}
+
+static void gmf_futex_wake(atomic_uint *word, int count)
+{
+	syscall(SYS_futex, word, FUTEX_WAKE, count, NULL, NULL, 0);
+	return;
+}
+
+static struct gmf_shm_cell *gmf_shm_cells(struct gmf_shm *shm)
+{
+	return (struct gmf_shm_cell *) ((char *) shm + shm->cells);
+}
+
+static struct gmf_shm_slot *gmf_shm_slot(struct gmf_shm *shm, size_t id)
+{
+	return (struct gmf_shm_slot *) ((char *) shm + shm->slots) + id;
+}
+
+/**
+ * X of slot id (points x GMF_SERVER_MAXREAL values), F follows
+ */
+static double *gmf_shm_data(struct gmf_shm *shm, size_t id)
+{
+	return (double *) ((char *) shm + shm->data + id * shm->stride);
+}
+
+static int gmf_shm_alive(pid_t pid)
+{
+	return kill(pid, 0) == 0 || errno != ESRCH;
+}
+
+static int gmf_queue_push(struct gmf_shm *shm, unsigned long long slot)
+{
+	struct gmf_shm_cell *cell;
+	unsigned long long pos = atomic_load(&shm->head), seq;
+
+	for (;;)
+	{
+		cell = &gmf_shm_cells(shm)[pos & shm->mask];
+		seq = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+		if (seq == pos)
+		{
+			if (atomic_compare_exchange_weak(&shm->head, &pos, pos + 1))
+			{
+				break;
+			}
+		}
+		else if (seq < pos)
+		{
+			return 0;
+		}
+		else
+		{
+			pos = atomic_load(&shm->head);
+		}
+	}
+	cell->slot = slot;
+	atomic_store_explicit(&cell->sequence, pos + 1, memory_order_release);
+	return 1;
+}
+
+static int gmf_queue_pop(struct gmf_shm *shm, unsigned long long *slot)
+{
+	struct gmf_shm_cell *cell;
+	unsigned long long pos = atomic_load(&shm->tail), seq;
+
+	for (;;)
+	{
+		cell = &gmf_shm_cells(shm)[pos & shm->mask];
+		seq = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+		if (seq == pos + 1)
+		{
+			if (atomic_compare_exchange_weak(&shm->tail, &pos, pos + 1))
+			{
+				break;
+			}
+		}
+		else if (seq < pos + 1)
+		{
+			return 0;
+		}
+		else
+		{
+			pos = atomic_load(&shm->tail);
+		}
+	}
+	*slot = cell->slot;
+	atomic_store_explicit(&cell->sequence, pos + shm->mask + 1,
+			memory_order_release);
+	return 1;
+}
+
+/**
+ * Maps the object of the given name and checks its header, NULL if it is
+ * not a server's
+ */
+static struct gmf_shm *gmf_shm_map(const char *name)
+{
+	struct gmf_shm *shm;
+	struct stat st;
+	int fd = shm_open(name, O_RDWR, 0);
+
+	if (fd < 0)
+	{
+		return NULL;
+	}
+	if (fstat(fd, &st) < 0 || (size_t) st.st_size < sizeof(struct gmf_shm))
+	{
+		close(fd);
+		return NULL;
+	}
+	shm = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (shm == MAP_FAILED)
+	{
+		return NULL;
+	}
+	if (shm->magic != GMF_SERVER_MAGIC || shm->version != GMF_SERVER_VERSION
+			|| shm->size != (size_t) st.st_size)
+	{
+		munmap(shm, st.st_size);
+		return NULL;
+	}
+	return shm;
+}
+
+/** **************************************************************************
+ ** Server
+ ** **************************************************************************/
+static void gmf_server_serve(struct gmf_shm *shm, size_t id)
+{
+	struct gmf_shm_slot *slot = gmf_shm_slot(shm, id);
+	/* clients can write the slot: read the request once, use only the copy */
+	int function = *(volatile int *) &slot->function;
+	size_t n = *(volatile unsigned *) &slot->n;
+	const struct gmf_rwa_entry *entry = gmf_rwa_registry(function);
+	double *X = gmf_shm_data(shm, id);
+	int status;
+
+	status = entry != NULL && n <= shm->points
+			&& gmf_rwa_evaluate(function, n, X, entry->nreal,
+					X + shm->points * GMF_SERVER_MAXREAL, entry->nobjs,
+					gmf_row_major);
+	if (status)
+	{
+		atomic_fetch_add(&shm->evaluations[function], n);
+	}
+	slot->status = status;
+	atomic_store_explicit(&slot->state, gmf_slot_done, memory_order_release);
+	gmf_futex_wake(&slot->state, INT_MAX);
+	return;
+}
+
+static void *gmf_server_worker(void *arg)
+{
+	struct gmf_shm *shm = arg;
+	unsigned long long id;
+	unsigned seen;
+
+	while (atomic_load(&shm->running))
+	{
+		if (gmf_queue_pop(shm, &id))
+		{
+			gmf_server_serve(shm, id);
+			continue;
+		}
+		atomic_fetch_add(&shm->idle, 1);
+		seen = atomic_load(&shm->work);
+		if (gmf_queue_pop(shm, &id))
+		{
+			atomic_fetch_sub(&shm->idle, 1);
+			gmf_server_serve(shm, id);
+			continue;
+		}
+		gmf_futex_wait(&shm->work, seen, GMF_SERVER_TIMEOUT);
+		atomic_fetch_sub(&shm->idle, 1);
+	}
+	return NULL;
+}
+
+/**
+ * Frees the slots held by clients that died
+ */
+static void gmf_server_reap(struct gmf_shm *shm)
+{
+	struct gmf_shm_slot *slot;
+	unsigned state;
+	pid_t owner;
+	size_t id;
+
+	for (id = 0; id < shm->nslots; ++id)
+	{
+		slot = gmf_shm_slot(shm, id);
+		state = atomic_load(&slot->state);
+		owner = atomic_load(&slot->owner);
+
+		/* only the owner moves a claimed or evaluated slot on */
+		if ((state == gmf_slot_claimed || state == gmf_slot_done)
+				&& owner != 0 && !gmf_shm_alive(owner))
+		{
+			atomic_store(&slot->owner, 0);
+			atomic_store(&slot->state, gmf_slot_free);
+			atomic_fetch_add(&shm->freed, 1);
+			gmf_futex_wake(&shm->freed, 1);
+		}
+	}
+	return;
+}
+
+/**
+ * Creates the shared memory object (replacing one left by a server that
+ * died) and starts nworkers worker threads (0 for one per CPU), pinned
+ * round-robin to the CPUs. NULL if a server of that name is running.
+ */
+gmf_server *gmf_server_create(const char *name, size_t nslots, size_t points,
+		int nworkers)
+{
+	gmf_server *server;
+	struct gmf_shm *shm, *old;
+	size_t cells = 1, offset, stride, size, i;
+	cpu_set_t cpus;
+	int fd, ncpus = (int) sysconf(_SC_NPROCESSORS_ONLN);
+
+	name = name != NULL ? name : GMF_SERVER_NAME;
+	nslots = nslots > 0 ? nslots : GMF_SERVER_SLOTS;
+	points = points > 0 ? points : GMF_SERVER_POINTS;
+	ncpus = ncpus > 0 ? ncpus : 1;
+	nworkers = nworkers > 0 ? nworkers : ncpus;
+	while (cells < nslots)
+	{
+		cells *= 2;
+	}
+	offset = (sizeof(struct gmf_shm) + 63) & ~(size_t) 63;
+	stride = (points * (GMF_SERVER_MAXREAL + GMF_SERVER_MAXOBJS)
+			* sizeof(double) + 4095) & ~(size_t) 4095;
+	size = offset + cells * sizeof(struct gmf_shm_cell)
+			+ nslots * sizeof(struct gmf_shm_slot);
+	size = (size + 4095) & ~(size_t) 4095;
+	size += nslots * stride;
+
+	old = gmf_shm_map(name);
+	if (old != NULL)
+	{
+		if (atomic_load(&old->running) && gmf_shm_alive(old->server))
+		{
+			munmap(old, old->size);
+			return NULL;
+		}
+		munmap(old, old->size);
+		shm_unlink(name);
+	}
+	fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+	if (fd < 0)
+	{
+		return NULL;
+	}
+	if (ftruncate(fd, size) < 0)
+	{
+		close(fd);
+		shm_unlink(name);
+		return NULL;
+	}
+	shm = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	server = calloc(1, sizeof(gmf_server));
+	if (shm == MAP_FAILED || server == NULL)
+	{
+		if (shm != MAP_FAILED)
+		{
+			munmap(shm, size);
+		}
+		free(server);
+		shm_unlink(name);
+		return NULL;
+	}
+
+	/* the object is zero-filled: slots free, counters 0 */
+	shm->version = GMF_SERVER_VERSION;
+	shm->server = getpid();
+	shm->nslots = nslots;
+	shm->points = points;
+	shm->mask = cells - 1;
+	shm->cells = offset;
+	shm->slots = offset + cells * sizeof(struct gmf_shm_cell);
+	shm->data = size - nslots * stride;
+	shm->stride = stride;
+	shm->size = size;
+	for (i = 0; i < cells; ++i)
+	{
+		atomic_init(&gmf_shm_cells(shm)[i].sequence, i);
+	}
+	atomic_store(&shm->running, 1);
+
+	server->shm = shm;
+	snprintf(server->name, sizeof(server->name), "%s", name);
+	server->workers = malloc(sizeof(pthread_t) * nworkers);
+	for (i = 0; server->workers != NULL && i < (size_t) nworkers; ++i)
+	{
+		if (pthread_create(&server->workers[i], NULL, gmf_server_worker, shm)
+				!= 0)
+		{
+			break;
+		}
+		CPU_ZERO(&cpus);
+		CPU_SET(i % ncpus, &cpus);
+		pthread_setaffinity_np(server->workers[i], sizeof(cpus), &cpus);
+	}
+	server->nworkers = (int) i;
+	if (server->nworkers == 0)
+	{
+		gmf_server_destroy(server);
+		return NULL;
+	}
+
+	/* published last: clients check the magic number */
+	atomic_thread_fence(memory_order_release);
+	shm->magic = GMF_SERVER_MAGIC;
+	return server;
+}
+
+/**
+ * Serves until gmf_server_stop, freeing the slots of dead clients. Returns 1.
+ */
+int gmf_server_run(gmf_server *server)
+{
+	struct timespec pause = { 0, GMF_SERVER_TIMEOUT };
+
+	while (!atomic_load(&server->stop))
+	{
+		nanosleep(&pause, NULL);
+		gmf_server_reap(server->shm);
+	}
+	return 1;
+}
+
+void gmf_server_stop(gmf_server *server)
+{
+	atomic_store(&server->stop, 1);
+	return;
+}
+
+/**
+ * Stops the workers, wakes every waiting client and removes the object
+ */
+void gmf_server_destroy(gmf_server *server)
+{
+	struct gmf_shm *shm = server->shm;
+	size_t id;
+	int i;
+
+	atomic_store(&shm->running, 0);
+	gmf_futex_wake(&shm->work, INT_MAX);
+	for (i = 0; i < server->nworkers; ++i)
+	{
+		pthread_join(server->workers[i], NULL);
+	}
+	for (id = 0; id < shm->nslots; ++id)
+	{
+		gmf_futex_wake(&gmf_shm_slot(shm, id)->state, INT_MAX);
+	}
+	gmf_futex_wake(&shm->freed, INT_MAX);
+	shm_unlink(server->name);
+	munmap(shm, shm->size);
+	free(server->workers);
+	free(server);
+	return;
+}
+
+size_t gmf_server_evaluations(const gmf_server *server, int function)
+{
+	if (function < 0 || function >= 10)
+	{
+		return 0;
+	}
+	return atomic_load(&server->shm->evaluations[function]);
+}
+
+/** **************************************************************************
+ ** Client
+ ** **************************************************************************/
+static int gmf_client_online(const gmf_client *client)
+{
+	return atomic_load(&client->shm->running)
+			&& gmf_shm_alive(client->shm->server);
+}
+
+gmf_client *gmf_client_connect(const char *name)
+{
+	gmf_client *client;
+	struct gmf_shm *shm = gmf_shm_map(name != NULL ? name : GMF_SERVER_NAME);
+
+	if (shm == NULL)
+	{
+		return NULL;
+	}
+	client = malloc(sizeof(gmf_client));
+	if (client == NULL)
+	{
+		munmap(shm, shm->size);
+		return NULL;
+	}
+	client->shm = shm;
+	client->pid = getpid();
+	client->hint = (size_t) client->pid % shm->nslots;
+	return client;
+}
+
+void gmf_client_disconnect(gmf_client *client)
+{
+	if (client == NULL)
+	{
+		return;
+	}
+	munmap(client->shm, client->shm->size);
+	free(client);
+	return;
+}
+
+/**
+ * Points per slot, the largest batch of gmf_client_submit
+ */
+size_t gmf_client_capacity(const gmf_client *client)
+{
+	return client->shm->points;
+}
+
+/**
+ * Takes a free slot for problem `function`, waiting for one if need be.
+ * *X gets its points, rows of nreal values to fill. Returns the slot.
+ */
+int gmf_client_acquire(gmf_client *client, int function, double **X)
+{
+	struct gmf_shm *shm = client->shm;
+	struct gmf_shm_slot *slot;
+	unsigned state, seen;
+	size_t i, id;
+
+	if (gmf_rwa_registry(function) == NULL)
+	{
+		return -1;
+	}
+	for (;;)
+	{
+		seen = atomic_load(&shm->freed);
+		for (i = 0; i < shm->nslots; ++i)
+		{
+			id = (client->hint + i) % shm->nslots;
+			slot = gmf_shm_slot(shm, id);
+			state = gmf_slot_free;
+			if (atomic_load_explicit(&slot->state, memory_order_relaxed)
+					== gmf_slot_free && atomic_compare_exchange_strong(
+					&slot->state, &state, gmf_slot_claimed))
+			{
+				atomic_store(&slot->owner, client->pid);
+				slot->function = function;
+				client->hint = id + 1;
+				*X = gmf_shm_data(shm, id);
+				return (int) id;
+			}
+		}
+		if (!gmf_client_online(client))
+		{
+			return -1;
+		}
+		atomic_fetch_add(&shm->starved, 1);
+		gmf_futex_wait(&shm->freed, seen, GMF_SERVER_TIMEOUT);
+		atomic_fetch_sub(&shm->starved, 1);
+	}
+}
+
+/**
+ * Queues the first n points of the slot for evaluation
+ */
+int gmf_client_submit(gmf_client *client, int slot, size_t n)
+{
+	struct gmf_shm *shm = client->shm;
+	struct gmf_shm_slot *control = gmf_shm_slot(shm, slot);
+
+	if (n > shm->points)
+	{
+		return 0;
+	}
+	control->n = (unsigned) n;
+	atomic_store_explicit(&control->state, gmf_slot_submitted,
+			memory_order_release);
+	if (!gmf_queue_push(shm, slot))
+	{
+		atomic_store(&control->state, gmf_slot_claimed);
+		return 0;
+	}
+	atomic_fetch_add(&shm->work, 1);
+	if (atomic_load(&shm->idle) > 0)
+	{
+		gmf_futex_wake(&shm->work, 1);
+	}
+	return 1;
+}
+
+/**
+ * Waits for a submitted slot. Returns its objectives, rows of nobjs values,
+ * NULL if the evaluation failed or the server is gone.
+ */
+const double *gmf_client_wait(gmf_client *client, int slot)
+{
+	struct gmf_shm *shm = client->shm;
+	struct gmf_shm_slot *control = gmf_shm_slot(shm, slot);
+	int spin;
+
+	for (spin = 0; spin < GMF_CLIENT_SPIN; ++spin)
+	{
+		if (atomic_load_explicit(&control->state, memory_order_acquire)
+				== gmf_slot_done)
+		{
+			break;
+		}
+	}
+	while (atomic_load_explicit(&control->state, memory_order_acquire)
+			!= gmf_slot_done)
+	{
+		if (!gmf_client_online(client))
+		{
+			return NULL;
+		}
+		gmf_futex_wait(&control->state, gmf_slot_submitted,
+				GMF_SERVER_TIMEOUT);
+	}
+	if (!control->status)
+	{
+		return NULL;
+	}
+	return gmf_shm_data(shm, slot) + shm->points * GMF_SERVER_MAXREAL;
+}
+
+void gmf_client_release(gmf_client *client, int slot)
+{
+	struct gmf_shm *shm = client->shm;
+
+	atomic_store(&gmf_shm_slot(shm, slot)->owner, 0);
+	atomic_store(&gmf_shm_slot(shm, slot)->state, gmf_slot_free);
+	atomic_fetch_add(&shm->freed, 1);
+	if (atomic_load(&shm->starved) > 0)
+	{
+		gmf_futex_wake(&shm->freed, 1);
+	}
+	return;
+}
+
+/**
+ * Evaluates n row-major points of problem `function` on the server, as
+ * gmf_rwa_evaluate, in slot-sized pieces with up to GMF_CLIENT_INFLIGHT of
+ * them queued at once
+ */
+int gmf_client_evaluate(gmf_client *client, int function, size_t n,
+		const double *X, size_t ldx, double *F, size_t ldf)
+{
+	const struct gmf_rwa_entry *entry = gmf_rwa_registry(function);
+	int slot[GMF_CLIENT_INFLIGHT];
+	size_t first[GMF_CLIENT_INFLIGHT], count[GMF_CLIENT_INFLIGHT];
+	size_t next = 0, head = 0, inflight = 0, i, k, m;
+	const double *R;
+	double *S;
+	int ok = 1;
+
+	if (entry == NULL)
+	{
+		return 0;
+	}
+	while (ok && (next < n || inflight > 0))
+	{
+		/* fill the pipeline */
+		while (ok && next < n && inflight < GMF_CLIENT_INFLIGHT)
+		{
+			k = (head + inflight) % GMF_CLIENT_INFLIGHT;
+			slot[k] = gmf_client_acquire(client, function, &S);
+			if (slot[k] < 0)
+			{
+				ok = 0;
+				break;
+			}
+			m = n - next < client->shm->points ? n - next : client->shm->points;
+			for (i = 0; i < m; ++i)
+			{
+				memcpy(S + i * entry->nreal, X + (next + i) * ldx,
+						sizeof(double) * entry->nreal);
+			}
+			first[k] = next;
+			count[k] = m;
+			++inflight;
+			next += m;
+			if (!gmf_client_submit(client, slot[k], m))
+			{
+				ok = 0;
+			}
+		}
+		if (inflight == 0)
+		{
+			break;
+		}
+
+		/* drain the oldest */
+		R = ok ? gmf_client_wait(client, slot[head]) : NULL;
+		for (i = 0; R != NULL && i < count[head]; ++i)
+		{
+			memcpy(F + (first[head] + i) * ldf, R + i * entry->nobjs,
+					sizeof(double) * entry->nobjs);
+		}
+		ok = ok && R != NULL;
+		if (!ok)
+		{
+			/* settle every slot in flight before giving them back */
+			for (i = 0; i < inflight; ++i)
+			{
+				k = (head + i) % GMF_CLIENT_INFLIGHT;
+				if (atomic_load(&gmf_shm_slot(client->shm, slot[k])->state)
+						== gmf_slot_submitted)
+				{
+					gmf_client_wait(client, slot[k]);
+				}
+				gmf_client_release(client, slot[k]);
+			}
+			break;
+		}
+		gmf_client_release(client, slot[head]);
+		head = (head + 1) % GMF_CLIENT_INFLIGHT;
+		--inflight;
+	}
+	return ok;
+}
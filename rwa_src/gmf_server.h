@@ -0,0 +1,66 @@
+/*
+ * gmf_server.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+#ifndef GMF_SERVER_H_
+#define GMF_SERVER_H_
+
+#include <stddef.h>
+
+/*
+ * Shared-memory evaluation server for many optimizer processes on one
+ * machine (Linux). The server (tools/gmf_evald) creates a POSIX shared
+ * memory object holding a pool of slots, each with room for the points X
+ * and objectives F of up to `points` evaluations, and a bounded lock-free
+ * MPMC queue of submitted slots. Pinned worker threads take slots from
+ * the queue and evaluate them with gmf_rwa_evaluate, so the evaluator's
+ * code, tables and threads stay warm for every client; clients pay no
+ * serialization and no socket, only the copy into and out of a slot (none
+ * through gmf_client_acquire, which hands out the slot's X directly).
+ *
+ * A slot goes FREE -> CLAIMED (a client took it by compare-and-swap) ->
+ * SUBMITTED (queued) -> DONE (evaluated) -> FREE. The state of a slot is a
+ * futex word the client sleeps on until DONE; idle workers sleep on a
+ * counter of submissions, and clients with no free slot on a counter of
+ * releases, each woken only when someone sleeps on it. Waits time out
+ * every GMF_SERVER_TIMEOUT nanoseconds to notice a server that is gone;
+ * the server frees the slots of clients that died holding them.
+ *
+ * gmf_server_run serves until gmf_server_stop (async-signal-safe) and
+ * gmf_server_destroy removes the shared memory object. Clients connect by
+ * name (GMF_SERVER_NAME if NULL) and evaluate row-major batches with
+ * gmf_client_evaluate, which keeps up to GMF_CLIENT_INFLIGHT slots in
+ * flight so that the workers share a large batch; results are those of
+ * gmf_rwa_evaluate in the server. The functions return 0 (NULL, or -1 for
+ * a slot) if the server is gone or the request is invalid.
+ */
+#define GMF_SERVER_NAME "/gmf_rwa"
+#define GMF_SERVER_SLOTS 64
+#define GMF_SERVER_POINTS 4096
+#define GMF_SERVER_MAXREAL 12 /* room per point, at least the registry's */
+#define GMF_SERVER_MAXOBJS 8
+#define GMF_SERVER_TIMEOUT 100000000L
+#define GMF_CLIENT_INFLIGHT 4
+
+typedef struct gmf_server gmf_server;
+typedef struct gmf_client gmf_client;
+
+gmf_server *gmf_server_create(const char *name, size_t nslots, size_t points,
+		int nworkers);
+int gmf_server_run(gmf_server *server);
+void gmf_server_stop(gmf_server *server);
+void gmf_server_destroy(gmf_server *server);
+size_t gmf_server_evaluations(const gmf_server *server, int function);
+
+gmf_client *gmf_client_connect(const char *name);
+void gmf_client_disconnect(gmf_client *client);
+size_t gmf_client_capacity(const gmf_client *client);
+int gmf_client_acquire(gmf_client *client, int function, double **X);
+int gmf_client_submit(gmf_client *client, int slot, size_t n);
+const double *gmf_client_wait(gmf_client *client, int slot);
+void gmf_client_release(gmf_client *client, int slot);
+int gmf_client_evaluate(gmf_client *client, int function, size_t n,
+		const double *X, size_t ldx, double *F, size_t ldf);
+
+#endif /* GMF_SERVER_H_ */
@@ -0,0 +1,382 @@
+/*
+ * gmf_stats.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <time.h>
+
+#include "gmf_global.h"
+#include "gmf_dv_rwa.h"
+#include "gmf_stats.h"
+
+#ifdef GMF_STATS
+#include <pthread.h>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define GMF_STATS_TSC
+#endif
+
+/**
+ * Counters of one thread, written only by their owner
+ */
+struct gmf_stats_block
+{
+	_Atomic uint64_t evaluations[GMF_STATS_PROBLEMS];
+	_Atomic uint64_t calls[GMF_STATS_PROBLEMS];
+	_Atomic uint64_t ticks[GMF_STATS_PROBLEMS];
+	_Atomic uint64_t histogram[GMF_STATS_PROBLEMS][GMF_STATS_BUCKETS];
+	struct gmf_stats_block *next;
+};
+
+static pthread_mutex_t stats_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t stats_once = PTHREAD_ONCE_INIT;
+static pthread_key_t stats_key;
+static struct gmf_stats_block *stats_blocks; /* live threads */
+static struct gmf_stats_block stats_retired; /* exited threads */
+static struct gmf_stats_entry stats_baseline[GMF_STATS_PROBLEMS];
+static _Thread_local struct gmf_stats_block *stats_self;
+static atomic_int stats_timing;
+
+static void gmf_stats_add(uint64_t *total, _Atomic uint64_t *counter)
+{
+	*total += atomic_load_explicit(counter, memory_order_relaxed);
+	return;
+}
+
+static void gmf_stats_bump(_Atomic uint64_t *counter, uint64_t value)
+{
+	atomic_store_explicit(counter,
+			atomic_load_explicit(counter, memory_order_relaxed) + value,
+			memory_order_relaxed);
+	return;
+}
+
+/**
+ * Thread exit: moves the thread's counts to the retired block
+ */
+static void gmf_stats_retire(void *arg)
+{
+	struct gmf_stats_block *block = arg, **link;
+	int f, b;
+
+	pthread_mutex_lock(&stats_lock);
+	for (link = &stats_blocks; *link != block; link = &(*link)->next)
+	{
+	}
+	*link = block->next;
+	for (f = 0; f < GMF_STATS_PROBLEMS; ++f)
+	{
+		gmf_stats_bump(&stats_retired.evaluations[f],
+				atomic_load(&block->evaluations[f]));
+		gmf_stats_bump(&stats_retired.calls[f], atomic_load(&block->calls[f]));
+		gmf_stats_bump(&stats_retired.ticks[f], atomic_load(&block->ticks[f]));
+		for (b = 0; b < GMF_STATS_BUCKETS; ++b)
+		{
+			gmf_stats_bump(&stats_retired.histogram[f][b],
+					atomic_load(&block->histogram[f][b]));
+		}
+	}
+	pthread_mutex_unlock(&stats_lock);
+	free(block);
+	return;
+}
+
+static void gmf_stats_init()
+{
+	pthread_key_create(&stats_key, gmf_stats_retire);
+	return;
+}
+
+static struct gmf_stats_block *gmf_stats_register()
+{
+	struct gmf_stats_block *block;
+
+	pthread_once(&stats_once, gmf_stats_init);
+	block = aligned_alloc(64,
+			(sizeof(struct gmf_stats_block) + 63) / 64 * 64);
+	if (block == NULL)
+	{
+		return NULL;
+	}
+	memset(block, 0, sizeof(struct gmf_stats_block));
+	pthread_mutex_lock(&stats_lock);
+	block->next = stats_blocks;
+	stats_blocks = block;
+	pthread_mutex_unlock(&stats_lock);
+	pthread_setspecific(stats_key, block);
+	stats_self = block;
+	return block;
+}
+
+static uint64_t gmf_stats_clock()
+{
+#ifdef GMF_STATS_TSC
+	return __rdtsc();
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * 1000000000u + ts.tv_nsec;
+#endif
+}
+
+/**
+ * Start of a call: its time stamp, or 0 with timing off
+ */
+uint64_t gmf_stats_begin()
+{
+	if (!atomic_load_explicit(&stats_timing, memory_order_relaxed))
+	{
+		return 0;
+	}
+	return gmf_stats_clock();
+}
+
+/**
+ * End of a call of n evaluations of problem `function`
+ */
+void gmf_stats_record(int function, size_t n, uint64_t start)
+{
+	struct gmf_stats_block *block = stats_self;
+	uint64_t ticks, each;
+	int bucket = 0;
+
+	if (block == NULL && (block = gmf_stats_register()) == NULL)
+	{
+		return;
+	}
+	gmf_stats_bump(&block->evaluations[function], n);
+	gmf_stats_bump(&block->calls[function], 1);
+	if (start == 0 || n == 0)
+	{
+		return;
+	}
+	ticks = gmf_stats_clock() - start;
+	gmf_stats_bump(&block->ticks[function], ticks);
+	each = ticks / n;
+	if (each > 0)
+	{
+		bucket = 63 - __builtin_clzll(each);
+	}
+	gmf_stats_bump(&block->histogram[function][bucket], n);
+	return;
+}
+
+#ifdef GMF_STATS_TSC
+static pthread_once_t stats_rate_once = PTHREAD_ONCE_INIT;
+static double stats_rate;
+
+static void gmf_stats_measure_rate()
+{
+	struct timespec start, now;
+	uint64_t ticks;
+	double seconds;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	ticks = gmf_stats_clock();
+	do
+	{
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		seconds = (now.tv_sec - start.tv_sec)
+				+ 1e-9 * (now.tv_nsec - start.tv_nsec);
+	} while (seconds < 0.02);
+	stats_rate = (gmf_stats_clock() - ticks) / seconds;
+	return;
+}
+#endif
+
+static void gmf_stats_sum(struct gmf_stats_entry *entry,
+		struct gmf_stats_block *block)
+{
+	int f, b;
+	for (f = 0; f < GMF_STATS_PROBLEMS; ++f)
+	{
+		gmf_stats_add(&entry[f].evaluations, &block->evaluations[f]);
+		gmf_stats_add(&entry[f].calls, &block->calls[f]);
+		gmf_stats_add(&entry[f].ticks, &block->ticks[f]);
+		for (b = 0; b < GMF_STATS_BUCKETS; ++b)
+		{
+			gmf_stats_add(&entry[f].histogram[b], &block->histogram[f][b]);
+		}
+	}
+	return;
+}
+
+/**
+ * Totals since the start or the last gmf_stats_reset
+ */
+static void gmf_stats_total(struct gmf_stats_entry *entry)
+{
+	struct gmf_stats_block *block;
+	memset(entry, 0, sizeof(struct gmf_stats_entry) * GMF_STATS_PROBLEMS);
+	gmf_stats_sum(entry, &stats_retired);
+	for (block = stats_blocks; block != NULL; block = block->next)
+	{
+		gmf_stats_sum(entry, block);
+	}
+	return;
+}
+#endif
+
+/**
+ * Whether the statistics are compiled in
+ */
+int gmf_stats_enabled()
+{
+#ifdef GMF_STATS
+	return 1;
+#else
+	return 0;
+#endif
+}
+
+/**
+ * Turns the timing of the calls on or off (off by default)
+ */
+void gmf_stats_set_timing(int on)
+{
+#ifdef GMF_STATS
+	atomic_store(&stats_timing, on != 0);
+#else
+	(void) on;
+#endif
+	return;
+}
+
+int gmf_stats_timing()
+{
+#ifdef GMF_STATS
+	return atomic_load(&stats_timing);
+#else
+	return 0;
+#endif
+}
+
+/**
+ * Ticks per second of the timings, measured against the monotonic clock
+ * once, by the first caller of any thread
+ */
+double gmf_stats_tick_rate()
+{
+#if defined(GMF_STATS) && defined(GMF_STATS_TSC)
+	pthread_once(&stats_rate_once, gmf_stats_measure_rate);
+	return stats_rate;
+#else
+	return 1e9;
+#endif
+}
+
+/**
+ * Copies the statistics of the GMF_STATS_PROBLEMS problems (indexed as in
+ * gmf_rwa_index) into entry. Returns 0 if they are compiled out.
+ */
+int gmf_stats_snapshot(struct gmf_stats_entry *entry)
+{
+#ifdef GMF_STATS
+	int f, b;
+
+	pthread_mutex_lock(&stats_lock);
+	gmf_stats_total(entry);
+	for (f = 0; f < GMF_STATS_PROBLEMS; ++f)
+	{
+		entry[f].evaluations -= stats_baseline[f].evaluations;
+		entry[f].calls -= stats_baseline[f].calls;
+		entry[f].ticks -= stats_baseline[f].ticks;
+		for (b = 0; b < GMF_STATS_BUCKETS; ++b)
+		{
+			entry[f].histogram[b] -= stats_baseline[f].histogram[b];
+		}
+	}
+	pthread_mutex_unlock(&stats_lock);
+	return 1;
+#else
+	memset(entry, 0, sizeof(struct gmf_stats_entry) * GMF_STATS_PROBLEMS);
+	return 0;
+#endif
+}
+
+/**
+ * Starts counting again from zero. The counters themselves are never
+ * written by other threads than their owners: the current totals become
+ * the baseline the snapshots subtract.
+ */
+void gmf_stats_reset()
+{
+#ifdef GMF_STATS
+	pthread_mutex_lock(&stats_lock);
+	gmf_stats_total(stats_baseline);
+	pthread_mutex_unlock(&stats_lock);
+#endif
+	return;
+}
+
+/**
+ * Ticks per evaluation below which a fraction q of the evaluations of the
+ * entry fall, read off the histogram (upper edge of the bucket). Returns
+ * -1 if nothing was timed.
+ */
+double gmf_stats_quantile(const struct gmf_stats_entry *entry, double q)
+{
+	uint64_t total = 0, seen = 0;
+	int b;
+
+	for (b = 0; b < GMF_STATS_BUCKETS; ++b)
+	{
+		total += entry->histogram[b];
+	}
+	if (total == 0)
+	{
+		return -1;
+	}
+	for (b = 0; b < GMF_STATS_BUCKETS - 1; ++b)
+	{
+		seen += entry->histogram[b];
+		if (seen >= q * total)
+		{
+			break;
+		}
+	}
+	return (double) ((uint64_t) 2 << b);
+}
+
+/**
+ * Writes one line per evaluated problem: evaluations, calls, seconds,
+ * nanoseconds per evaluation and the median and 99th percentile latency
+ * bounds in nanoseconds (timing columns are 0 if nothing was timed).
+ * Returns 0 if the statistics are compiled out.
+ */
+int gmf_stats_export(FILE *stream)
+{
+	struct gmf_stats_entry entry[GMF_STATS_PROBLEMS];
+	double rate, seconds, p50, p99;
+	int f;
+
+	if (!gmf_stats_snapshot(entry))
+	{
+		return 0;
+	}
+	rate = gmf_stats_tick_rate();
+	fprintf(stream, "%-18s %14s %12s %10s %10s %10s %10s\n", "problem",
+			"evaluations", "calls", "seconds", "ns/eval", "p50 ns", "p99 ns");
+	for (f = 0; f < GMF_STATS_PROBLEMS; ++f)
+	{
+		if (entry[f].calls == 0)
+		{
+			continue;
+		}
+		seconds = entry[f].ticks / rate;
+		p50 = gmf_stats_quantile(&entry[f], 0.5);
+		p99 = gmf_stats_quantile(&entry[f], 0.99);
+		fprintf(stream, "%-18s %14llu %12llu %10.4f %10.2f %10.1f %10.1f\n",
+				gmf_rwa_name(f), (unsigned long long) entry[f].evaluations,
+				(unsigned long long) entry[f].calls, seconds,
+				entry[f].evaluations > 0 ?
+						1e9 * seconds / entry[f].evaluations : 0.0,
+				p50 > 0 ? 1e9 * p50 / rate : 0.0,
+				p99 > 0 ? 1e9 * p99 / rate : 0.0);
+	}
+	return 1;
+}
@@ -0,0 +1,64 @@
+/*
+ * gmf_stats.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+#ifndef GMF_STATS_H_
+#define GMF_STATS_H_
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Evaluation statistics per problem, compiled in with -DGMF_STATS (on
+ * gmf_dv_rwa.c and gmf_stats.c). Without it the hooks in the evaluation
+ * paths expand to nothing, gmf_stats.c need not be linked, and the
+ * functions below report nothing (gmf_stats_snapshot returns 0).
+ *
+ * Every thread counts into its own block, registered on first use and
+ * folded into a retired block when the thread exits; the owner updates its
+ * counters with plain relaxed stores and gmf_stats_snapshot sums the
+ * blocks with relaxed loads, so counting costs no locked instruction.
+ * Totals are exact once the evaluating threads are quiet.
+ *
+ * Timing is off by default (gmf_stats_set_timing). When on, every call is
+ * timed with the time-stamp counter (clock_gettime where there is none)
+ * and each evaluation of the call goes into the histogram bucket of
+ * floor(log2(ticks per evaluation)), so a batch of n adds n entries at its
+ * average latency. gmf_stats_tick_rate converts ticks to seconds.
+ */
+#define GMF_STATS_PROBLEMS 10
+#define GMF_STATS_BUCKETS 64
+
+struct gmf_stats_entry
+{
+	uint64_t evaluations;
+	uint64_t calls; /* single evaluations and batches */
+	uint64_t ticks; /* timed calls only */
+	uint64_t histogram[GMF_STATS_BUCKETS];
+};
+
+int gmf_stats_enabled();
+void gmf_stats_set_timing(int on);
+int gmf_stats_timing();
+double gmf_stats_tick_rate();
+int gmf_stats_snapshot(struct gmf_stats_entry *entry);
+void gmf_stats_reset();
+double gmf_stats_quantile(const struct gmf_stats_entry *entry, double q);
+int gmf_stats_export(FILE *stream);
+
+uint64_t gmf_stats_begin();
+void gmf_stats_record(int function, size_t n, uint64_t start);
+
+/* Hooks of the evaluation paths */
+#ifdef GMF_STATS
+#define GMF_STATS_BEGIN(start) uint64_t start = gmf_stats_begin()
+#define GMF_STATS_END(function, n, start) \
+	gmf_stats_record(function, n, start)
+#else
+#define GMF_STATS_BEGIN(start)
+#define GMF_STATS_END(function, n, start)
+#endif
+
+#endif /* GMF_STATS_H_ */
@@ -10,6 +10,7 @@
 #include "gmf_dv_rwa.h"
 
 void (*gmf_test_problem)(double *F, double *G, double *xr, int *xi, int *xb);
+struct gmf_mop_desc gmf_mop;
 
 /**
  * Display decision variables and objectives
@@ -37,8 +38,10 @@ void display_solution(double *x, double *f)
 int main()
 {
 	double *x, *f;
+	gmf_rwa_problem *subasi, *ahmad;
+	int i;
 
-	srand(10000);
+	gmf_rnd_seed(10000);
 
 	/* Usage example. Function Subasi2016 */
 	gmf_rwa_setup("Subasi2016");
@@ -68,6 +71,56 @@ int main()
 	free(f);
 	printf("\n");
 
+	/* Usage example. Batch evaluation of Gao2020 (one point per row) */
+	gmf_rwa_setup("Gao2020");
+	printf("Function: Gao2020 (%zu vars. y %zu objs.)\n", gmf_mop.nreal,
+			gmf_mop.nobjs);
+	x = malloc(sizeof(double) * gmf_mop.nreal * 4);
+	f = malloc(sizeof(double) * gmf_mop.nobjs * 4);
+	for (i = 0; i < 4; ++i)
+	{
+		gmf_rwa_rnd_solution(x + i * gmf_mop.nreal);
+	}
+	gmf_rwa_evaluate(gmf_rwa_index("Gao2020"), 4, x, gmf_mop.nreal, f,
+			gmf_mop.nobjs, gmf_row_major);
+	for (i = 0; i < 4; ++i)
+	{
+		display_solution(x + i * gmf_mop.nreal, f + i * gmf_mop.nobjs);
+	}
+	gmf_rwa_setdown();
+	free(x);
+	free(f);
+	printf("\n");
+
+	/* Usage example. Two problems alive at once through handles */
+	subasi = gmf_rwa_create("Subasi2016");
+	ahmad = gmf_rwa_create("Ahmad2017");
+	x = malloc(sizeof(double) * 5);
+	f = malloc(sizeof(double) * 7);
+	for (i = 0; i < 5; ++i)
+	{
+		x[i] = 0.5 * (gmf_rwa_desc(subasi)->xmin_real[i]
+				+ gmf_rwa_desc(subasi)->xmax_real[i]);
+	}
+	gmf_rwa_eval(subasi, f, x);
+	printf("Function: %s (%zu evaluations)\n", gmf_rwa_desc(subasi)->name,
+			gmf_rwa_evaluations(subasi));
+	printf("f: %lf %lf\n", f[0], f[1]);
+	for (i = 0; i < 3; ++i)
+	{
+		x[i] = gmf_rwa_desc(ahmad)->xmin_real[i];
+	}
+	gmf_rwa_eval(ahmad, f, x);
+	printf("Function: %s (%zu evaluations)\n", gmf_rwa_desc(ahmad)->name,
+			gmf_rwa_evaluations(ahmad));
+	printf("f: %lf %lf %lf %lf %lf %lf %lf\n", f[0], f[1], f[2], f[3], f[4],
+			f[5], f[6]);
+	gmf_rwa_destroy(subasi);
+	gmf_rwa_destroy(ahmad);
+	free(x);
+	free(f);
+	printf("\n");
+
 	return 0;
 }
 
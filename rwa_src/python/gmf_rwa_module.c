@@ -0,0 +1,318 @@
+/*
+ * gmf_rwa_module.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Python extension module gmf_rwa: batch evaluation of the RWA problems on
+ * buffers (NumPy arrays, array.array through memoryview.cast, ...) without
+ * copies. evaluate reads the points from X, a C-contiguous float64 buffer
+ * of shape (n, nreal), and writes the objectives into F, a writable
+ * C-contiguous float64 buffer of shape (n, nobjs) allocated by the caller,
+ * with the GIL released; threads > 1 spreads the batch over a pool of
+ * worker threads (0 for one per CPU), kept between calls. F is as
+ * gmf_rwa_evaluate gives it, the maximized objectives negated.
+ *
+ *   import numpy as np, gmf_rwa
+ *   info = gmf_rwa.describe("Gao2020")
+ *   X = np.random.uniform(info["xmin"], info["xmax"],
+ *           (1000000, info["nreal"]))
+ *   F = np.empty((len(X), info["nobjs"]))
+ *   gmf_rwa.evaluate("Gao2020", X, F, threads=0)
+ *
+ * Build in this directory:
+ *
+ *   gcc -O2 -shared -fPIC $(python3-config --includes) -I.. \
+ *       gmf_rwa_module.c ../gmf_parallel.c ../gmf_dv_rwa.c ../gmf_rng.c \
+ *       ../gmf_pof.c ../gmf_parse.c \
+ *       -o gmf_rwa$(python3-config --extension-suffix) -lm -lpthread
+ */
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <pthread.h>
+#include <string.h>
+
+#include "gmf_global.h"
+#include "gmf_dv_rwa.h"
+#include "gmf_parallel.h"
+
+void (*gmf_test_problem)(double *F, double *G, double *xr, int *xi, int *xb);
+struct gmf_mop_desc gmf_mop;
+
+/*
+ * Pool of the threaded evaluations, rebuilt when the number of threads
+ * changes. A pool runs one loop at a time, so calls from several Python
+ * threads take turns on it (with the GIL released).
+ */
+static gmf_pool *py_pool = NULL;
+static pthread_mutex_t py_pool_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * Registry entry of a problem given by name or index, NULL with an
+ * exception set if unknown
+ */
+static const struct gmf_rwa_entry *gmf_py_problem(PyObject *problem)
+{
+	const struct gmf_rwa_entry *entry = NULL;
+	const char *name;
+	long function;
+
+	if (PyUnicode_Check(problem))
+	{
+		name = PyUnicode_AsUTF8(problem);
+		entry = name != NULL ? gmf_rwa_lookup(name) : NULL;
+	}
+	else if (PyLong_Check(problem))
+	{
+		function = PyLong_AsLong(problem);
+		entry = function >= 0 && function <= 9 ? gmf_rwa_registry(
+				(int) function) : NULL;
+	}
+	if (entry == NULL && !PyErr_Occurred())
+	{
+		PyErr_Format(PyExc_ValueError, "unknown problem %R", problem);
+	}
+	return entry;
+}
+
+/**
+ * Native float64 struct format ("d", "@d", "=d", "<d" on little-endian)
+ */
+static int gmf_py_float64(const char *format)
+{
+	if (format == NULL)
+	{
+		return 0;
+	}
+	if (format[0] == '@' || format[0] == '='
+			|| (format[0] == '<' && PY_LITTLE_ENDIAN))
+	{
+		++format;
+	}
+	return strcmp(format, "d") == 0;
+}
+
+/**
+ * A C-contiguous float64 buffer of shape (n, columns), n taken from the
+ * buffer if *n is -1
+ */
+static int gmf_py_matrix(PyObject *object, Py_buffer *view, int writable,
+		Py_ssize_t *n, Py_ssize_t columns, const char *what)
+{
+	int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT
+			| (writable ? PyBUF_WRITABLE : 0);
+
+	if (PyObject_GetBuffer(object, view, flags) < 0)
+	{
+		return 0;
+	}
+	if (view->itemsize != sizeof(double) || !gmf_py_float64(view->format))
+	{
+		PyErr_Format(PyExc_TypeError, "%s must hold float64 values", what);
+	}
+	else if (view->ndim != 2 || view->shape[1] != columns
+			|| (*n >= 0 && view->shape[0] != *n))
+	{
+		PyErr_Format(PyExc_ValueError, "%s must have shape (%zd, %zd)", what,
+				*n >= 0 ? *n : (view->ndim > 0 ? view->shape[0] : 0), columns);
+	}
+	else
+	{
+		*n = view->shape[0];
+		return 1;
+	}
+	PyBuffer_Release(view);
+	return 0;
+}
+
+/**
+ * Evaluates on the pool of nthreads threads, or in the calling thread
+ */
+static int gmf_py_run(gmf_rwa_problem *problem, size_t n, const double *X,
+		size_t nreal, double *F, size_t nobjs, int nthreads)
+{
+	int ok;
+
+	if (nthreads == 1)
+	{
+		return gmf_rwa_eval_batch(problem, n, X, nreal, F, nobjs,
+				gmf_row_major);
+	}
+	pthread_mutex_lock(&py_pool_lock);
+	if (py_pool != NULL && gmf_pool_size(py_pool) != nthreads)
+	{
+		gmf_pool_destroy(py_pool);
+		py_pool = NULL;
+	}
+	if (py_pool == NULL)
+	{
+		py_pool = gmf_pool_create(nthreads);
+	}
+	ok = py_pool != NULL && gmf_rwa_parallel_evaluate(py_pool, problem, n, X,
+			nreal, F, nobjs, gmf_row_major);
+	pthread_mutex_unlock(&py_pool_lock);
+	return ok;
+}
+
+PyDoc_STRVAR(gmf_py_evaluate_doc,
+		"evaluate(problem, X, F, threads=1)\n\n"
+		"Evaluates the rows of X (C-contiguous float64, shape (n, nreal)) into\n"
+		"the rows of F (writable, C-contiguous float64, shape (n, nobjs))\n"
+		"without copies, with the GIL released. problem is a name or an\n"
+		"index; threads 0 uses one thread per CPU. Maximized objectives are\n"
+		"negated. Returns n.");
+
+static PyObject *gmf_py_evaluate(PyObject *self, PyObject *args,
+		PyObject *kwargs)
+{
+	static char *keywords[] = { "problem", "X", "F", "threads", NULL };
+	const struct gmf_rwa_entry *entry;
+	PyObject *problem, *X, *F;
+	gmf_rwa_problem *handle;
+	Py_buffer x, f;
+	Py_ssize_t n = -1;
+	int nthreads = 1, ok;
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO|i", keywords,
+			&problem, &X, &F, &nthreads))
+	{
+		return NULL;
+	}
+	entry = gmf_py_problem(problem);
+	if (entry == NULL)
+	{
+		return NULL;
+	}
+	if (nthreads < 0)
+	{
+		PyErr_SetString(PyExc_ValueError, "threads must be >= 0");
+		return NULL;
+	}
+	nthreads = nthreads == 0 ? gmf_cpu_count() : nthreads;
+	if (!gmf_py_matrix(X, &x, 0, &n, entry->nreal, "X"))
+	{
+		return NULL;
+	}
+	if (!gmf_py_matrix(F, &f, 1, &n, entry->nobjs, "F"))
+	{
+		PyBuffer_Release(&x);
+		return NULL;
+	}
+	if ((char *) f.buf < (char *) x.buf + x.len
+			&& (char *) x.buf < (char *) f.buf + f.len && n > 0)
+	{
+		PyErr_SetString(PyExc_ValueError, "X and F overlap");
+		PyBuffer_Release(&x);
+		PyBuffer_Release(&f);
+		return NULL;
+	}
+
+	handle = gmf_rwa_create((char *) entry->name);
+	ok = handle != NULL;
+	if (ok && n > 0)
+	{
+		Py_BEGIN_ALLOW_THREADS
+		ok = gmf_py_run(handle, (size_t) n, x.buf, entry->nreal, f.buf,
+				entry->nobjs, nthreads);
+		Py_END_ALLOW_THREADS
+	}
+	gmf_rwa_destroy(handle);
+	PyBuffer_Release(&x);
+	PyBuffer_Release(&f);
+	if (!ok)
+	{
+		return PyErr_NoMemory();
+	}
+	return PyLong_FromSsize_t(n);
+}
+
+/**
+ * Tuple of the count values of v (of w if v is NULL), None if both are NULL
+ */
+static PyObject *gmf_py_tuple(const double *v, const int *w, size_t count)
+{
+	PyObject *tuple;
+	size_t i;
+
+	if (v == NULL && w == NULL)
+	{
+		Py_RETURN_NONE;
+	}
+	tuple = PyTuple_New((Py_ssize_t) count);
+	for (i = 0; tuple != NULL && i < count; ++i)
+	{
+		PyTuple_SET_ITEM(tuple, i, v != NULL ? PyFloat_FromDouble(v[i])
+				: PyLong_FromLong(w[i]));
+	}
+	return tuple;
+}
+
+PyDoc_STRVAR(gmf_py_describe_doc,
+		"describe(problem)\n\n"
+		"Registry entry of a problem (name or index) as a dict: name, index,\n"
+		"nreal, nobjs, xmin, xmax, sense (1 minimized, -1 maximized), pof\n"
+		"(reference set file) and ideal, nadir and worst of F.");
+
+static PyObject *gmf_py_describe(PyObject *self, PyObject *problem)
+{
+	const struct gmf_rwa_entry *entry = gmf_py_problem(problem);
+
+	if (entry == NULL)
+	{
+		return NULL;
+	}
+	return Py_BuildValue("{s:s,s:i,s:n,s:n,s:N,s:N,s:N,s:s,s:N,s:N,s:N}",
+			"name", entry->name, "index", entry->function,
+			"nreal", (Py_ssize_t) entry->nreal,
+			"nobjs", (Py_ssize_t) entry->nobjs,
+			"xmin", gmf_py_tuple(entry->xmin, NULL, entry->nreal),
+			"xmax", gmf_py_tuple(entry->xmax, NULL, entry->nreal),
+			"sense", gmf_py_tuple(NULL, entry->sense, entry->nobjs),
+			"pof", entry->pof,
+			"ideal", gmf_py_tuple(entry->ideal, NULL, entry->nobjs),
+			"nadir", gmf_py_tuple(entry->nadir, NULL, entry->nobjs),
+			"worst", gmf_py_tuple(entry->worst, NULL, entry->nobjs));
+}
+
+PyDoc_STRVAR(gmf_py_problems_doc,
+		"problems()\n\nNames of the problems, in index order.");
+
+static PyObject *gmf_py_problems(PyObject *self, PyObject *unused)
+{
+	PyObject *tuple = PyTuple_New(10);
+	int function;
+
+	for (function = 0; tuple != NULL && function < 10; ++function)
+	{
+		PyTuple_SET_ITEM(tuple, function,
+				PyUnicode_FromString(gmf_rwa_name(function)));
+	}
+	return tuple;
+}
+
+static PyMethodDef gmf_py_methods[] =
+{
+{ "evaluate", (PyCFunction) (void (*)(void)) gmf_py_evaluate,
+		METH_VARARGS | METH_KEYWORDS, gmf_py_evaluate_doc },
+{ "describe", gmf_py_describe, METH_O, gmf_py_describe_doc },
+{ "problems", gmf_py_problems, METH_NOARGS, gmf_py_problems_doc },
+{ NULL, NULL, 0, NULL } };
+
+static void gmf_py_free(void *module)
+{
+	if (py_pool != NULL)
+	{
+		gmf_pool_destroy(py_pool);
+		py_pool = NULL;
+	}
+	return;
+}
+
+static struct PyModuleDef gmf_py_module =
+{ PyModuleDef_HEAD_INIT, "gmf_rwa",
+		"Batch evaluation of the RWA problems on buffers.", -1,
+		gmf_py_methods, NULL, NULL, NULL, gmf_py_free };
+
+PyMODINIT_FUNC PyInit_gmf_rwa(void)
+{
+	return PyModule_Create(&gmf_py_module);
+}
@@ -0,0 +1,100 @@
+/*
+ * gmf_evald.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Evaluation server of gmf_server.h: serves the RWA problems to the
+ * optimizer processes of this machine through shared memory until SIGINT
+ * or SIGTERM, then prints the evaluations of every problem. Clients
+ * connect with gmf_client_connect under the same name.
+ *
+ *   gcc -O2 -I.. gmf_evald.c ../gmf_server.c ../gmf_dv_rwa.c ../gmf_rng.c \
+ *       ../gmf_pof.c ../gmf_parse.c -o gmf_evald -lm -lpthread
+ *   ./gmf_evald [-n name] [-s slots] [-p points] [-t threads]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include "gmf_global.h"
+#include "gmf_dv_rwa.h"
+#include "gmf_server.h"
+
+void (*gmf_test_problem)(double *F, double *G, double *xr, int *xi, int *xb);
+struct gmf_mop_desc gmf_mop;
+
+static gmf_server *server = NULL;
+
+static void on_signal(int signum)
+{
+	gmf_server_stop(server);
+	return;
+}
+
+int main(int argc, char **argv)
+{
+	const char *name = GMF_SERVER_NAME;
+	size_t nslots = GMF_SERVER_SLOTS, points = GMF_SERVER_POINTS, total = 0,
+			count;
+	int nworkers = 0, function, i;
+	struct sigaction action;
+
+	for (i = 1; i + 1 < argc && argv[i][0] == '-'; i += 2)
+	{
+		if (strcmp(argv[i], "-n") == 0)
+		{
+			name = argv[i + 1];
+		}
+		else if (strcmp(argv[i], "-s") == 0)
+		{
+			nslots = strtoul(argv[i + 1], NULL, 10);
+		}
+		else if (strcmp(argv[i], "-p") == 0)
+		{
+			points = strtoul(argv[i + 1], NULL, 10);
+		}
+		else if (strcmp(argv[i], "-t") == 0)
+		{
+			nworkers = atoi(argv[i + 1]);
+		}
+		else
+		{
+			break;
+		}
+	}
+	if (i < argc)
+	{
+		fprintf(stderr, "usage: %s [-n name] [-s slots] [-p points] "
+				"[-t threads]\n", argv[0]);
+		return 1;
+	}
+
+	server = gmf_server_create(name, nslots, points, nworkers);
+	if (server == NULL)
+	{
+		fprintf(stderr, "%s: cannot create the server (already running?)\n",
+				name);
+		return 1;
+	}
+	memset(&action, 0, sizeof(action));
+	action.sa_handler = on_signal;
+	sigaction(SIGINT, &action, NULL);
+	sigaction(SIGTERM, &action, NULL);
+	printf("serving %s\n", name);
+	fflush(stdout);
+
+	gmf_server_run(server);
+
+	for (function = 0; function < 10; ++function)
+	{
+		count = gmf_server_evaluations(server, function);
+		total += count;
+		if (count > 0)
+		{
+			printf("%-18s %12zu\n", gmf_rwa_name(function), count);
+		}
+	}
+	printf("%-18s %12zu\n", "total", total);
+	gmf_server_destroy(server);
+	return 0;
+}
@@ -0,0 +1,105 @@
+/*
+ * gmf_extremagen.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Writes gmf_extrema_tables.h, the ideal point, the payoff-table nadir
+ * estimate and the largest values over the box of every problem, computed
+ * by gmf_poly_ideal_nadir from the monomial tables of gmf_poly.c. The
+ * values are those of F (maximized objectives negated) and reach the
+ * problem descriptors (ideal, nadir and worst) through gmf_rwa_describe,
+ * so normalization needs no scan of a reference set or a population.
+ * Prints the certified gap of every ideal value. Run after changing the
+ * tables:
+ *
+ *   gcc -O2 -I.. gmf_extremagen.c ../gmf_extrema.c ../gmf_poly.c \
+ *       -o gmf_extremagen -lm
+ *   ./gmf_extremagen ../gmf_extrema_tables.h
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "gmf_global.h"
+#include "gmf_poly.h"
+#include "gmf_extrema.h"
+
+#define TOL 1e-12
+
+static void table(FILE *out, const char *name, double (*values)[7])
+{
+	const struct gmf_poly *poly;
+	char value[32];
+	int function, column;
+	size_t k;
+
+	fprintf(out, "static const double %s[10][7] =\n{\n", name);
+	for (function = 0; (poly = gmf_poly_get(function)) != NULL; ++function)
+	{
+		fprintf(out, "/* %s */\n{ ", poly->name);
+		column = 2;
+		for (k = 0; k < poly->nobjs; ++k)
+		{
+			snprintf(value, sizeof(value), "%.17g%s", values[function][k],
+					k + 1 < poly->nobjs ? "," : (function < 9 ? " }," : " }"));
+			if (k > 0 && column + 1 + strlen(value) > 80)
+			{
+				column = fprintf(out, "\n\t") + 7;
+			}
+			else if (k > 0)
+			{
+				column += fprintf(out, " ");
+			}
+			column += fprintf(out, "%s", value);
+		}
+		fprintf(out, "\n");
+	}
+	fprintf(out, "};\n\n");
+	return;
+}
+
+int main(int argc, char **argv)
+{
+	const char *file = argc > 1 ? argv[1] : "../gmf_extrema_tables.h";
+	static double ideal[10][7], nadir[10][7], worst[10][7];
+	const struct gmf_poly *poly;
+	double value, bound;
+	FILE *out;
+	int function;
+	size_t k;
+
+	for (function = 0; (poly = gmf_poly_get(function)) != NULL; ++function)
+	{
+		if (!gmf_poly_ideal_nadir(poly, TOL, ideal[function], nadir[function],
+				worst[function]))
+		{
+			fprintf(stderr, "%s: search did not converge\n", poly->name);
+			return 1;
+		}
+		printf("%-18s ideal gap", poly->name);
+		for (k = 0; k < poly->nobjs; ++k)
+		{
+			gmf_poly_extremum(poly, k, gmf_minimize, TOL, NULL, &value,
+					&bound);
+			printf(" %8.1e", value - bound);
+		}
+		printf("\n");
+	}
+
+	out = fopen(file, "w");
+	if (out == NULL)
+	{
+		fprintf(stderr, "cannot write %s\n", file);
+		return 1;
+	}
+	fprintf(out, "/*\n * gmf_extrema_tables.h\n *\n"
+			" * Generated by tools/gmf_extremagen from the tables of gmf_poly.c,"
+			" do not edit.\n"
+			" * Included by gmf_dv_rwa.c.\n */\n"
+			"#ifndef GMF_EXTREMA_TABLES_H_\n#define GMF_EXTREMA_TABLES_H_\n\n");
+	table(out, "rwa_ideal", ideal);
+	table(out, "rwa_nadir", nadir);
+	table(out, "rwa_worst", worst);
+	fprintf(out, "#endif /* GMF_EXTREMA_TABLES_H_ */\n");
+	fclose(out);
+	return 0;
+}
@@ -0,0 +1,89 @@
+/*
+ * gmf_pof2bin.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Converts text reference sets (POF/<problem>-<k>objs.pof) into the binary
+ * format of gmf_pof.h, next to the input (same name plus "b") or into the
+ * given output file. The objective senses are taken from the problem whose
+ * name prefixes the file name.
+ *
+ *   gcc -O2 -I.. gmf_pof2bin.c ../gmf_pof.c ../gmf_parse.c ../gmf_dv_rwa.c \
+ *       ../gmf_rng.c -o gmf_pof2bin -lm
+ *   ./gmf_pof2bin ../../POF/Gao2020-3objs.pof ../../POF/Xu2020-3objs.pof
+ *   ./gmf_pof2bin -o out.pofb in.pof
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "gmf_global.h"
+#include "gmf_dv_rwa.h"
+#include "gmf_pof.h"
+
+void (*gmf_test_problem)(double *F, double *G, double *xr, int *xi, int *xb);
+struct gmf_mop_desc gmf_mop;
+
+static int convert(const char *txt_file, const char *bin_file)
+{
+	char name[64];
+	const char *base = strrchr(txt_file, '/');
+	int sense[GMF_POF_MAXOBJS], function, ok;
+	size_t k;
+	gmf_pof_view view;
+
+	base = base != NULL ? base + 1 : txt_file;
+	snprintf(name, sizeof(name), "%.*s", (int) strcspn(base, "-."), base);
+	function = gmf_rwa_index(name);
+	for (k = 0; k < GMF_POF_MAXOBJS; ++k)
+	{
+		sense[k] = gmf_minimize;
+	}
+	if (function >= 0 && gmf_rwa_setup(name))
+	{
+		for (k = 0; k < gmf_mop.nobjs; ++k)
+		{
+			sense[k] = gmf_rwa_sense(function, k);
+		}
+		gmf_rwa_setdown();
+	}
+	else
+	{
+		fprintf(stderr, "%s: unknown problem, all objectives minimized\n",
+				txt_file);
+	}
+
+	ok = gmf_pof_convert(txt_file, bin_file, sense)
+			&& gmf_pof_open(bin_file, &view);
+	if (!ok)
+	{
+		fprintf(stderr, "%s: conversion failed\n", txt_file);
+		return 0;
+	}
+	printf("%s -> %s (%zu points, %zu objs)\n", txt_file, bin_file,
+			view.npoints, view.nobjs);
+	gmf_pof_close(&view);
+	return 1;
+}
+
+int main(int argc, char **argv)
+{
+	char bin_file[512];
+	int i, failed = 0;
+
+	if (argc == 4 && strcmp(argv[1], "-o") == 0)
+	{
+		return convert(argv[3], argv[2]) ? 0 : 1;
+	}
+	if (argc < 2)
+	{
+		fprintf(stderr, "usage: %s file.pof... | -o out.pofb file.pof\n",
+				argv[0]);
+		return 1;
+	}
+	for (i = 1; i < argc; ++i)
+	{
+		snprintf(bin_file, sizeof(bin_file), "%sb", argv[i]);
+		failed += !convert(argv[i], bin_file);
+	}
+	return failed > 0;
+}
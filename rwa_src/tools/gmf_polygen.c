@@ -0,0 +1,693 @@
+/*
+ * gmf_polygen.c
+ *
+ *  Created on: Oct 17, 2026
+ *
+ * Writes gmf_poly_kernels.h, the kernels generated from the monomial tables
+ * of gmf_poly.c. For every problem it emits
+ *
+ *   <name>_poly_eval(F, incf, xr, incx)  objectives, shaped like the
+ *                                        reference kernels
+ *   <name>_poly_evalf(F, incf, xr, incx) the same in single precision
+ *   <name>_poly_jac(F, J, xr)            objectives and Jacobian
+ *
+ * The objectives come in the cheaper of two forms:
+ *
+ *  - lattice: every monomial of degree >= 2 is computed once, as one product
+ *    of an already computed monomial and a variable, and shared by all the
+ *    objectives, each of which is then a plain sum of coefficient * monomial
+ *    (common subexpressions across objectives, e.g. H * Sy in Subasi2016);
+ *  - Horner: each objective on its own, recursively factored as
+ *    c + x_v * q(x) + r(x), x_v being the variable found in most of the
+ *    remaining monomials.
+ *
+ * The Jacobian kernels always use the lattice, which already holds most of
+ * the monomials of the derivatives. Run after changing the tables:
+ *
+ *   gcc -O2 -I.. gmf_polygen.c ../gmf_poly.c -o gmf_polygen
+ *   ./gmf_polygen ../gmf_poly_kernels.h
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+#include "gmf_poly.h"
+
+#define MAXVARS 16
+#define MAXNODES 1024
+#define MAXTERMS 256
+
+struct term
+{
+	double coef;
+	unsigned char e[MAXVARS];
+};
+
+/* Growing string */
+struct text
+{
+	char *s;
+	size_t n;
+	size_t capacity;
+};
+
+static size_t nvars;
+static int single; /* float kernels */
+static const char *real = "double";
+static unsigned char node_e[MAXNODES][MAXVARS];
+static int node_left[MAXNODES];
+static int node_var[MAXNODES];
+static int nnodes;
+
+static void text_printf(struct text *t, const char *format, ...)
+{
+	va_list args;
+	int len;
+
+	va_start(args, format);
+	len = vsnprintf(NULL, 0, format, args);
+	va_end(args);
+	if (t->n + len + 1 > t->capacity)
+	{
+		t->capacity = 2 * (t->n + len + 1);
+		t->s = realloc(t->s, t->capacity);
+	}
+	va_start(args, format);
+	vsnprintf(t->s + t->n, len + 1, format, args);
+	va_end(args);
+	t->n += len;
+	return;
+}
+
+static int degree(const unsigned char *e)
+{
+	int d = 0;
+	size_t j;
+	for (j = 0; j < nvars; ++j)
+	{
+		d += e[j];
+	}
+	return d;
+}
+
+/**
+ * Shortest literal that reads back as |c| (as |(float) c| for the float
+ * kernels)
+ */
+static void literal(char *buf, double c)
+{
+	int p;
+	c = c < 0 ? -c : c;
+	for (p = 1; p <= 17; ++p)
+	{
+		sprintf(buf, "%.*g", p, c);
+		if (single ? strtof(buf, NULL) == (float) c : strtod(buf, NULL) == c)
+		{
+			break;
+		}
+	}
+	if (strpbrk(buf, ".e") == NULL)
+	{
+		strcat(buf, ".0");
+	}
+	if (single)
+	{
+		strcat(buf, "f");
+	}
+	return;
+}
+
+static void zero(struct text *t)
+{
+	text_printf(t, single ? "0.0f" : "0.0");
+	return;
+}
+
+/** **************************************************************************
+ ** Monomial lattice
+ ** **************************************************************************/
+/**
+ * Id of the monomial e: -1 for 1, j for x_j, nvars + i for node i, which is
+ * added (with the nodes it is built from) if missing
+ */
+static int lattice_add(const unsigned char *e)
+{
+	unsigned char sub[MAXVARS];
+	int i, d = degree(e), left = -1;
+	size_t j, var = 0;
+
+	if (d == 0)
+	{
+		return -1;
+	}
+	if (d == 1)
+	{
+		for (j = 0; e[j] == 0; ++j)
+		{
+		}
+		return (int) j;
+	}
+	for (i = 0; i < nnodes; ++i)
+	{
+		if (memcmp(node_e[i], e, nvars) == 0)
+		{
+			return (int) nvars + i;
+		}
+	}
+	/* prefer a divisor that is already there */
+	for (j = 0; j < nvars && left < 0; ++j)
+	{
+		if (e[j] == 0)
+		{
+			continue;
+		}
+		memcpy(sub, e, nvars);
+		sub[j]--;
+		for (i = 0; i < nnodes; ++i)
+		{
+			if (memcmp(node_e[i], sub, nvars) == 0)
+			{
+				left = (int) nvars + i;
+				var = j;
+				break;
+			}
+		}
+		if (degree(sub) == 1)
+		{
+			left = lattice_add(sub);
+			var = j;
+		}
+	}
+	if (left < 0)
+	{
+		for (var = 0; e[var] == 0; ++var)
+		{
+		}
+		memcpy(sub, e, nvars);
+		sub[var]--;
+		left = lattice_add(sub);
+	}
+	memcpy(node_e[nnodes], e, nvars);
+	node_left[nnodes] = left;
+	node_var[nnodes] = (int) var;
+	return (int) nvars + nnodes++;
+}
+
+static void name(char *buf, int id)
+{
+	if (id < (int) nvars)
+	{
+		sprintf(buf, "x%d", id);
+	}
+	else
+	{
+		sprintf(buf, "m%d", id - (int) nvars);
+	}
+	return;
+}
+
+/**
+ * c0 + c1 * m1 + ... over the lattice; returns the flops
+ */
+static int lattice_sum(struct text *t, const struct term *terms, size_t n)
+{
+	char c[32], m[16];
+	size_t i, written = 0;
+	int id, flops = 0;
+
+	for (i = 0; i < n; ++i)
+	{
+		if (terms[i].coef == 0.0)
+		{
+			continue;
+		}
+		id = lattice_add(terms[i].e);
+		literal(c, terms[i].coef);
+		if (written > 0)
+		{
+			text_printf(t, terms[i].coef < 0 ? " - " : " + ");
+			flops++;
+		}
+		else if (terms[i].coef < 0)
+		{
+			text_printf(t, "-");
+		}
+		if (id < 0)
+		{
+			text_printf(t, "%s", c);
+		}
+		else
+		{
+			name(m, id);
+			if (strtod(c, NULL) == 1.0)
+			{
+				text_printf(t, "%s", m);
+			}
+			else
+			{
+				text_printf(t, "%s * %s", c, m);
+				flops++;
+			}
+		}
+		written++;
+	}
+	if (written == 0)
+	{
+		zero(t);
+	}
+	return flops;
+}
+
+/** **************************************************************************
+ ** Horner form
+ ** **************************************************************************/
+static int top_level_sum(const char *s)
+{
+	int depth = 0;
+	for (; *s != '\0'; ++s)
+	{
+		depth += (*s == '(') - (*s == ')');
+		if (depth == 0 && (strncmp(s, " + ", 3) == 0 || strncmp(s, " - ", 3) == 0))
+		{
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/**
+ * Appends the sum b to a, merging a leading minus of b into the operator
+ */
+static void join(struct text *a, const char *b)
+{
+	if (a->n == 0)
+	{
+		text_printf(a, "%s", b);
+	}
+	else if (b[0] == '-')
+	{
+		text_printf(a, " - %s", b + 1);
+	}
+	else
+	{
+		text_printf(a, " + %s", b);
+	}
+	return;
+}
+
+static int horner(struct text *t, const struct term *terms, size_t n)
+{
+	struct term *q = malloc(sizeof(struct term) * (n + 1));
+	struct term *r = malloc(sizeof(struct term) * (n + 1));
+	struct text qs = { NULL, 0, 0 }, rs = { NULL, 0, 0 }, piece =
+	{ NULL, 0, 0 };
+	size_t i, j, nq = 0, nr = 0, count[MAXVARS] = { 0 }, v = 0;
+	double c0 = 0.0;
+	char c[32];
+	int flops = 0, parts = 0;
+
+	for (i = 0; i < n; ++i)
+	{
+		if (terms[i].coef == 0.0)
+		{
+			continue;
+		}
+		if (degree(terms[i].e) == 0)
+		{
+			c0 += terms[i].coef;
+			continue;
+		}
+		for (j = 0; j < nvars; ++j)
+		{
+			count[j] += terms[i].e[j] > 0;
+		}
+	}
+	for (j = 1; j < nvars; ++j)
+	{
+		v = count[j] > count[v] ? j : v;
+	}
+	if (c0 != 0.0)
+	{
+		literal(c, c0);
+		text_printf(t, "%s%s", c0 < 0 ? "-" : "", c);
+		parts++;
+	}
+	if (count[v] == 0)
+	{
+		if (parts == 0)
+		{
+			zero(t);
+		}
+		free(q);
+		free(r);
+		return 0;
+	}
+	for (i = 0; i < n; ++i)
+	{
+		if (terms[i].coef == 0.0 || degree(terms[i].e) == 0)
+		{
+			continue;
+		}
+		if (terms[i].e[v] > 0)
+		{
+			q[nq] = terms[i];
+			q[nq++].e[v]--;
+		}
+		else
+		{
+			r[nr++] = terms[i];
+		}
+	}
+
+	/* x_v * q(x) */
+	flops += horner(&qs, q, nq) + 1;
+	if (top_level_sum(qs.s))
+	{
+		text_printf(&piece, "x%zu * (%s)", v, qs.s);
+	}
+	else if (qs.s[0] == '-')
+	{
+		text_printf(&piece, "-%s * x%zu", qs.s + 1, v);
+	}
+	else if (strtod(qs.s, NULL) == 1.0 && strchr(qs.s, ' ') == NULL)
+	{
+		text_printf(&piece, "x%zu", v);
+		flops--;
+	}
+	else
+	{
+		text_printf(&piece, "%s * x%zu", qs.s, v);
+	}
+	join(t, piece.s);
+	flops += parts++ > 0;
+
+	/* + r(x) */
+	if (nr > 0)
+	{
+		flops += horner(&rs, r, nr) + 1;
+		join(t, rs.s);
+	}
+	free(qs.s);
+	free(rs.s);
+	free(piece.s);
+	free(q);
+	free(r);
+	return flops;
+}
+
+/** **************************************************************************
+ ** Output
+ ** **************************************************************************/
+static int width(const char *s, size_t n)
+{
+	int w = 0;
+	size_t i;
+	for (i = 0; i < n; ++i)
+	{
+		w += s[i] == '\t' ? 4 - w % 4 : 1;
+	}
+	return w;
+}
+
+/**
+ * Writes "\t<lhs> = <rhs>;" wrapped at 80 columns before + and -
+ */
+static void statement(FILE *out, const char *lhs, const char *rhs)
+{
+	struct text line = { NULL, 0, 0 };
+	const char *s = rhs, *next;
+	size_t len;
+
+	text_printf(&line, "\t%s = ", lhs);
+	while (*s != '\0')
+	{
+		/* the next segment runs up to the following " op " */
+		for (next = s + 1; *next != '\0'; ++next)
+		{
+			if (next[0] == ' ' && strchr("+-", next[1]) != NULL
+					&& next[2] == ' ')
+			{
+				break;
+			}
+		}
+		len = next - s;
+		if (width(line.s, line.n) + width(s, len) + (*next == '\0') > 80
+				&& line.n > 0 && line.s[line.n - 1] != ' ')
+		{
+			fprintf(out, "%s\n", line.s);
+			line.n = 0;
+			text_printf(&line, "\t\t\t");
+			if (*s == ' ')
+			{
+				s++;
+				len--;
+			}
+		}
+		text_printf(&line, "%.*s", (int) len, s);
+		s = next;
+	}
+	fprintf(out, "%s;\n", line.s);
+	free(line.s);
+	return;
+}
+
+static void declare_variables(FILE *out, int strided)
+{
+	size_t j;
+	for (j = 0; j < nvars; ++j)
+	{
+		if (!strided || j == 0)
+		{
+			fprintf(out, "\t%s x%zu = xr[%zu];\n", real, j, j);
+		}
+		else if (j == 1)
+		{
+			fprintf(out, "\t%s x1 = xr[incx];\n", real);
+		}
+		else
+		{
+			fprintf(out, "\t%s x%zu = xr[%zu * incx];\n", real, j, j);
+		}
+	}
+	return;
+}
+
+static void declare_nodes(FILE *out, int from)
+{
+	char a[16], b[16], m[16];
+	int i;
+	for (i = from; i < nnodes; ++i)
+	{
+		name(a, node_left[i]);
+		name(b, node_var[i]);
+		name(m, (int) nvars + i);
+		fprintf(out, "\t%s %s = %s * %s;\n", real, m, a, b);
+	}
+	return;
+}
+
+/**
+ * Terms of objective k (or of dF_k / dx_j if j < nvars)
+ */
+static size_t objective(const struct gmf_poly *poly, size_t k, size_t j,
+		struct term *terms)
+{
+	size_t t, n = 0;
+	const unsigned char *e;
+	for (t = 0; t < poly->nterms; ++t)
+	{
+		e = poly->power + t * poly->nvars;
+		terms[n].coef = poly->coef[t * poly->nobjs + k];
+		memset(terms[n].e, 0, MAXVARS);
+		memcpy(terms[n].e, e, poly->nvars);
+		if (j < poly->nvars)
+		{
+			if (e[j] == 0)
+			{
+				continue;
+			}
+			terms[n].coef *= e[j];
+			terms[n].e[j]--;
+		}
+		n += terms[n].coef != 0.0;
+	}
+	return n;
+}
+
+/**
+ * Flops of the objectives written term by term as in the published formulas
+ */
+static int naive_flops(const struct gmf_poly *poly)
+{
+	struct term terms[MAXTERMS];
+	size_t k, i, n;
+	int flops = 0, d;
+	for (k = 0; k < poly->nobjs; ++k)
+	{
+		n = objective(poly, k, MAXVARS, terms);
+		for (i = 0; i < n; ++i)
+		{
+			d = degree(terms[i].e);
+			flops += (i > 0) + d - (d > 0 && fabs(terms[i].coef) == 1.0);
+		}
+	}
+	return flops;
+}
+
+static void index_expr(char *buf, const char *base, size_t k, int strided)
+{
+	if (k == 0)
+	{
+		sprintf(buf, "%s[0]", base);
+	}
+	else if (!strided)
+	{
+		sprintf(buf, "%s[%zu]", base, k);
+	}
+	else if (k == 1)
+	{
+		sprintf(buf, "%s[incf]", base);
+	}
+	else
+	{
+		sprintf(buf, "%s[%zu * incf]", base, k);
+	}
+	return;
+}
+
+/**
+ * Value kernel <name>_poly_eval (<name>_poly_evalf in float), in the
+ * cheaper form; returns its flops
+ */
+static int generate_eval(FILE *out, const struct gmf_poly *poly, int flt)
+{
+	struct term terms[MAXTERMS];
+	struct text *sum = calloc(2 * poly->nobjs, sizeof(struct text));
+	char lhs[32];
+	size_t k, n;
+	int lattice_flops = 0, horner_flops = 0, lattice;
+
+	single = flt;
+	real = flt ? "float" : "double";
+	nnodes = 0;
+	for (k = 0; k < poly->nobjs; ++k)
+	{
+		n = objective(poly, k, MAXVARS, terms);
+		lattice_flops += lattice_sum(&sum[k], terms, n);
+		horner_flops += horner(&sum[poly->nobjs + k], terms, n);
+	}
+	lattice_flops += nnodes;
+	lattice = lattice_flops <= horner_flops;
+
+	if (!flt)
+	{
+		fprintf(out, "/* %s: %zu monomials, %s form, %d flops (term by term %d) */\n",
+				poly->name, poly->nterms, lattice ? "lattice" : "Horner",
+				lattice ? lattice_flops : horner_flops, naive_flops(poly));
+	}
+	fprintf(out, "GMF_KERNEL void %s_poly_eval%s(%s *F, size_t incf, "
+			"const %s *xr,\n\t\tsize_t incx)\n{\n", poly->name, flt ? "f" : "",
+			real, real);
+	declare_variables(out, 1);
+	if (lattice)
+	{
+		declare_nodes(out, 0);
+	}
+	fprintf(out, "\n");
+	for (k = 0; k < poly->nobjs; ++k)
+	{
+		index_expr(lhs, "F", k, 1);
+		statement(out, lhs, sum[lattice ? k : poly->nobjs + k].s);
+	}
+	fprintf(out, "\treturn;\n}\n\n");
+	for (k = 0; k < 2 * poly->nobjs; ++k)
+	{
+		free(sum[k].s);
+	}
+	free(sum);
+	single = 0;
+	real = "double";
+	return lattice ? lattice_flops : horner_flops;
+}
+
+static void generate(FILE *out, const struct gmf_poly *poly)
+{
+	struct term terms[MAXTERMS];
+	struct text *sum = calloc(poly->nobjs * (poly->nvars + 1),
+			sizeof(struct text));
+	char lhs[32];
+	size_t k, j, n;
+	int flops, jac_flops;
+
+	nvars = poly->nvars;
+	flops = generate_eval(out, poly, 0);
+	generate_eval(out, poly, 1);
+
+	/* Jacobian: lattice of the objectives and of their derivatives */
+	nnodes = 0;
+	jac_flops = 0;
+	for (k = 0; k < poly->nobjs; ++k)
+	{
+		n = objective(poly, k, MAXVARS, terms);
+		jac_flops += lattice_sum(&sum[poly->nobjs * poly->nvars + k], terms, n);
+		for (j = 0; j < poly->nvars; ++j)
+		{
+			n = objective(poly, k, j, terms);
+			jac_flops += lattice_sum(&sum[k * poly->nvars + j], terms, n);
+		}
+	}
+	jac_flops += nnodes;
+	fprintf(out, "/* %s: objectives and Jacobian, %d flops */\n", poly->name,
+			jac_flops);
+	fprintf(out, "GMF_KERNEL void %s_poly_jac(double *F, double *J, "
+			"const double *xr)\n{\n", poly->name);
+	declare_variables(out, 0);
+	declare_nodes(out, 0);
+	fprintf(out, "\n");
+	for (k = 0; k < poly->nobjs; ++k)
+	{
+		index_expr(lhs, "F", k, 0);
+		statement(out, lhs, sum[poly->nobjs * poly->nvars + k].s);
+	}
+	for (k = 0; k < poly->nobjs * poly->nvars; ++k)
+	{
+		index_expr(lhs, "J", k, 0);
+		statement(out, lhs, sum[k].s);
+	}
+	fprintf(out, "\treturn;\n}\n\n");
+
+	printf("%-18s %3zu monomials %5d flops (term by term %d), Jacobian %d\n",
+			poly->name, poly->nterms, flops, naive_flops(poly), jac_flops);
+	for (k = 0; k < poly->nobjs * (poly->nvars + 1); ++k)
+	{
+		free(sum[k].s);
+	}
+	free(sum);
+	return;
+}
+
+int main(int argc, char **argv)
+{
+	const char *file = argc > 1 ? argv[1] : "../gmf_poly_kernels.h";
+	FILE *out = fopen(file, "w");
+	int function;
+
+	if (out == NULL)
+	{
+		fprintf(stderr, "cannot write %s\n", file);
+		return 1;
+	}
+	fprintf(out, "/*\n * gmf_poly_kernels.h\n *\n"
+			" * Generated by tools/gmf_polygen from the tables of gmf_poly.c,"
+			" do not edit.\n"
+			" * Included by gmf_dv_rwa.c, which defines GMF_KERNEL.\n */\n"
+			"#ifndef GMF_POLY_KERNELS_H_\n#define GMF_POLY_KERNELS_H_\n\n");
+	for (function = 0; gmf_poly_get(function) != NULL; ++function)
+	{
+		generate(out, gmf_poly_get(function));
+	}
+	fprintf(out, "#endif /* GMF_POLY_KERNELS_H_ */\n");
+	fclose(out);
+	return 0;
+}